@@ -20,6 +20,7 @@ using namespace std;
 
 // application helper includes ////////////////////////////////////////////////////////////////////
 #include "../../_COMMON/inc/TrackBall.h"
+#include "../../_COMMON/inc/StateTracker.h"
 
 
 
@@ -51,10 +52,10 @@ void initRendering()
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
 	// set background color
-	glClearColor(0.0f, 0.0f, 0.4f, 0.0f);
+	StateTracker::clearColor(0.0f, 0.0f, 0.4f, 0.0f);
 	glClear(GL_COLOR_BUFFER_BIT);
-	glPolygonMode(GL_FRONT, GL_FILL);
-	glPolygonMode(GL_BACK, GL_LINE);
+	StateTracker::polygonMode(GL_FRONT, GL_FILL);
+	StateTracker::polygonMode(GL_BACK, GL_LINE);
 
 	// setup orthographic projection matrix
 	glMatrixMode(GL_PROJECTION);
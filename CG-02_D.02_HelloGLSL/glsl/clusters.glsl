@@ -0,0 +1,41 @@
+// clustered lighting buffers (included by the clustered lighting shaders, option: -lights),
+// layouts and bindings of ClusteredLighting.h
+
+#pragma once
+
+layout (std140, binding = 0) uniform ClusterParameters
+{
+	uvec4 clusterGrid;      // tiles x, tiles y, slices, lights
+	vec4  clusterSlicing;   // slice = log(depth) * x + y, viewport width and height
+	uvec4 clusterLimits;    // index capacity, lights per cluster
+};
+
+struct Light
+{
+	vec4 position;    // xyz view position, w range
+	vec4 color;       // rgb intensity, w cosine of the spot cone angle (-1 point light)
+	vec4 direction;   // xyz spot direction
+	vec4 bounds;      // bounding sphere of the lit volume
+};
+
+layout (std430, binding = 0) readonly buffer LightBuffer
+{
+	Light lights[];
+};
+
+layout (std430, binding = 1) readonly buffer ClusterBoundsBuffer
+{
+	vec4 clusterBounds[];   // minimum and maximum of every cluster
+};
+
+layout (std430, binding = 2) buffer ClusterListBuffer
+{
+	uvec2 clusterLists[];   // offset and count in lightIndices
+};
+
+layout (std430, binding = 3) buffer LightIndexBuffer
+{
+	uint lightIndexCount;
+	uint lightIndexOverflow;
+	uint lightIndices[];
+};
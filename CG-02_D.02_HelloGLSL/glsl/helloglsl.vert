@@ -2,10 +2,20 @@
 
 #version 400
 
+#ifdef GL_SPIRV
+#extension GL_ARB_explicit_uniform_location : require
+#endif
+
 layout (location = 0) in vec4 vecPosition;
 
+#ifdef GL_SPIRV
+// precompiled SPIR-V modules carry no names, the application uses these locations
+layout (location = 0) uniform mat4 matModelView;
+layout (location = 1) uniform mat4 matProjection;
+#else
 uniform mat4 matModelView;
 uniform mat4 matProjection;
+#endif
 
 void main()
 {
@@ -0,0 +1,47 @@
+// clustered forward shading fragment shader code (option: -lights), shades with the lights of
+// the fragment's cluster only
+
+#version 430
+
+#ifdef GL_SPIRV
+#extension GL_GOOGLE_include_directive : require
+#endif
+
+#include "clusters.glsl"
+
+in vec3 viewPosition;
+in vec3 viewNormal;
+
+out vec4 fragColor;
+
+void main()
+{
+	// cluster of the fragment: screen tile and exponential depth slice
+	uvec2 tile = uvec2(gl_FragCoord.xy * vec2(clusterGrid.xy) / clusterSlicing.zw);
+	float slice = max(log(-viewPosition.z) * clusterSlicing.x + clusterSlicing.y, 0.0);
+	uvec3 cell = min(uvec3(tile, uint(slice)), clusterGrid.xyz - 1u);
+	uvec2 list = clusterLists[(cell.z * clusterGrid.y + cell.y) * clusterGrid.x + cell.x];
+
+	vec3 normal = normalize(viewNormal);
+	vec3 albedo = vec3(0.8);
+	vec3 color = 0.02 * albedo;
+	for (uint i = 0u; i < list.y; ++i)
+	{
+		Light light = lights[lightIndices[list.x + i]];
+		vec3 toLight = light.position.xyz - viewPosition;
+		float distance = length(toLight);
+		vec3 direction = toLight / max(distance, 1.0e-4);
+
+		// inverse square falloff windowed to zero at the range
+		float window = clamp(1.0 - pow(distance / light.position.w, 4.0), 0.0, 1.0);
+		float attenuation = window * window / (distance * distance + 1.0);
+		if (light.color.w > -1.0)
+		{
+			// spot cone with a soft edge
+			float edge = mix(light.color.w, 1.0, 0.2);
+			attenuation *= smoothstep(light.color.w, edge, dot(-direction, light.direction.xyz));
+		}
+		color += light.color.rgb * albedo * max(dot(normal, direction), 0.0) * attenuation;
+	}
+	fragColor = vec4(color, 1.0);
+}
@@ -0,0 +1,37 @@
+// clustered lighting vertex shader code (core profile, option: -lights), draws sphere
+// instances on a square grid and passes view coordinates to the fragment shader
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_explicit_uniform_location : require
+#endif
+
+layout (location = 0) in vec4 vecPosition;
+
+#ifdef GL_SPIRV
+layout (location = 0) uniform mat4 matModelView;
+layout (location = 1) uniform mat4 matProjection;
+layout (location = 2) uniform vec2 instanceGrid;
+#else
+uniform mat4 matModelView;
+uniform mat4 matProjection;
+uniform vec2 instanceGrid;   // columns, spacing
+#endif
+
+out vec3 viewPosition;
+out vec3 viewNormal;
+
+void main()
+{
+	// instances in the xz plane around the origin, the sphere mesh is centered at the origin
+	int columns = int(instanceGrid.x);
+	vec2 cell = vec2(gl_InstanceID % columns, gl_InstanceID / columns);
+	cell -= 0.5 * (instanceGrid.x - 1.0);
+	vec4 position = vecPosition + vec4(cell.x * instanceGrid.y, 0.0, cell.y * instanceGrid.y, 0.0);
+
+	vec4 view = matModelView * position;
+	viewPosition = view.xyz;
+	viewNormal = mat3(matModelView) * vecPosition.xyz;
+	gl_Position = matProjection * view;
+}
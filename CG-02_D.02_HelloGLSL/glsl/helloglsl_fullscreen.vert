@@ -0,0 +1,13 @@
+// fullscreen triangle vertex shader code (core profile, option: -graph)
+
+#version 400
+
+out vec2 texCoord;
+
+void main()
+{
+	// one triangle covering the viewport, generated from the vertex index (no attributes)
+	vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	texCoord = position;
+	gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
@@ -0,0 +1,55 @@
+// instanced modeling vertex shader code (core profile)
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_explicit_uniform_location : require
+#extension GL_GOOGLE_include_directive : require
+#endif
+
+#include "quaternion.glsl"
+
+layout (location = 0) in vec4 vecPosition;
+layout (location = 1) in vec4 vecInstance0; // per-instance attributes (divisor 1)
+layout (location = 2) in vec4 vecInstance1;
+layout (location = 3) in vec4 vecInstance2;
+layout (location = 4) in vec4 vecInstance3;
+
+#ifdef GL_SPIRV
+// precompiled SPIR-V modules carry no names, the application uses these locations
+layout (location = 0) uniform mat4 matModelView;
+layout (location = 1) uniform mat4 matProjection;
+#else
+uniform mat4 matModelView;
+uniform mat4 matProjection;
+#endif
+
+// instance format 0: mat4, 1: mat3x4 rows, 2: quaternion + translation/scale
+// (specialization constant of the SPIR-V module or injected define of the program variant)
+#if defined(GL_SPIRV)
+layout (constant_id = 0) const int instanceFormat = 1;
+#else
+const int instanceFormat = INSTANCE_FORMAT;
+#endif
+
+void main()
+{
+	vec4 position;
+
+	if (instanceFormat == 0)
+	{
+		position = mat4(vecInstance0, vecInstance1, vecInstance2, vecInstance3) * vecPosition;
+	}
+	else if (instanceFormat == 1)
+	{
+		position = vec4(dot(vecInstance0, vecPosition),
+		                dot(vecInstance1, vecPosition),
+		                dot(vecInstance2, vecPosition), vecPosition.w);
+	}
+	else
+	{
+		position = vec4(rotate(vecInstance0, vecPosition.xyz * vecInstance1.w) + vecInstance1.xyz, 1.0);
+	}
+
+	gl_Position = matProjection * matModelView * position;
+}
@@ -0,0 +1,17 @@
+// GPU particle system fragment shader code (option: -particles), round soft sprite with
+// premultiplied alpha
+
+#version 400
+
+in float particleAlpha;
+
+out vec4 fragColor;
+
+void main()
+{
+	vec2 offset = 2.0 * gl_PointCoord - 1.0;
+	float falloff = max(1.0 - dot(offset, offset), 0.0);
+	float alpha = particleAlpha * falloff * falloff * 0.6;
+	vec3 color = mix(vec3(1.0, 0.35, 0.1), vec3(1.0, 0.9, 0.5), falloff);
+	fragColor = vec4(color * alpha, alpha);
+}
@@ -0,0 +1,41 @@
+// GPU particle system vertex shader code (core profile, option: -particles), one point sprite
+// per particle read from the particle buffer, back to front through the sorted indices
+
+#version 430
+
+#ifdef GL_SPIRV
+#extension GL_GOOGLE_include_directive : require
+#endif
+
+#include "particles.glsl"
+
+layout (std430, binding = 0) readonly buffer Particles { Particle particles[]; };
+layout (std430, binding = 5) readonly buffer SortedIndices { uint sortedIndices[]; };
+
+#ifdef GL_SPIRV
+layout (location = 0) uniform mat4 matModelView;
+layout (location = 1) uniform mat4 matProjection;
+layout (location = 2) uniform float viewportHeight;
+layout (location = 3) uniform int sortedParticles;
+#else
+uniform mat4 matModelView;
+uniform mat4 matProjection;
+uniform float viewportHeight;   // pixels
+uniform int sortedParticles;    // draw through the sorted indices
+#endif
+
+out float particleAlpha;
+
+void main()
+{
+	uint index = (sortedParticles != 0) ? sortedIndices[gl_VertexID] : uint(gl_VertexID);
+	Particle particle = particles[index];
+
+	vec4 view = matModelView * vec4(particle.position.xyz, 1.0);
+	gl_Position = matProjection * view;
+	float pixels = emitterPosition.w * matProjection[1][1] * viewportHeight / max(-view.z, 0.01);
+	gl_PointSize = clamp(pixels, 1.0, 64.0);
+
+	// fade out during the last quarter of the maximum lifetime
+	particleAlpha = clamp(particle.position.w / (0.25 * emitterVelocity.z), 0.0, 1.0);
+}
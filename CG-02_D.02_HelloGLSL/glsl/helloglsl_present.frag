@@ -0,0 +1,24 @@
+// present fragment shader code (core profile, option: -graph), adds the bloom to the scene
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_shading_language_420pack : require
+#endif
+
+in vec2 texCoord;
+
+#ifdef GL_SPIRV
+layout (binding = 0) uniform sampler2D texScene;
+layout (binding = 1) uniform sampler2D texBloom;
+#else
+uniform sampler2D texScene;
+uniform sampler2D texBloom;
+#endif
+
+out vec4 fragColor;
+
+void main()
+{
+	fragColor = vec4(texture(texScene, texCoord).rgb + texture(texBloom, texCoord).rgb, 1.0);
+}
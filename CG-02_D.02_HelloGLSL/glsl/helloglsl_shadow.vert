@@ -0,0 +1,22 @@
+// shadow map vertex shader code (core profile, option: -shadows), depth only: transforms the
+// sphere instances (offset and scale per instance) into light clip coordinates
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_explicit_uniform_location : require
+#endif
+
+layout (location = 0) in vec4 vecPosition;
+layout (location = 1) in vec4 vecInstance;   // xyz offset, w scale
+
+#ifdef GL_SPIRV
+layout (location = 0) uniform mat4 matViewProjection;
+#else
+uniform mat4 matViewProjection;
+#endif
+
+void main()
+{
+	gl_Position = matViewProjection * vec4(vecPosition.xyz * vecInstance.w + vecInstance.xyz, 1.0);
+}
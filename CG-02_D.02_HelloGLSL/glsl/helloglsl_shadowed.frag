@@ -0,0 +1,52 @@
+// shadowed shading fragment shader code (option: -shadows), selects the shadow cascade by the
+// view depth and filters the shadow map with 4 bilinear comparison taps
+
+#version 430
+
+in vec3 worldPosition;
+in vec3 worldNormal;
+in float viewDepth;
+
+#ifdef GL_SPIRV
+layout (location = 2) uniform mat4 shadowMatrices[4];
+layout (location = 6) uniform vec4 shadowSplits;
+layout (location = 7) uniform vec3 lightDirection;
+layout (location = 8) uniform int shadowCascades;
+#else
+uniform mat4 shadowMatrices[4];   // world to light clip coordinates of every cascade
+uniform vec4 shadowSplits;        // far view depth of every cascade
+uniform vec3 lightDirection;      // direction the light travels
+uniform int shadowCascades;
+#endif
+layout (binding = 0) uniform sampler2DArrayShadow shadowMap;
+
+out vec4 fragColor;
+
+float shadow(vec3 normal)
+{
+	// first cascade whose far split lies behind the fragment
+	int cascade = int(dot(vec4(greaterThan(vec4(viewDepth), shadowSplits)), vec4(1.0)));
+	if (cascade >= shadowCascades) return 1.0;
+
+	// offset along the normal against acne on surfaces grazed by the light (texel size from
+	// the x scale of the orthographic projection)
+	mat4 matrix = shadowMatrices[cascade];
+	float scale = length(vec3(matrix[0][0], matrix[1][0], matrix[2][0]));
+	float texel = 2.0 / (scale * float(textureSize(shadowMap, 0).x));
+	vec4 light = matrix * vec4(worldPosition + 1.5 * texel * normal, 1.0);
+	vec3 coord = light.xyz * 0.5 + 0.5;
+
+	float lit = texture(shadowMap, vec4(coord.xy, float(cascade), coord.z));
+	lit += textureOffset(shadowMap, vec4(coord.xy, float(cascade), coord.z), ivec2(-1, 0));
+	lit += textureOffset(shadowMap, vec4(coord.xy, float(cascade), coord.z), ivec2(0, -1));
+	lit += textureOffset(shadowMap, vec4(coord.xy, float(cascade), coord.z), ivec2(-1, -1));
+	return 0.25 * lit;
+}
+
+void main()
+{
+	vec3 normal = normalize(worldNormal);
+	float diffuse = max(dot(normal, -lightDirection), 0.0);
+	vec3 albedo = vec3(0.8);
+	fragColor = vec4(albedo * (0.15 + 0.85 * diffuse * shadow(normal)), 1.0);
+}
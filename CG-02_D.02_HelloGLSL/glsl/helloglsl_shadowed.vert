@@ -0,0 +1,34 @@
+// shadowed shading vertex shader code (core profile, option: -shadows), passes world
+// coordinates for the shadow map lookup and the view depth for the cascade selection
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_explicit_uniform_location : require
+#endif
+
+layout (location = 0) in vec4 vecPosition;
+layout (location = 1) in vec4 vecInstance;   // xyz offset, w scale
+layout (location = 2) in vec3 vecNormal;
+
+#ifdef GL_SPIRV
+layout (location = 0) uniform mat4 matView;
+layout (location = 1) uniform mat4 matProjection;
+#else
+uniform mat4 matView;
+uniform mat4 matProjection;
+#endif
+
+out vec3 worldPosition;
+out vec3 worldNormal;
+out float viewDepth;
+
+void main()
+{
+	worldPosition = vecPosition.xyz * vecInstance.w + vecInstance.xyz;
+	worldNormal = vecNormal;
+
+	vec4 view = matView * vec4(worldPosition, 1.0);
+	viewDepth = -view.z;
+	gl_Position = matProjection * view;
+}
@@ -0,0 +1,34 @@
+// tessellated terrain fragment shader code (option: -terrain), shades with the normal of the
+// terrain function itself, so the lighting does not change with the tessellation levels
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_GOOGLE_include_directive : require
+#extension GL_ARB_explicit_uniform_location : require
+#endif
+
+#include "terrain.glsl"
+
+in vec3 terrainPosition;
+
+#ifdef GL_SPIRV
+layout (location = 0) uniform vec2 terrainSize;
+#else
+uniform vec2 terrainSize;   // extent, height
+#endif
+
+out vec4 fragColor;
+
+void main()
+{
+	vec3 normal = terrainNormal(terrainPosition.xz, terrainSize, terrainSize.x / 2048.0);
+	float diffuse = max(dot(normal, normalize(vec3(-1.0, 2.0, 0.5))), 0.0);
+
+	// grass on the flat parts, rock on the slopes and snow on the peaks
+	float height = terrainPosition.y / terrainSize.y;
+	vec3 albedo = mix(vec3(0.25, 0.45, 0.15), vec3(0.45, 0.4, 0.35), smoothstep(0.6, 0.8,
+		1.0 - normal.y));
+	albedo = mix(albedo, vec3(0.95), smoothstep(0.7, 0.8, height) * normal.y);
+	fragColor = vec4(albedo * (0.2 + 0.8 * diffuse), 1.0);
+}
@@ -0,0 +1,13 @@
+// tessellated terrain vertex shader code (core profile, option: -terrain), passes the patch
+// corners to the tessellation control shader
+
+#version 400
+
+layout (location = 0) in vec2 vecPosition;   // xz corner of the patch grid
+
+out vec2 cornerPosition;
+
+void main()
+{
+	cornerPosition = vecPosition;
+}
@@ -0,0 +1,22 @@
+// textured modeling fragment shader code (core profile, option: -texture)
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_shading_language_420pack : require
+#endif
+
+in vec2 texCoord;
+
+#ifdef GL_SPIRV
+layout (binding = 0) uniform sampler2D texImage;
+#else
+uniform sampler2D texImage;
+#endif
+
+out vec4 fragColor;
+
+void main()
+{
+	fragColor = texture(texImage, texCoord);
+}
@@ -0,0 +1,26 @@
+// textured modeling vertex shader code (core profile, option: -texture)
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_explicit_uniform_location : require
+#endif
+
+layout (location = 0) in vec4 vecPosition;
+
+#ifdef GL_SPIRV
+layout (location = 0) uniform mat4 matModelView;
+layout (location = 1) uniform mat4 matProjection;
+#else
+uniform mat4 matModelView;
+uniform mat4 matProjection;
+#endif
+
+out vec2 texCoord;
+
+void main()
+{
+	// map the triangle's bounding square (-5..5) to the whole image
+	texCoord = vecPosition.xy * 0.1 + 0.5;
+	gl_Position = matProjection * matModelView * vecPosition;
+}
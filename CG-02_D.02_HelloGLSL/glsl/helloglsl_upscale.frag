@@ -0,0 +1,48 @@
+// upscale fragment shader code (core profile, option: -dynres), stretches the rendered part of
+// the dynamic resolution target over the window and sharpens it with a neighborhood clamped
+// unsharp mask
+
+#version 400
+
+#ifdef GL_SPIRV
+#extension GL_ARB_shading_language_420pack : require
+#extension GL_ARB_explicit_uniform_location : require
+#endif
+
+in vec2 texCoord;
+
+#ifdef GL_SPIRV
+layout (binding = 0) uniform sampler2D texScene;
+layout (location = 0) uniform vec2 texScale;
+layout (location = 1) uniform vec2 texelSize;
+layout (location = 2) uniform float sharpness;
+#else
+uniform sampler2D texScene;
+uniform vec2 texScale;    // rendered part of the target
+uniform vec2 texelSize;   // of the target
+uniform float sharpness;
+#endif
+
+out vec4 fragColor;
+
+vec3 fetch(vec2 coord)
+{
+	// stay inside the rendered part, the rest of the target holds stale texels
+	return texture(texScene, clamp(coord, 0.5 * texelSize, texScale - 0.5 * texelSize)).rgb;
+}
+
+void main()
+{
+	vec2 coord = texCoord * texScale;
+	vec3 center = fetch(coord);
+	vec3 north = fetch(coord + vec2(0.0, texelSize.y));
+	vec3 south = fetch(coord - vec2(0.0, texelSize.y));
+	vec3 east = fetch(coord + vec2(texelSize.x, 0.0));
+	vec3 west = fetch(coord - vec2(texelSize.x, 0.0));
+
+	// unsharp mask, limited to the range of the neighborhood against halos
+	vec3 sharpened = center + sharpness * (center - 0.25 * (north + south + east + west));
+	vec3 low = min(center, min(min(north, south), min(east, west)));
+	vec3 high = max(center, max(max(north, south), max(east, west)));
+	fragColor = vec4(clamp(sharpened, low, high), 1.0);
+}
@@ -0,0 +1,30 @@
+// GPU particle system data (included by the particle shaders, option: -particles), layouts and
+// bindings of ParticleSystem.h
+
+#pragma once
+
+struct Particle
+{
+	vec4 position;   // xyz position, w remaining life in seconds
+	vec4 velocity;   // xyz velocity, w unused
+};
+
+layout (std140, binding = 0) uniform ParticleParameters
+{
+	vec4  emitterPosition;   // xyz position, w particle radius
+	vec4  emitterVelocity;   // speed, cone spread, maximum lifetime, gravity
+	vec4  simulation;        // time step, restitution of the ground, depth keys (0/1)
+	vec4  eyePosition;       // model coordinates
+	uvec4 emission;          // requested particles, seed of the first one, capacity
+};
+
+// lowbias32 integer hash, the same bits as ParticleSystem::random() on the CPU
+float particleRandom(uint seed)
+{
+	seed ^= seed >> 16;
+	seed *= 0x7feb352du;
+	seed ^= seed >> 15;
+	seed *= 0x846ca68bu;
+	seed ^= seed >> 16;
+	return float(seed >> 8) * (1.0 / 16777216.0);
+}
@@ -0,0 +1,9 @@
+// quaternion helper functions (included by the vertex shaders)
+
+#pragma once
+
+// rotate vector v by the unit quaternion q = (x, y, z, w)
+vec3 rotate(vec4 q, vec3 v)
+{
+	return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
@@ -0,0 +1,56 @@
+// procedural terrain (included by the tessellated terrain shaders, option: -terrain), value
+// noise fBm over the coordinates normalized by the terrain extent, heights in [0, 1]
+
+#pragma once
+
+const int TERRAIN_OCTAVES = 5;
+
+float terrainHash(ivec2 cell)
+{
+	uint h = uint(cell.x) * 1597334677u ^ uint(cell.y) * 3812015801u;
+	h = h * 747796405u + 2891336453u;
+	h = (h ^ (h >> 16)) * 2246822519u;
+	h ^= h >> 13;
+	return float(h) * (1.0 / 4294967295.0);
+}
+
+float terrainNoise(vec2 p)
+{
+	vec2 cell = floor(p);
+	vec2 f = p - cell;
+	vec2 s = f * f * f * (f * (f * 6.0 - 15.0) + 10.0);
+	ivec2 c = ivec2(cell);
+	float a = terrainHash(c);
+	float b = terrainHash(c + ivec2(1, 0));
+	float d = terrainHash(c + ivec2(0, 1));
+	float e = terrainHash(c + ivec2(1, 1));
+	return mix(mix(a, b, s.x), mix(d, e, s.x), s.y);
+}
+
+float terrainHeight(vec2 p)
+{
+	float height = 0.0, amplitude = 1.0, sum = 0.0;
+	p *= 2.0;
+	for (int i = 0; i < TERRAIN_OCTAVES; ++i)
+	{
+		height += amplitude * terrainNoise(p);
+		sum += amplitude;
+		amplitude *= 0.5;
+		p = 2.0 * p + vec2(17.0, 31.0);
+	}
+	return height / sum;
+}
+
+// model coordinates of the terrain at xz, size is the extent and the height of the terrain
+vec3 terrainPoint(vec2 xz, vec2 size)
+{
+	return vec3(xz.x, size.y * terrainHeight(xz / size.x), xz.y);
+}
+
+vec3 terrainNormal(vec2 xz, vec2 size, float delta)
+{
+	vec2 dx = vec2(delta, 0.0), dz = vec2(0.0, delta);
+	vec3 tangent = terrainPoint(xz + dx, size) - terrainPoint(xz - dx, size);
+	vec3 bitangent = terrainPoint(xz + dz, size) - terrainPoint(xz - dz, size);
+	return normalize(cross(bitangent, tangent));
+}
@@ -1,5 +1,5 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
-// Demo: CG-02-D.02 - Hello GLSL Demo (Ver 2.1)                                                  //
+// Demo: CG-02-D.02 - Hello GLSL Demo (Ver 2.2)                                                  //
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 
@@ -7,6 +7,11 @@
 // system includes ////////////////////////////////////////////////////////////////////////////////
 #include <iostream>
 #include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
 using namespace std;
 
 
@@ -20,23 +25,1189 @@ using namespace std;
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/quaternion.hpp>
 
 
 // application helper includes ////////////////////////////////////////////////////////////////////
 #include "../../_COMMON/inc/TrackBall.h"
 #include "../../_COMMON/inc/UtilGLSL.h"
+#include "../../_COMMON/inc/InstanceBuffer.h"
+#include "../../_COMMON/inc/Mesh.h"
+#include "../../_COMMON/inc/MeshLOD.h"
+#include "../../_COMMON/inc/BVH.h"
+#include "../../_COMMON/inc/Frustum.h"
+#include "../../_COMMON/inc/LooseOctree.h"
+#include "../../_COMMON/inc/FrustumCuller.h"
+#include "../../_COMMON/inc/SimdMath.h"
+#include "../../_COMMON/inc/FrameBenchmark.h"
+#include "../../_COMMON/inc/ShaderPreprocessor.h"
+#include "../../_COMMON/inc/ResourceBundle.h"
+#include "../../_COMMON/inc/ErrorCheck.h"
+#include "../../_COMMON/inc/TextureLoader.h"
+#include "../../_COMMON/inc/CompressedTexture.h"
+#include "../../_COMMON/inc/StateTracker.h"
+#include "../../_COMMON/inc/RenderGraph.h"
+#include "../../_COMMON/inc/ClusteredLighting.h"
+#include "../../_COMMON/inc/ShadowCascades.h"
+#include "../../_COMMON/inc/DynamicResolution.h"
+#include "../../_COMMON/inc/TessellatedTerrain.h"
+#include "../../_COMMON/inc/ParticleSystem.h"
 
 
 // application global variables and constants /////////////////////////////////////////////////////
 GLint PROGRAM_ID = 0;
+bool  USE_SPIRV = false;   // default shaders from the precompiled glsl/*.spv (option: -spirv)
+ResourceBundle* RESOURCES = NULL;   // packed glsl/ and scene/ files (disabled with: -nobundle)
+bool  USE_BUNDLE = true;
+ErrorCheck::LevelT ERROR_CHECKS = ErrorCheck::DEFAULT_LEVEL;   // option: -errors <level> [N]
+unsigned ERROR_SAMPLES = 60;
+bool  STATE_FILTER = true;   // drop redundant state changes (disabled with: -nostatefilter)
 GLint MV_MAT4_LOCATION = 0;
+GLuint VAO = 0;
+glm::mat4 PROJECTION(1.0f);
+Mesh PICK_MESH;   // geometry for double click picking
+BVH  PICK_BVH;
 #define BUFFER_OFFSET( offset )   ((GLvoid*) (offset))
 
 
+// instancing benchmark (enabled with command line option: -instances [count]) ////////////////////
+bool    BENCHMARK_INSTANCING = false;
+GLsizei INSTANCE_COUNT = 1000000;
+InstanceBuffer::InstanceFormatT INSTANCE_FORMAT = InstanceBuffer::IF_MAT3X4;
+InstanceBuffer* INSTANCES = NULL;
+vector<glm::quat> INSTANCE_ROTATIONS;
+vector<glm::quat> INSTANCE_ROTATIONS_FRAME;
+vector<glm::vec4> INSTANCE_TRANSLATIONS;
+vector<glm::vec4> INSTANCE_TRANSLATIONS_FRAME;
+int          INSTANCE_CULLING = 0;   // key 'c': 0 off, 1 scene index, 2 SoA kernel
+LooseOctree  INSTANCE_INDEX;
+FrustumCuller::SphereArrayT INSTANCE_BOUNDS;
+vector<GLuint> INSTANCE_VISIBLE;
+ShaderPreprocessor* INSTANCE_SHADERS = NULL;   // program variants of the default shaders
+bool SEPARABLE_PROGRAMS = false;   // program pipelines of separable stages (option: -separable)
+
+
+// level of detail demo (enabled with command line option: -lod [slices]) /////////////////////////
+bool     DEMO_LOD = false;
+int      LOD_SLICES = 512;
+int      LOD_LEVEL = -1;
+MeshLOD* LOD_MESH = NULL;
+
+
+// frame benchmark (enabled with command line option: -benchmark <scene> [-benchmark_out <file>]) //
+bool    BENCHMARK_FRAMES = false;
+string  BENCHMARK_SCENE;
+string  BENCHMARK_OUT;
+FrameBenchmark* FRAME_BENCHMARK = NULL;
+GLuint  BENCHMARK_VAO = 0;
+GLsizei BENCHMARK_INDEX_COUNT = 0;
+vector<glm::vec3> BENCHMARK_POSITIONS;
+
+
+// texture demo (enabled with command line option: -texture <file|file.cgtc> [gpu|cpu|none]) //////
+bool    DEMO_TEXTURE = false;
+string  TEXTURE_FILE;
+TextureLoader::MipmapT TEXTURE_MIPMAPS = TextureLoader::MIPMAP_GPU;
+TextureLoader* TEXTURES = NULL;
+GLuint  TEXTURE_ID = 0;
+
+
+// render graph demo with bloom post processing (enabled with command line option: -graph) ////////
+bool    DEMO_GRAPH = false;
+RenderGraph* GRAPH = NULL;
+ShaderPreprocessor* GRAPH_SHADERS = NULL;
+GLuint  BLOOM_PROGRAMS[3] = { 0, 0, 0 };   // bright pass, horizontal and vertical blur
+GLuint  PRESENT_PROGRAM = 0;
+glm::mat4 GRAPH_MODELVIEW(1.0f);
+int     GRAPH_BACKBUFFER = -1;   // texture handles of the current frame's graph
+int     GRAPH_SCENE = -1;
+int     GRAPH_BRIGHT = -1;
+int     GRAPH_BLUR_X = -1;
+int     GRAPH_BLUR_Y = -1;
+
+
+// clustered lighting demo (enabled with command line option: -lights [count]) ////////////////////
+bool    DEMO_LIGHTS = false;
+GLsizei LIGHT_COUNT = 1024;
+ClusteredLighting* LIGHTING = NULL;
+ShaderPreprocessor* LIGHT_SHADERS = NULL;
+GLuint  LIGHT_PROGRAM = 0;   // clustered forward shading of the sphere grid
+GLint   LIGHT_MV_LOCATION = 0;
+GLint   LIGHT_PROJECTION_LOCATION = 0;
+GLuint  LIGHT_VAO = 0;
+GLsizei LIGHT_INDEX_COUNT = 0;
+const int LIGHT_GRID = 24;   // spheres per row and column
+vector<ClusteredLighting::LightT> LIGHTS;
+vector<glm::vec4> LIGHT_ORBITS;   // radius, angular speed, phase and height of every light
+
+
+// cascaded shadow maps demo (enabled with command line option: -shadows) /////////////////////////
+bool    DEMO_SHADOWS = false;
+ShadowCascades* SHADOWS = NULL;
+ShaderPreprocessor* SHADOW_SHADERS = NULL;
+bool    SHADOW_LIGHT_ANIMATION = false;   // key 'l': the moving light invalidates every frame
+GLuint  SHADOW_DEPTH_PROGRAM = 0;   // depth only pass of the casters
+GLint   SHADOW_DEPTH_VP_LOCATION = 0;
+GLuint  SHADOW_PROGRAM = 0;         // shading with the shadow cascades
+GLuint  SHADOW_SPHERE_VAO = 0;      // sphere with instance offset and scale
+GLuint  SHADOW_GROUND_VAO = 0;
+GLuint  SHADOW_INSTANCE_VBO = 0;    // stream of the instances of a draw
+GLsizei SHADOW_INDEX_COUNT = 0;
+const int   SHADOW_GRID = 16;       // static spheres per row and column
+const float SHADOW_EXTENT = 45.0f;  // half size of the ground
+vector<glm::vec4> SHADOW_STATIC;    // static casters: center and radius
+vector<glm::vec4> SHADOW_DYNAMIC;   // orbiting casters, moved every frame
+vector<glm::vec4> SHADOW_VISIBLE;   // instances of the current draw
+
+
+// tessellated terrain demo (enabled with command line option: -terrain [patches]) ////////////////
+bool    DEMO_TERRAIN = false;
+int     TERRAIN_PATCHES = 32;   // patches per row and column
+TessellatedTerrain* TERRAIN = NULL;
+ShaderPreprocessor* TERRAIN_SHADERS = NULL;
+bool    TERRAIN_WIREFRAME = true;   // key 'w' switches between wireframe and shaded
+
+
+// GPU particle system demo (enabled with command line option: -particles [capacity] [cpu]) ///////
+bool    DEMO_PARTICLES = false;
+GLsizei PARTICLE_CAPACITY = 1 << 20;
+bool    PARTICLE_CPU = false;   // CPU simulation, the default on software renderers
+ParticleSystem* PARTICLES = NULL;
+ShaderPreprocessor* PARTICLE_SHADERS = NULL;
+
+
+// dynamic resolution (enabled with command line option: -dynres [budget ms]) /////////////////////
+DynamicResolution* DYNAMIC_RESOLUTION = NULL;
+ShaderPreprocessor* DYNAMIC_SHADERS = NULL;
+double  DYNAMIC_BUDGET = 0.0;   // GPU milliseconds of the scene, 0 renders at window size
+
+
+
+GLint getUniformLocation(const char* name, GLint spirvLocation)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// SPIR-V modules carry no names, use the explicit locations of the shaders instead
+	if (UtilGLSL::isSpirvProgram(PROGRAM_ID)) return spirvLocation;
+	return glGetUniformLocation(PROGRAM_ID, name);
+}
+
+
+
+GLint getAttribLocation(const char* name, GLint spirvLocation)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (UtilGLSL::isSpirvProgram(PROGRAM_ID)) return spirvLocation;
+	return glGetAttribLocation(PROGRAM_ID, name);
+}
+
+
+
+void getRenderSize(GLsizei& width, GLsizei& height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// with dynamic resolution the scene is rendered at the scaled size of the target
+	if (DYNAMIC_RESOLUTION)
+	{
+		width = DYNAMIC_RESOLUTION->getWidth();
+		height = DYNAMIC_RESOLUTION->getHeight();
+	}
+	else
+	{
+		width = glutGet(GLUT_WINDOW_WIDTH);
+		height = glutGet(GLUT_WINDOW_HEIGHT);
+	}
+}
+
+
+
+void finishDemoFrame(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// the display callback sets the modelview matrix of the default program
+	StateTracker::useProgram(PROGRAM_ID);
+}
+
+
+
+template<typename DemoT> void finishDemoFrame(DemoT* demo, int reportEvery)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	finishDemoFrame();
+
+	// report the first frame and then every reportEvery frames (one counter per demo type),
+	// animated demos redraw continuously
+	static int frame = 0;
+	if (frame++ % reportEvery == 0) demo->report(cout);
+	glutPostRedisplay();
+}
+
+
+
+void useInstanceProgram(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (USE_SPIRV)
+	{
+		// precompiled module, the instance format is specialization constant 0
+		UtilGLSL::SpecializationT constants;
+		constants.set(0, GLint(INSTANCE_FORMAT));
+
+		vector<string> files;
+		files.push_back("../../glsl/helloglsl_instanced.vert.spv");
+		files.push_back("../../glsl/helloglsl.frag.spv");
+		glDeleteProgram(PROGRAM_ID);
+		PROGRAM_ID = UtilGLSL::initSpirvProgram(files, constants);
+		StateTracker::useProgram(PROGRAM_ID);
+	}
+	else
+	{
+		// specialized variant for the instance format (the other formats are compiled out)
+		ShaderPreprocessor::DefinesT defines;
+		defines["INSTANCE_FORMAT"] = string(1, char('0' + INSTANCE_FORMAT));
+
+		vector<string> files;
+		files.push_back("../../glsl/helloglsl_instanced.vert");
+		files.push_back("../../glsl/helloglsl.frag");
+		if (SEPARABLE_PROGRAMS)
+		{
+			// only the vertex stage depends on the format, the fragment stage is shared
+			GLuint pipeline = INSTANCE_SHADERS->getPipeline(files, defines);
+			PROGRAM_ID = INSTANCE_SHADERS->getStageProgram(GL_VERTEX_SHADER, files[0], defines);
+			StateTracker::useProgram(0);
+			StateTracker::bindProgramPipeline(pipeline);
+			glActiveShaderProgram(pipeline, PROGRAM_ID);   // glUniform*() calls go to the vertex stage
+		}
+		else
+		{
+			PROGRAM_ID = INSTANCE_SHADERS->getProgram(files, defines);
+			StateTracker::useProgram(PROGRAM_ID);
+		}
+
+		const ShaderPreprocessor::StatisticsT& s = INSTANCE_SHADERS->getStatistics();
+		cout << "Shader variants: " << s.sources << " sources, " << s.shaders << " shaders ("
+			<< s.shaderHits << " reused), " << s.programs << " programs, " << s.stages
+			<< " stage programs (" << s.stageHits << " reused), " << s.pipelines << " pipelines"
+			<< endl;
+	}
+
+	glUniformMatrix4fv(getUniformLocation("matProjection", 1), 1, GL_FALSE, glm::value_ptr(PROJECTION));
+	MV_MAT4_LOCATION = getUniformLocation("matModelView", 0);
+}
+
+
+
+void initInstances(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// switch to the program variant of the instance format
+	useInstanceProgram();
+
+	// place the instances on a regular grid covering the orthographic view volume
+	GLsizei columns = GLsizei(ceil(sqrt(double(INSTANCE_COUNT))));
+	float spacing = 20.0f / columns;
+	float scale = 0.08f * spacing;
+
+	INSTANCE_ROTATIONS.resize(INSTANCE_COUNT);
+	INSTANCE_ROTATIONS_FRAME.resize(INSTANCE_COUNT);
+	INSTANCE_TRANSLATIONS.resize(INSTANCE_COUNT);
+	INSTANCE_TRANSLATIONS_FRAME.resize(INSTANCE_COUNT);
+	for (GLsizei i = 0; i < INSTANCE_COUNT; ++i)
+	{
+		float x = -10.0f + spacing * (0.5f + i % columns);
+		float y = -10.0f + spacing * (0.5f + i / columns);
+		float phase = 6.2831853f * float(rand()) / RAND_MAX;
+
+		INSTANCE_ROTATIONS[i] = glm::angleAxis(phase, glm::vec3(0.0f, 0.0f, 1.0f));
+		INSTANCE_TRANSLATIONS[i] = glm::vec4(x, y, 0.0f, scale);
+	}
+
+	// scene index for frustum culling (handles equal instance indices, about 8 instances per leaf)
+	int depth = int(log(INSTANCE_COUNT / 8.0) / log(4.0) + 0.5);
+	INSTANCE_INDEX.init(glm::vec3(0.0f), 10.0f, depth);
+	INSTANCE_BOUNDS.clear();
+	for (GLsizei i = 0; i < INSTANCE_COUNT; ++i)
+	{
+		INSTANCE_INDEX.insert(glm::vec3(INSTANCE_TRANSLATIONS[i]), 5.0f * 1.4142136f * scale);
+		INSTANCE_BOUNDS.add(glm::vec3(INSTANCE_TRANSLATIONS[i]), 5.0f * 1.4142136f * scale);
+	}
+
+	// attach the per-instance attributes to the triangle VAO (locations 1..4)
+	if (INSTANCES == NULL) INSTANCES = new InstanceBuffer();
+	INSTANCES->init(VAO, 1, INSTANCE_COUNT, INSTANCE_FORMAT);
+}
+
+
+
+void drawInstances(const glm::mat4& modelView)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CG_GL_SCOPE("drawInstances");
+
+	static const char* formatNames[] = { "mat4", "mat3x4", "quat+trs" };
+	static GLuint queries[4] = { 0, 0, 0, 0 };
+	static int frame = 0;
+	static double frameTime = 0.0, updateTime = 0.0, gpuTime = 0.0;
+	static int gpuSamples = 0;
+	static chrono::high_resolution_clock::time_point last = chrono::high_resolution_clock::now();
+
+	if (queries[0] == 0) glGenQueries(4, queries);
+
+	// read back GPU time of an older frame without stalling the pipeline
+	GLuint query = queries[frame % 4];
+	if (frame >= 4)
+	{
+		GLint available = 0;
+		glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available)
+		{
+			GLuint64 elapsed = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+			gpuTime += elapsed * 1.0e-6;
+			gpuSamples++;
+		}
+	}
+
+	// spin all (or only the visible) instances and stream their transforms
+	chrono::high_resolution_clock::time_point start = chrono::high_resolution_clock::now();
+	glm::quat spin = glm::angleAxis(0.01f * frame, glm::vec3(0.0f, 0.0f, 1.0f));
+	GLsizei count = INSTANCE_COUNT;
+	if (INSTANCE_CULLING)
+	{
+		Frustum frustum(PROJECTION * modelView);
+		if (INSTANCE_CULLING == 1)
+		{
+			INSTANCE_VISIBLE.clear();
+			INSTANCE_INDEX.queryFrustum(frustum, INSTANCE_VISIBLE);
+			count = GLsizei(INSTANCE_VISIBLE.size());
+		}
+		else
+		{
+			INSTANCE_VISIBLE.resize(INSTANCE_COUNT);
+			count = FrustumCuller::cullSpheres(frustum, INSTANCE_BOUNDS, &INSTANCE_VISIBLE[0]);
+		}
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			INSTANCE_ROTATIONS_FRAME[i] = INSTANCE_ROTATIONS[INSTANCE_VISIBLE[i]];
+			INSTANCE_TRANSLATIONS_FRAME[i] = INSTANCE_TRANSLATIONS[INSTANCE_VISIBLE[i]];
+		}
+		SimdMath::multiply(spin, &INSTANCE_ROTATIONS_FRAME[0], &INSTANCE_ROTATIONS_FRAME[0], count);
+	}
+	else
+	{
+		// (runtime dispatched SSE2/AVX2/AVX-512 quaternion products)
+		SimdMath::multiply(spin, &INSTANCE_ROTATIONS[0], &INSTANCE_ROTATIONS_FRAME[0], count);
+		copy(INSTANCE_TRANSLATIONS.begin(), INSTANCE_TRANSLATIONS.end(), INSTANCE_TRANSLATIONS_FRAME.begin());
+	}
+	INSTANCES->update(&INSTANCE_ROTATIONS_FRAME[0], &INSTANCE_TRANSLATIONS_FRAME[0], count);
+	chrono::high_resolution_clock::time_point end = chrono::high_resolution_clock::now();
+	updateTime += chrono::duration<double, milli>(end - start).count();
+
+	glBeginQuery(GL_TIME_ELAPSED, query);
+	INSTANCES->drawArrays(GL_TRIANGLES, 0, 3);
+	glEndQuery(GL_TIME_ELAPSED);
+
+	frameTime += chrono::duration<double, milli>(end - last).count();
+	last = end;
+
+	if (++frame % 100 == 0)
+	{
+		cout << "Instancing: " << count << "/" << INSTANCE_COUNT << " instances (" << formatNames[INSTANCE_FORMAT]
+			<< ", " << InstanceBuffer::getInstanceSize(INSTANCE_FORMAT) << " bytes)"
+			<< " frame: " << frameTime / 100 << " ms, update: " << updateTime / 100 << " ms"
+			<< ", GPU: " << (gpuSamples ? gpuTime / gpuSamples : 0.0) << " ms" << endl;
+		frameTime = updateTime = gpuTime = 0.0;
+		gpuSamples = 0;
+	}
+
+	glutPostRedisplay();
+}
+
+
+
+void initLOD(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// build the LOD chain of a finely tessellated sphere filling the view
+	PICK_MESH = Mesh::createSphere(8.0f, LOD_SLICES, LOD_SLICES / 2);
+	PICK_BVH.build(PICK_MESH);
+	LOD_MESH = new MeshLOD();
+	LOD_MESH->build(PICK_MESH);
+	LOD_MESH->upload(getAttribLocation("vecPosition", 0));
+
+	// show the triangle density in wireframe mode
+	StateTracker::polygonMode(GL_FRONT_AND_BACK, GL_LINE);
+}
+
+
+
+void drawLOD(const glm::mat4& modelView)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CG_GL_SCOPE("drawLOD");
+
+	// select the coarsest level with sub-pixel error for the current trackball scale
+	GLsizei width, height;
+	getRenderSize(width, height);
+	int level = LOD_MESH->selectLevel(modelView, PROJECTION, float(height));
+
+	if (level != LOD_LEVEL)
+	{
+		const MeshLOD::LevelT& l = LOD_MESH->getLevel(level);
+		cout << "LOD level " << level << ": " << l.indexCount / 3 << " triangles, "
+			<< l.vertexCount << " vertices, error "
+			<< LOD_MESH->getProjectedError(level, modelView, PROJECTION, height) << " pixels" << endl;
+		LOD_LEVEL = level;
+	}
+
+	LOD_MESH->draw(level);
+}
+
+
+
+void initFrameBenchmark(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	FRAME_BENCHMARK = new FrameBenchmark();
+	if (!FRAME_BENCHMARK->loadScene(BENCHMARK_SCENE)) exit(1);
+	const FrameBenchmark::SceneT& scene = FRAME_BENCHMARK->getScene();
+
+	// object mesh: sphere with about the requested triangle count (2 * slices * (stacks - 1))
+	int slices = max(3, int(sqrt(double(scene.triangleCount)) + 0.5));
+	GLsizei columns = GLsizei(ceil(sqrt(double(scene.objectCount))));
+	float spacing = 20.0f / columns;
+	Mesh mesh = Mesh::createSphere(0.4f * spacing, slices, slices / 2 + 1);
+	BENCHMARK_INDEX_COUNT = GLsizei(mesh.indices.size());
+
+	// place the objects on a regular grid covering the orthographic view volume
+	BENCHMARK_POSITIONS.resize(scene.objectCount);
+	for (GLsizei i = 0; i < scene.objectCount; ++i)
+	{
+		BENCHMARK_POSITIONS[i] = glm::vec3(-10.0f + spacing * (0.5f + i % columns),
+			-10.0f + spacing * (0.5f + i / columns), 0.0f);
+	}
+
+	// setup Vertex Array Object with vertex and index buffer
+	GLuint buffers[2];
+	glGenVertexArrays(1, &BENCHMARK_VAO);
+	StateTracker::bindVertexArray(BENCHMARK_VAO);
+	glGenBuffers(2, buffers);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, mesh.positions.size() * sizeof(glm::vec3), &mesh.positions[0], GL_STATIC_DRAW);
+	StateTracker::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(GLuint), &mesh.indices[0], GL_STATIC_DRAW);
+
+	GLuint vecPosition = getAttribLocation("vecPosition", 0);
+	glVertexAttribPointer(vecPosition, 3, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glEnableVertexAttribArray(vecPosition);
+}
+
+
+
+void drawFrameBenchmark(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// report and quit after the last measured frame
+	if (!FRAME_BENCHMARK->beginFrame())
+	{
+		FRAME_BENCHMARK->report(cout);
+		StateTracker::report(cout);
+		if (!BENCHMARK_OUT.empty()) FRAME_BENCHMARK->writeJSON(BENCHMARK_OUT);
+		exit(0);
+	}
+
+	glClear(GL_COLOR_BUFFER_BIT);
+
+	// one draw call per object along the scripted camera path (trackball input is ignored),
+	// every object sets its complete state like a scene graph traversal would
+	glm::mat4 view = FRAME_BENCHMARK->getCameraTransformation();
+	for (size_t i = 0; i < BENCHMARK_POSITIONS.size(); ++i)
+	{
+		StateTracker::useProgram(PROGRAM_ID);
+		StateTracker::bindVertexArray(BENCHMARK_VAO);
+		StateTracker::polygonMode(GL_FRONT, GL_FILL);
+		StateTracker::polygonMode(GL_BACK, GL_LINE);
+		StateTracker::disable(GL_BLEND);
+		StateTracker::disable(GL_DEPTH_TEST);
+		glm::mat4 modelView = glm::translate(view, BENCHMARK_POSITIONS[i]);
+		glUniformMatrix4fv(MV_MAT4_LOCATION, 1, GL_FALSE, glm::value_ptr(modelView));
+		glDrawElements(GL_TRIANGLES, BENCHMARK_INDEX_COUNT, GL_UNSIGNED_INT, BUFFER_OFFSET(0));
+		CG_GL_CHECK("benchmark draw");
+	}
+	FRAME_BENCHMARK->addDrawCalls(GLsizei(BENCHMARK_POSITIONS.size()),
+		GLsizei(BENCHMARK_POSITIONS.size()) * (BENCHMARK_INDEX_COUNT / 3));
+	FRAME_BENCHMARK->endFrame();
+
+	glutSwapBuffers();
+	CG_GL_CHECK("drawFrameBenchmark");
+	glutPostRedisplay();
+}
+
+
+
+void initTexture(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// block compressed containers of CG-BCN are uploaded at once from the mapped file
+	string extension = TEXTURE_FILE.substr(min(TEXTURE_FILE.size(), TEXTURE_FILE.rfind('.') + 1));
+	if (extension == "cgtc") TEXTURE_ID = CompressedTexture::load(TEXTURE_FILE);
+	else
+	{
+		// decode on the worker threads, the triangle stays black until the upload is complete
+		TEXTURES = new TextureLoader();
+		TEXTURES->init();
+		TEXTURE_ID = TEXTURES->load(TEXTURE_FILE, TEXTURE_MIPMAPS);
+	}
+	glUniform1i(glGetUniformLocation(PROGRAM_ID, "texImage"), 0);
+}
+
+
+
+void drawTexture(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CG_GL_SCOPE("drawTexture");
+
+	// upload a few MB of decoded rows per frame, never waits for the decoder or the transfer
+	if (TEXTURES && !TEXTURES->isReady(TEXTURE_ID))
+	{
+		TEXTURES->update();
+		if (TEXTURES->isReady(TEXTURE_ID)) TEXTURES->report(cout);
+		else glutPostRedisplay();
+	}
+
+	StateTracker::activeTexture(GL_TEXTURE0);
+	StateTracker::bindTexture(GL_TEXTURE_2D, TEXTURE_ID);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+
+
+void initGraph(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!GLEW_VERSION_4_3)
+	{
+		cout << "Render graph demo requires OpenGL 4.3 (compute shaders) - exiting!" << endl;
+		exit(1);
+	}
+	GRAPH = new RenderGraph();
+
+	// the three bloom passes are variants of one compute shader
+	GRAPH_SHADERS = new ShaderPreprocessor();
+	vector<string> files(1, "../../glsl/helloglsl_bloom.comp");
+	for (int i = 0; i < 3; ++i)
+	{
+		ShaderPreprocessor::DefinesT defines;
+		defines["PASS"] = string(1, char('0' + i));
+		BLOOM_PROGRAMS[i] = GRAPH_SHADERS->getProgram(files, defines);
+	}
+
+	files[0] = "../../glsl/helloglsl_fullscreen.vert";
+	files.push_back("../../glsl/helloglsl_present.frag");
+	PRESENT_PROGRAM = GRAPH_SHADERS->getProgram(files);
+	glProgramUniform1i(PRESENT_PROGRAM, glGetUniformLocation(PRESENT_PROGRAM, "texScene"), 0);
+	glProgramUniform1i(PRESENT_PROGRAM, glGetUniformLocation(PRESENT_PROGRAM, "texBloom"), 1);
+}
+
+
+
+void passScene(const RenderGraph& /*graph*/)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StateTracker::useProgram(PROGRAM_ID);
+	glUniformMatrix4fv(MV_MAT4_LOCATION, 1, GL_FALSE, glm::value_ptr(GRAPH_MODELVIEW));
+	StateTracker::bindVertexArray(VAO);
+	glClear(GL_COLOR_BUFFER_BIT);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+
+
+void passWireframe(const RenderGraph& graph)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// debug view of the triangle edges, culled as long as no pass reads its texture
+	StateTracker::polygonMode(GL_FRONT_AND_BACK, GL_LINE);
+	passScene(graph);
+	StateTracker::polygonMode(GL_FRONT, GL_FILL);
+	StateTracker::polygonMode(GL_BACK, GL_LINE);
+}
+
+
+
+void dispatchBloom(const RenderGraph& graph, int pass, int source, int target)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const RenderGraph::TextureDescT& desc = graph.getDesc(target);
+	StateTracker::useProgram(BLOOM_PROGRAMS[pass]);
+	StateTracker::activeTexture(GL_TEXTURE0);
+	StateTracker::bindTexture(GL_TEXTURE_2D, graph.getTexture(source));
+	glBindImageTexture(0, graph.getTexture(target), 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+	glDispatchCompute((desc.width + 7) / 8, (desc.height + 7) / 8, 1);
+}
+
+
+
+void passBright(const RenderGraph& graph) { dispatchBloom(graph, 0, GRAPH_SCENE, GRAPH_BRIGHT); }
+void passBlurX(const RenderGraph& graph) { dispatchBloom(graph, 1, GRAPH_BRIGHT, GRAPH_BLUR_X); }
+void passBlurY(const RenderGraph& graph) { dispatchBloom(graph, 2, GRAPH_BLUR_X, GRAPH_BLUR_Y); }
+
+
+
+void passPresent(const RenderGraph& graph)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StateTracker::useProgram(PRESENT_PROGRAM);
+	StateTracker::activeTexture(GL_TEXTURE1);
+	StateTracker::bindTexture(GL_TEXTURE_2D, graph.getTexture(GRAPH_BLUR_Y));
+	StateTracker::activeTexture(GL_TEXTURE0);
+	StateTracker::bindTexture(GL_TEXTURE_2D, graph.getTexture(GRAPH_SCENE));
+	StateTracker::bindVertexArray(VAO);   // attributeless fullscreen triangle
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+
+
+void passHUD(const RenderGraph& graph)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// bar at the bottom: transient memory with aliasing, full width is without aliasing
+	const RenderGraph::StatisticsT& statistics = graph.getStatistics();
+	GLsizei width = GLsizei(graph.getDesc(GRAPH_BACKBUFFER).width * statistics.peakBytes /
+		max(size_t(1), statistics.unaliasedBytes));
+	StateTracker::enable(GL_SCISSOR_TEST);
+	glScissor(0, 0, width, 8);
+	StateTracker::clearColor(0.0f, 0.8f, 0.0f, 1.0f);
+	glClear(GL_COLOR_BUFFER_BIT);
+	StateTracker::clearColor(0.0f, 0.0f, 0.4f, 0.0f);
+	StateTracker::disable(GL_SCISSOR_TEST);
+}
+
+
+
+void drawGraph(const glm::mat4& modelView)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GRAPH_MODELVIEW = modelView;
+	GLsizei width = glutGet(GLUT_WINDOW_WIDTH), height = glutGet(GLUT_WINDOW_HEIGHT);
+	RenderGraph::TextureDescT full = { width, height, GL_RGBA8 };
+	RenderGraph::TextureDescT half = { max(1, width / 2), max(1, height / 2), GL_RGBA8 };
+
+	// declared out of order on purpose, the graph runs the bloom passes before present
+	GRAPH->reset();
+	GRAPH_BACKBUFFER = GRAPH->importTexture("backbuffer", 0, full);
+	GRAPH_SCENE = GRAPH->createTexture("scene", full);
+	GRAPH_BRIGHT = GRAPH->createTexture("bright", half);
+	GRAPH_BLUR_X = GRAPH->createTexture("blur x", half);
+	GRAPH_BLUR_Y = GRAPH->createTexture("blur y", half);
+	int wireframe = GRAPH->createTexture("wireframe", full);
+
+	int pass = GRAPH->addPass("scene", passScene);
+	GRAPH->write(pass, GRAPH_SCENE);
+	pass = GRAPH->addPass("present", passPresent);
+	GRAPH->read(pass, GRAPH_SCENE);
+	GRAPH->read(pass, GRAPH_BLUR_Y);
+	GRAPH->write(pass, GRAPH_BACKBUFFER);
+	pass = GRAPH->addPass("bright", passBright);
+	GRAPH->read(pass, GRAPH_SCENE);
+	GRAPH->write(pass, GRAPH_BRIGHT, RenderGraph::USAGE_IMAGE);
+	pass = GRAPH->addPass("blur x", passBlurX);
+	GRAPH->read(pass, GRAPH_BRIGHT);
+	GRAPH->write(pass, GRAPH_BLUR_X, RenderGraph::USAGE_IMAGE);
+	pass = GRAPH->addPass("blur y", passBlurY);
+	GRAPH->read(pass, GRAPH_BLUR_X);
+	GRAPH->write(pass, GRAPH_BLUR_Y, RenderGraph::USAGE_IMAGE);
+	pass = GRAPH->addPass("wireframe", passWireframe);
+	GRAPH->write(pass, wireframe);
+	pass = GRAPH->addPass("hud", passHUD);
+	GRAPH->write(pass, GRAPH_BACKBUFFER);
+
+	if (GRAPH->compile()) GRAPH->execute();
+	finishDemoFrame();
+
+	// report the first frame and every change of the transient memory (window resized)
+	static size_t reportedBytes = 0;
+	if (GRAPH->getStatistics().peakBytes != reportedBytes)
+	{
+		GRAPH->report(cout);
+		reportedBytes = GRAPH->getStatistics().peakBytes;
+	}
+}
+
+
+
+void initLights(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!GLEW_VERSION_4_3)
+	{
+		cout << "Clustered lighting demo requires OpenGL 4.3 (compute shaders) - exiting!" << endl;
+		exit(1);
+	}
+
+	LIGHT_SHADERS = new ShaderPreprocessor();
+	vector<string> files(1, "../../glsl/helloglsl_clusters.comp");
+	GLuint assignProgram = LIGHT_SHADERS->getProgram(files);
+	files[0] = "../../glsl/helloglsl_clustered.vert";
+	files.push_back("../../glsl/helloglsl_clustered.frag");
+	LIGHT_PROGRAM = LIGHT_SHADERS->getProgram(files);
+	LIGHT_MV_LOCATION = glGetUniformLocation(LIGHT_PROGRAM, "matModelView");
+	LIGHT_PROJECTION_LOCATION = glGetUniformLocation(LIGHT_PROGRAM, "matProjection");
+	glProgramUniform2f(LIGHT_PROGRAM, glGetUniformLocation(LIGHT_PROGRAM, "instanceGrid"),
+		GLfloat(LIGHT_GRID), 3.0f);
+
+	// 16x16 tiles and 24 depth slices, on average 32 lights per cluster fit into the index list
+	LIGHTING = new ClusteredLighting();
+	if (!LIGHTING->init(16, 16, 24, 16 * 16 * 24 * 32, assignProgram)) exit(1);
+
+	// sphere instanced on the grid
+	Mesh mesh = Mesh::createSphere(1.0f, 24, 12);
+	LIGHT_INDEX_COUNT = GLsizei(mesh.indices.size());
+	GLuint buffers[2];
+	glGenVertexArrays(1, &LIGHT_VAO);
+	StateTracker::bindVertexArray(LIGHT_VAO);
+	glGenBuffers(2, buffers);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, mesh.positions.size() * sizeof(glm::vec3), &mesh.positions[0],
+		GL_STATIC_DRAW);
+	StateTracker::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(GLuint), &mesh.indices[0],
+		GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glEnableVertexAttribArray(0);
+
+	// colored lights circling just above the spheres, every fourth one a spot pointing down
+	srand(1);
+	LIGHTS.resize(LIGHT_COUNT);
+	LIGHT_ORBITS.resize(LIGHT_COUNT);
+	float extent = 1.5f * LIGHT_GRID;
+	for (GLsizei i = 0; i < LIGHT_COUNT; ++i)
+	{
+		float random[6];
+		for (int k = 0; k < 6; ++k) random[k] = float(rand()) / RAND_MAX;
+		LIGHT_ORBITS[i] = glm::vec4(extent * sqrt(random[0]), (random[1] - 0.5f) * 0.5f,
+			6.2831853f * random[2], 1.5f + 2.0f * random[3]);
+
+		ClusteredLighting::LightT& light = LIGHTS[i];
+		light.position = glm::vec4(0.0f, 0.0f, 0.0f, 3.0f + 3.0f * random[4]);
+		glm::vec3 hue = glm::mod(glm::vec3(0.0f, 4.0f, 2.0f) + 6.0f * random[5], 6.0f);
+		glm::vec3 color = glm::clamp(glm::abs(hue - 3.0f) - 1.0f, 0.0f, 1.0f);
+		light.color = glm::vec4(8.0f * color, (i % 4 == 0) ? cos(0.6f) : -1.0f);
+		light.direction = glm::vec4(0.0f, -1.0f, 0.0f, 0.0f);
+	}
+
+	cout << "Clustered lighting: " << LIGHT_COUNT << " lights, " << LIGHT_GRID * LIGHT_GRID
+		<< " spheres (key 'g' switches between GPU and CPU light assignment)" << endl;
+}
+
+
+
+void drawLights(const glm::mat4& view)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CG_GL_SCOPE("drawLights");
+
+	// move the lights along their orbits
+	static chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	float time = chrono::duration<float>(chrono::steady_clock::now() - start).count();
+	for (size_t i = 0; i < LIGHTS.size(); ++i)
+	{
+		const glm::vec4& orbit = LIGHT_ORBITS[i];
+		float angle = orbit.z + orbit.y * time;
+		LIGHTS[i].position = glm::vec4(orbit.x * cos(angle), orbit.w, orbit.x * sin(angle),
+			LIGHTS[i].position.w);
+	}
+
+	// perspective camera looking down on the grid, the trackball rotates the scene
+	GLsizei width, height;
+	getRenderSize(width, height);
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), float(width) / max(1, height),
+		1.0f, 150.0f);
+	glm::mat4 modelView = glm::lookAt(glm::vec3(0.0f, 25.0f, 45.0f), glm::vec3(0.0f),
+		glm::vec3(0.0f, 1.0f, 0.0f)) * view;
+	LIGHTING->update(projection, modelView, width, height, LIGHTS);
+
+	StateTracker::useProgram(LIGHT_PROGRAM);
+	glUniformMatrix4fv(LIGHT_MV_LOCATION, 1, GL_FALSE, glm::value_ptr(modelView));
+	glUniformMatrix4fv(LIGHT_PROJECTION_LOCATION, 1, GL_FALSE, glm::value_ptr(projection));
+	LIGHTING->bind();
+	StateTracker::enable(GL_DEPTH_TEST);
+	glClear(GL_DEPTH_BUFFER_BIT);
+	StateTracker::bindVertexArray(LIGHT_VAO);
+	glDrawElementsInstanced(GL_TRIANGLES, LIGHT_INDEX_COUNT, GL_UNSIGNED_INT, BUFFER_OFFSET(0),
+		LIGHT_GRID * LIGHT_GRID);
+	StateTracker::disable(GL_DEPTH_TEST);
+
+	// the report reads the GPU lists back, so only every few seconds
+	finishDemoFrame(LIGHTING, 300);
+}
+
+
+
+void drawShadowSpheres(const vector<glm::vec4>& spheres)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (spheres.empty()) return;
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, SHADOW_INSTANCE_VBO);
+	glBufferData(GL_ARRAY_BUFFER, spheres.size() * sizeof(glm::vec4), &spheres[0],
+		GL_STREAM_DRAW);
+	StateTracker::bindVertexArray(SHADOW_SPHERE_VAO);
+	glDrawElementsInstanced(GL_TRIANGLES, SHADOW_INDEX_COUNT, GL_UNSIGNED_INT, BUFFER_OFFSET(0),
+		GLsizei(spheres.size()));
+}
+
+
+
+void drawShadowCasters(const glm::mat4& viewProjection, const Frustum& region,
+	bool dynamicCasters)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// only the casters inside the (partial) region of the shadow map
+	const vector<glm::vec4>& casters = dynamicCasters ? SHADOW_DYNAMIC : SHADOW_STATIC;
+	SHADOW_VISIBLE.clear();
+	for (size_t i = 0; i < casters.size(); ++i)
+	{
+		if (region.testSphere(glm::vec3(casters[i]), casters[i].w))
+		{
+			SHADOW_VISIBLE.push_back(casters[i]);
+		}
+	}
+
+	StateTracker::useProgram(SHADOW_DEPTH_PROGRAM);
+	glUniformMatrix4fv(SHADOW_DEPTH_VP_LOCATION, 1, GL_FALSE, glm::value_ptr(viewProjection));
+	drawShadowSpheres(SHADOW_VISIBLE);
+}
+
+
+
+void initShadows(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!GLEW_VERSION_4_3)
+	{
+		cout << "Shadow cascades demo requires OpenGL 4.3 (image copies) - exiting!" << endl;
+		exit(1);
+	}
+
+	SHADOW_SHADERS = new ShaderPreprocessor();
+	vector<string> files(1, "../../glsl/helloglsl_shadow.vert");
+	SHADOW_DEPTH_PROGRAM = SHADOW_SHADERS->getProgram(files);
+	SHADOW_DEPTH_VP_LOCATION = glGetUniformLocation(SHADOW_DEPTH_PROGRAM, "matViewProjection");
+	files[0] = "../../glsl/helloglsl_shadowed.vert";
+	files.push_back("../../glsl/helloglsl_shadowed.frag");
+	SHADOW_PROGRAM = SHADOW_SHADERS->getProgram(files);
+
+	SHADOWS = new ShadowCascades();
+	if (!SHADOWS->init(4, 1024)) exit(1);
+	SHADOWS->setCasterBounds(glm::vec3(-SHADOW_EXTENT, 0.0f, -SHADOW_EXTENT),
+		glm::vec3(SHADOW_EXTENT, 8.0f, SHADOW_EXTENT));
+
+	// unit sphere, its positions are its normals
+	Mesh mesh = Mesh::createSphere(1.0f, 24, 12);
+	SHADOW_INDEX_COUNT = GLsizei(mesh.indices.size());
+	GLuint buffers[3];
+	glGenBuffers(3, buffers);
+	SHADOW_INSTANCE_VBO = buffers[2];
+	glGenVertexArrays(1, &SHADOW_SPHERE_VAO);
+	StateTracker::bindVertexArray(SHADOW_SPHERE_VAO);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, mesh.positions.size() * sizeof(glm::vec3), &mesh.positions[0],
+		GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glEnableVertexAttribArray(2);
+	StateTracker::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(GLuint), &mesh.indices[0],
+		GL_STATIC_DRAW);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, SHADOW_INSTANCE_VBO);
+	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glVertexAttribDivisor(1, 1);
+	glEnableVertexAttribArray(1);
+
+	// ground quad, receiver only (instance and normal are constant attributes)
+	GLfloat ground[] =
+	{
+		-SHADOW_EXTENT, 0.0f,  SHADOW_EXTENT,   SHADOW_EXTENT, 0.0f,  SHADOW_EXTENT,
+		-SHADOW_EXTENT, 0.0f, -SHADOW_EXTENT,   SHADOW_EXTENT, 0.0f, -SHADOW_EXTENT
+	};
+	GLuint vbo;
+	glGenBuffers(1, &vbo);
+	glGenVertexArrays(1, &SHADOW_GROUND_VAO);
+	StateTracker::bindVertexArray(SHADOW_GROUND_VAO);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(ground), ground, GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glEnableVertexAttribArray(0);
+
+	// static spheres of varying size on a grid, a few dynamic ones circling between them
+	srand(2);
+	float spacing = 2.0f * (SHADOW_EXTENT - 5.0f) / (SHADOW_GRID - 1);
+	for (int z = 0; z < SHADOW_GRID; ++z)
+	{
+		for (int x = 0; x < SHADOW_GRID; ++x)
+		{
+			float radius = 0.8f + 1.2f * float(rand()) / RAND_MAX;
+			SHADOW_STATIC.push_back(glm::vec4(x * spacing + 5.0f - SHADOW_EXTENT, radius,
+				z * spacing + 5.0f - SHADOW_EXTENT, radius));
+		}
+	}
+	SHADOW_DYNAMIC.resize(6);
+
+	cout << "Shadow cascades: " << SHADOW_STATIC.size() << " static and "
+		<< SHADOW_DYNAMIC.size() << " dynamic casters (key 'k' toggles the static caster cache, "
+		<< "key 'l' the light animation)" << endl;
+}
+
+
+
+void drawShadows(const glm::mat4& view)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CG_GL_SCOPE("drawShadows");
+
+	static chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	float time = chrono::duration<float>(chrono::steady_clock::now() - start).count();
+	for (size_t i = 0; i < SHADOW_DYNAMIC.size(); ++i)
+	{
+		float radius = 8.0f + 5.0f * i, angle = (0.6f - 0.08f * i) * time + i;
+		SHADOW_DYNAMIC[i] = glm::vec4(radius * cos(angle), 5.0f + (i % 3), radius * sin(angle),
+			1.5f);
+	}
+	// a changed light direction invalidates all cascades
+	glm::vec3 direction(-1.0f, -2.0f, -0.5f);
+	if (SHADOW_LIGHT_ANIMATION) direction = glm::vec3(cos(0.2f * time), -2.0f, sin(0.2f * time));
+	direction = glm::normalize(direction);
+	SHADOWS->setLightDirection(direction);
+
+	// perspective camera looking down on the scene, the trackball rotates the scene and
+	// therefore scrolls the cascades
+	GLsizei width, height;
+	getRenderSize(width, height);
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), float(width) / max(1, height),
+		0.5f, 120.0f);
+	glm::mat4 camera = glm::lookAt(glm::vec3(0.0f, 20.0f, 40.0f), glm::vec3(0.0f),
+		glm::vec3(0.0f, 1.0f, 0.0f)) * view;
+	SHADOWS->update(projection, camera, drawShadowCasters);
+	glViewport(0, 0, width, height);
+
+	// shading pass with all casters and the ground
+	glm::mat4 matrices[ShadowCascades::MAX_CASCADES];
+	glm::vec4 splits(0.0f);
+	for (int c = 0; c < SHADOWS->getCascadeCount(); ++c)
+	{
+		matrices[c] = SHADOWS->getMatrix(c);
+		splits[c] = SHADOWS->getSplit(c);
+	}
+	StateTracker::useProgram(SHADOW_PROGRAM);
+	glUniformMatrix4fv(glGetUniformLocation(SHADOW_PROGRAM, "matView"), 1, GL_FALSE,
+		glm::value_ptr(camera));
+	glUniformMatrix4fv(glGetUniformLocation(SHADOW_PROGRAM, "matProjection"), 1, GL_FALSE,
+		glm::value_ptr(projection));
+	glUniformMatrix4fv(glGetUniformLocation(SHADOW_PROGRAM, "shadowMatrices"),
+		ShadowCascades::MAX_CASCADES, GL_FALSE, glm::value_ptr(matrices[0]));
+	glUniform4fv(glGetUniformLocation(SHADOW_PROGRAM, "shadowSplits"), 1,
+		glm::value_ptr(splits));
+	glUniform3fv(glGetUniformLocation(SHADOW_PROGRAM, "lightDirection"), 1,
+		glm::value_ptr(direction));
+	glUniform1i(glGetUniformLocation(SHADOW_PROGRAM, "shadowCascades"),
+		SHADOWS->getCascadeCount());
+	SHADOWS->bind(0);
+
+	StateTracker::enable(GL_DEPTH_TEST);
+	glClear(GL_DEPTH_BUFFER_BIT);
+	StateTracker::bindVertexArray(SHADOW_GROUND_VAO);
+	glVertexAttrib4f(1, 0.0f, 0.0f, 0.0f, 1.0f);
+	glVertexAttrib3f(2, 0.0f, 1.0f, 0.0f);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	SHADOW_VISIBLE = SHADOW_STATIC;
+	SHADOW_VISIBLE.insert(SHADOW_VISIBLE.end(), SHADOW_DYNAMIC.begin(), SHADOW_DYNAMIC.end());
+	drawShadowSpheres(SHADOW_VISIBLE);
+	StateTracker::disable(GL_DEPTH_TEST);
+
+	finishDemoFrame(SHADOWS, 120);
+}
+
+
+
+void initTerrain(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	TERRAIN_SHADERS = new ShaderPreprocessor();
+	vector<string> files;
+	files.push_back("../../glsl/helloglsl_terrain.vert");
+	files.push_back("../../glsl/helloglsl_terrain.tecs");
+	files.push_back("../../glsl/helloglsl_terrain.tess");
+	files.push_back("../../glsl/helloglsl_terrain.frag");
+
+	// 80 x 80 units with hills up to 8 units
+	TERRAIN = new TessellatedTerrain();
+	if (!TERRAIN->init(TERRAIN_SHADERS->getProgram(files), TERRAIN_PATCHES, 40.0f, 8.0f))
+	{
+		exit(1);
+	}
+
+	cout << "Tessellated terrain: " << TERRAIN_PATCHES * TERRAIN_PATCHES << " patches (key 'p' "
+		<< "toggles patch culling, 'w' wireframe, '+'/'-' change the pixels per edge)" << endl;
+}
+
+
+
+void drawTerrain(const glm::mat4& view)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CG_GL_SCOPE("drawTerrain");
+
+	// perspective camera above the terrain, zooming in with the trackball raises the levels of
+	// the close patches and moves the others out of the frustum
+	GLsizei width, height;
+	getRenderSize(width, height);
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), float(width) / max(1, height),
+		0.5f, 200.0f);
+	glm::mat4 modelView = glm::lookAt(glm::vec3(0.0f, 25.0f, 45.0f), glm::vec3(0.0f),
+		glm::vec3(0.0f, 1.0f, 0.0f)) * view;
+
+	StateTracker::enable(GL_DEPTH_TEST);
+	glClear(GL_DEPTH_BUFFER_BIT);
+	if (TERRAIN_WIREFRAME) StateTracker::polygonMode(GL_FRONT_AND_BACK, GL_LINE);
+	TERRAIN->draw(projection, modelView, width, height);
+	StateTracker::polygonMode(GL_FRONT_AND_BACK, GL_FILL);
+	StateTracker::disable(GL_DEPTH_TEST);
+
+	finishDemoFrame(TERRAIN, 120);
+}
+
+
+
+void initParticles(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!GLEW_VERSION_4_3)
+	{
+		cout << "GPU particle system demo requires OpenGL 4.3 (compute shaders) - exiting!"
+			<< endl;
+		exit(1);
+	}
+
+	// the compute passes run far slower than the SIMD simulation on the software rasterizer
+	const GLubyte* renderer = glGetString(GL_RENDERER);
+	if (renderer && (string((const char*) renderer).find("llvmpipe") != string::npos))
+	{
+		PARTICLE_CPU = true;
+	}
+
+	PARTICLE_SHADERS = new ShaderPreprocessor();
+	ParticleSystem::ProgramsT programs;
+	vector<string> files(1, "../../glsl/helloglsl_particles.comp");
+	ShaderPreprocessor::DefinesT defines;
+	defines["PARTICLE_PASS"] = "0";
+	programs.prepare = PARTICLE_SHADERS->getProgram(files, defines);
+	defines["PARTICLE_PASS"] = "1";
+	programs.update = PARTICLE_SHADERS->getProgram(files, defines);
+	defines["PARTICLE_PASS"] = "2";
+	programs.sortSetup = PARTICLE_SHADERS->getProgram(files, defines);
+	files[0] = "../../glsl/helloglsl_radixsort.comp";
+	defines.clear();
+	defines["RADIX_PASS"] = "0";
+	programs.histogram = PARTICLE_SHADERS->getProgram(files, defines);
+	defines["RADIX_PASS"] = "1";
+	programs.scan = PARTICLE_SHADERS->getProgram(files, defines);
+	defines["RADIX_PASS"] = "2";
+	programs.scatter = PARTICLE_SHADERS->getProgram(files, defines);
+	files[0] = "../../glsl/helloglsl_particles.vert";
+	files.push_back("../../glsl/helloglsl_particles.frag");
+	programs.render = PARTICLE_SHADERS->getProgram(files);
+
+	PARTICLES = new ParticleSystem();
+	if (!PARTICLES->init(PARTICLE_CAPACITY, programs)) exit(1);
+	if (PARTICLE_CPU) PARTICLES->setMode(ParticleSystem::MODE_CPU);
+
+	// particles live 0.75 of the maximum lifetime on average, the fountain fills 90 percent
+	ParticleSystem::ParametersT parameters = PARTICLES->getParameters();
+	parameters.rate = 0.9f * PARTICLE_CAPACITY / (0.75f * parameters.lifetime);
+	PARTICLES->setParameters(parameters);
+
+	cout << "GPU particle system: " << PARTICLE_CAPACITY << " particles, "
+		<< ((PARTICLES->getMode() == ParticleSystem::MODE_GPU) ? "GPU" : "CPU")
+		<< " simulation (key 'g' switches GPU and CPU, 's' toggles the depth sort)" << endl;
+}
+
+
+
+void drawParticles(const glm::mat4& view)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CG_GL_SCOPE("drawParticles");
+
+	// real time steps, limited while the window is dragged or the frame rate collapses
+	static chrono::steady_clock::time_point last = chrono::steady_clock::now();
+	chrono::steady_clock::time_point now = chrono::steady_clock::now();
+	float deltaTime = min(chrono::duration<float>(now - last).count(), 0.05f);
+	last = now;
+
+	// perspective camera in front of the fountain, the particles are sorted for its position
+	GLsizei width, height;
+	getRenderSize(width, height);
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), float(width) / max(1, height),
+		0.1f, 100.0f);
+	glm::mat4 modelView = glm::lookAt(glm::vec3(0.0f, 2.5f, 6.0f), glm::vec3(0.0f, 1.0f, 0.0f),
+		glm::vec3(0.0f, 1.0f, 0.0f)) * view;
+	PARTICLES->update(deltaTime, glm::vec3(glm::inverse(modelView)[3]));
+
+	StateTracker::enable(GL_DEPTH_TEST);
+	glClear(GL_DEPTH_BUFFER_BIT);
+	PARTICLES->draw(projection, modelView, height);
+	StateTracker::disable(GL_DEPTH_TEST);
+
+	finishDemoFrame(PARTICLES, 120);
+}
+
+
+
+void initDynamicResolution(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// the render graph presents into the default framebuffer and the frame benchmark measures
+	// fixed resolution frames
+	if (DEMO_GRAPH || BENCHMARK_FRAMES)
+	{
+		cout << "Dynamic resolution is not available with -graph and -benchmark" << endl;
+		return;
+	}
+
+	DYNAMIC_SHADERS = new ShaderPreprocessor();
+	vector<string> files;
+	files.push_back("../../glsl/helloglsl_fullscreen.vert");
+	files.push_back("../../glsl/helloglsl_upscale.frag");
+
+	DYNAMIC_RESOLUTION = new DynamicResolution();
+	if (!DYNAMIC_RESOLUTION->init(DYNAMIC_SHADERS->getProgram(files))) exit(1);
+	DYNAMIC_RESOLUTION->setBudget(DYNAMIC_BUDGET);
+	DYNAMIC_RESOLUTION->setScaleRange(0.25f, 1.0f);
+	cout << "Dynamic resolution: " << DYNAMIC_BUDGET << " ms scene budget" << endl;
+}
+
+
 
 void glutDisplayCB(void)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
+	ErrorCheck::beginFrame();
+	StateTracker::beginFrame();
+
+	// scripted frame benchmark renders its own scene
+	if (BENCHMARK_FRAMES)
+	{
+		drawFrameBenchmark();
+		return;
+	}
+
+	// render the scene into the dynamic resolution target
+	if (DYNAMIC_RESOLUTION)
+	{
+		DYNAMIC_RESOLUTION->begin(glutGet(GLUT_WINDOW_WIDTH), glutGet(GLUT_WINDOW_HEIGHT));
+	}
+
 	// clear window background
 	glClear(GL_COLOR_BUFFER_BIT);
 
@@ -48,11 +1219,55 @@ void glutDisplayCB(void)
 	// set model view transformation matrix
 	glUniformMatrix4fv(MV_MAT4_LOCATION, 1, GL_FALSE, glm::value_ptr(model));
 
-	// draw triangle around origin
-	glDrawArrays(GL_TRIANGLES, 0, 3);
+	// draw triangle around origin (or all benchmark instances, the LOD sphere, the texture, the
+	// render graph, the clustered lighting, the shadow cascades scene, the terrain or the
+	// particles)
+	if (BENCHMARK_INSTANCING)
+	{
+		drawInstances(model);
+	}
+	else if (DEMO_LOD)
+	{
+		drawLOD(model);
+	}
+	else if (DEMO_TEXTURE)
+	{
+		drawTexture();
+	}
+	else if (DEMO_GRAPH)
+	{
+		drawGraph(model);
+	}
+	else if (DEMO_LIGHTS)
+	{
+		drawLights(model);
+	}
+	else if (DEMO_SHADOWS)
+	{
+		drawShadows(model);
+	}
+	else if (DEMO_TERRAIN)
+	{
+		drawTerrain(model);
+	}
+	else if (DEMO_PARTICLES)
+	{
+		drawParticles(model);
+	}
+	else
+	{
+		glDrawArrays(GL_TRIANGLES, 0, 3);
+	}
+
+	// upscale to the window, redraw continuously so the controller gets measurements
+	if (DYNAMIC_RESOLUTION)
+	{
+		DYNAMIC_RESOLUTION->end();
+		finishDemoFrame(DYNAMIC_RESOLUTION, 120);
+	}
 
 	glutSwapBuffers();
-	UtilGLSL::checkOpenGLErrorCode();
+	CG_GL_CHECK("glutDisplayCB");
 }
 
 
@@ -70,21 +1285,50 @@ void initModel(void)
 	};
 
 	// setup and bind Vertex Array Object for triangle
-	GLuint vao;
-	glGenVertexArrays(1, &vao);
-	glBindVertexArray(vao);
+	glGenVertexArrays(1, &VAO);
+	StateTracker::bindVertexArray(VAO);
 
 	// setup Vertex Buffer Object
 	GLuint vbo;
 	glGenBuffers(1, &vbo);
-	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, vbo);
 	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
 	// get vertex position attribute location and setup vertex attribute pointer
 	// (requires that the shader program has been compiled already!)
-	GLuint vecPosition = glGetAttribLocation(PROGRAM_ID, "vecPosition");
+	GLuint vecPosition = getAttribLocation("vecPosition", 0);
 	glVertexAttribPointer(vecPosition, 4, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
 	glEnableVertexAttribArray(vecPosition);
+
+	// build picking hierarchy for the triangle
+	for (int i = 0; i < 3; ++i)
+	{
+		PICK_MESH.positions.push_back(glm::vec3(vertices[4 * i], vertices[4 * i + 1], vertices[4 * i + 2]));
+		PICK_MESH.indices.push_back(i);
+	}
+	PICK_BVH.build(PICK_MESH);
+}
+
+
+
+void glutDoubleClickCB(int x, int y)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// shoot a ray through the mouse position into the trackball transformed model
+	glm::vec3 origin, direction;
+	TrackBall::unprojectMouse(x, y, TrackBall::getTransformation(), PROJECTION, origin, direction);
+
+	BVH::HitT hit;
+	if (PICK_BVH.intersect(origin, direction, hit))
+	{
+		glm::vec3 position = origin + hit.distance * direction;
+		cout << "Picked triangle " << hit.triangle << " at (" << position.x << ", "
+			<< position.y << ", " << position.z << ")" << endl;
+	}
+	else
+	{
+		cout << "Picked nothing" << endl;
+	}
 }
 
 
@@ -93,19 +1337,19 @@ void initRendering()
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
 	// set background color
-	glClearColor(0.0f, 0.0f, 0.4f, 0.0f);
+	StateTracker::clearColor(0.0f, 0.0f, 0.4f, 0.0f);
 	glClear(GL_COLOR_BUFFER_BIT);
 
-	glPolygonMode(GL_FRONT, GL_FILL);
-	glPolygonMode(GL_BACK, GL_LINE);
+	StateTracker::polygonMode(GL_FRONT, GL_FILL);
+	StateTracker::polygonMode(GL_BACK, GL_LINE);
 
 	// get and setup orthographic projection matrix
-	glm::mat4 projection = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, -10.0f, 10.0f);
-	GLint location = glGetUniformLocation(PROGRAM_ID, "matProjection");
-	glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(projection));
+	PROJECTION = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, -10.0f, 10.0f);
+	GLint location = getUniformLocation("matProjection", 1);
+	glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(PROJECTION));
 
 	// get modelview matrix location
-	MV_MAT4_LOCATION = glGetUniformLocation(PROGRAM_ID, "matModelView");
+	MV_MAT4_LOCATION = getUniformLocation("matModelView", 0);
 }
 
 
@@ -120,7 +1364,224 @@ void glutKeyboardCB(unsigned char key, int x, int y)
 			exit(0);
 			break;
 		}
+		case '1': case '2': case '3':
+		{
+			// switch per-instance data format of the instancing benchmark
+			if (BENCHMARK_INSTANCING)
+			{
+				INSTANCE_FORMAT = InstanceBuffer::InstanceFormatT(key - '1');
+				initInstances();
+			}
+			break;
+		}
+		case 'c':
+		{
+			// switch frustum culling of the instancing benchmark (off, scene index, SoA kernel)
+			static const char* cullingNames[] = { "off", "scene index", "SoA kernel" };
+			INSTANCE_CULLING = (INSTANCE_CULLING + 1) % 3;
+			cout << "Instance culling: " << cullingNames[INSTANCE_CULLING] << endl;
+			break;
+		}
+		case 'g':
+		{
+			// switch the light assignment of the clustered lighting demo or the particle
+			// simulation (GPU, CPU)
+			if (DEMO_LIGHTS)
+			{
+				bool gpu = LIGHTING->getMode() == ClusteredLighting::MODE_CPU;
+				LIGHTING->setMode(gpu ? ClusteredLighting::MODE_GPU : ClusteredLighting::MODE_CPU);
+				cout << "Light assignment: " << (gpu ? "GPU" : "CPU") << endl;
+			}
+			else if (DEMO_PARTICLES)
+			{
+				bool gpu = PARTICLES->getMode() == ParticleSystem::MODE_CPU;
+				PARTICLES->setMode(gpu ? ParticleSystem::MODE_GPU : ParticleSystem::MODE_CPU);
+				cout << "Particle simulation: " << (gpu ? "GPU" : "CPU") << endl;
+			}
+			break;
+		}
+		case 'k':
+		{
+			// switch the static caster cache of the shadow cascades demo
+			if (DEMO_SHADOWS)
+			{
+				SHADOWS->setCaching(!SHADOWS->isCaching());
+				cout << "Static shadow caster cache: " << (SHADOWS->isCaching() ? "on" : "off")
+					<< endl;
+			}
+			break;
+		}
+		case 'l':
+		{
+			// switch the light animation of the shadow cascades demo
+			if (DEMO_SHADOWS)
+			{
+				SHADOW_LIGHT_ANIMATION = !SHADOW_LIGHT_ANIMATION;
+				cout << "Light animation: " << (SHADOW_LIGHT_ANIMATION ? "on" : "off") << endl;
+			}
+			break;
+		}
+		case 'p':
+		{
+			// switch frustum and back-facing culling of the terrain patches
+			if (DEMO_TERRAIN)
+			{
+				TERRAIN->setCulling(!TERRAIN->isCulling());
+				cout << "Patch culling: " << (TERRAIN->isCulling() ? "on" : "off") << endl;
+			}
+			break;
+		}
+		case 's':
+		{
+			// switch the back to front sort of the particles (blending order)
+			if (DEMO_PARTICLES)
+			{
+				PARTICLES->setSorting(!PARTICLES->isSorting());
+				cout << "Particle sort: " << (PARTICLES->isSorting() ? "on" : "off") << endl;
+			}
+			break;
+		}
+		case 'w':
+		{
+			if (DEMO_TERRAIN) TERRAIN_WIREFRAME = !TERRAIN_WIREFRAME;
+			break;
+		}
+		case '+': case '-':
+		{
+			// halve or double the tessellated edge length of the terrain
+			if (DEMO_TERRAIN)
+			{
+				float pixels = TERRAIN->getPixelsPerEdge();
+				TERRAIN->setPixelsPerEdge((key == '+') ? 0.5f * pixels : 2.0f * pixels);
+				cout << "Pixels per edge: " << TERRAIN->getPixelsPerEdge() << endl;
+			}
+			break;
+		}
+	}
+}
+
+
+
+void parseCommandLine(int& argc, char *argv[])
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// remove application options and leave shader file names for UtilGLSL::initShaderProgram()
+	int files = 1;
+	for (int i = 1; i < argc; ++i)
+	{
+		string option = argv[i];
+		if (option == "-instances")
+		{
+			BENCHMARK_INSTANCING = true;
+			if ((i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+			{
+				INSTANCE_COUNT = atoi(argv[++i]);
+			}
+		}
+		else if (option == "-lod")
+		{
+			DEMO_LOD = true;
+			if ((i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+			{
+				LOD_SLICES = atoi(argv[++i]);
+			}
+		}
+		else if (option == "-benchmark" && (i + 1 < argc))
+		{
+			BENCHMARK_FRAMES = true;
+			BENCHMARK_SCENE = argv[++i];
+		}
+		else if (option == "-texture" && (i + 1 < argc))
+		{
+			DEMO_TEXTURE = true;
+			TEXTURE_FILE = argv[++i];
+			string mipmaps = (i + 1 < argc) ? argv[i + 1] : "";
+			if (mipmaps == "gpu" || mipmaps == "cpu" || mipmaps == "none")
+			{
+				TEXTURE_MIPMAPS = (mipmaps == "gpu") ? TextureLoader::MIPMAP_GPU :
+					(mipmaps == "cpu") ? TextureLoader::MIPMAP_CPU : TextureLoader::MIPMAP_NONE;
+				++i;
+			}
+		}
+		else if (option == "-graph")
+		{
+			DEMO_GRAPH = true;
+		}
+		else if (option == "-lights")
+		{
+			DEMO_LIGHTS = true;
+			if ((i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+			{
+				LIGHT_COUNT = atoi(argv[++i]);
+			}
+		}
+		else if (option == "-shadows")
+		{
+			DEMO_SHADOWS = true;
+		}
+		else if (option == "-terrain")
+		{
+			DEMO_TERRAIN = true;
+			if ((i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+			{
+				TERRAIN_PATCHES = atoi(argv[++i]);
+			}
+		}
+		else if (option == "-particles")
+		{
+			DEMO_PARTICLES = true;
+			if ((i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+			{
+				PARTICLE_CAPACITY = atoi(argv[++i]);
+			}
+			if ((i + 1 < argc) && (string(argv[i + 1]) == "cpu"))
+			{
+				PARTICLE_CPU = true;
+				++i;
+			}
+		}
+		else if (option == "-dynres")
+		{
+			DYNAMIC_BUDGET = 16.0;
+			if ((i + 1 < argc) && (atof(argv[i + 1]) > 0.0))
+			{
+				DYNAMIC_BUDGET = atof(argv[++i]);
+			}
+		}
+		else if (option == "-spirv")
+		{
+			USE_SPIRV = true;
+		}
+		else if (option == "-separable")
+		{
+			SEPARABLE_PROGRAMS = true;
+		}
+		else if (option == "-nobundle")
+		{
+			USE_BUNDLE = false;
+		}
+		else if (option == "-nostatefilter")
+		{
+			STATE_FILTER = false;
+		}
+		else if (option == "-errors" && (i + 1 < argc) && ErrorCheck::parseLevel(argv[i + 1], ERROR_CHECKS))
+		{
+			++i;
+			if ((i + 1 < argc) && (atoi(argv[i + 1]) > 0))
+			{
+				ERROR_SAMPLES = atoi(argv[++i]);
+			}
+		}
+		else if (option == "-benchmark_out" && (i + 1 < argc))
+		{
+			BENCHMARK_OUT = argv[++i];
+		}
+		else
+		{
+			argv[files++] = argv[i];
+		}
 	}
+	argc = files;
 }
 
 
@@ -129,7 +1590,7 @@ int main(int argc, char *argv[])
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
 	glutInit(&argc, argv);
-	glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE);
+	glutInitDisplayMode(GLUT_RGBA | GLUT_DOUBLE | GLUT_DEPTH);
 	glutInitWindowPosition(100, 100);
 	glutInitWindowSize(640, 640);
 	glutCreateWindow("Hello GLSL");
@@ -166,12 +1627,47 @@ int main(int argc, char *argv[])
 	glutMouseFunc(TrackBall::glutMouseButtonCB);
 	glutMotionFunc(TrackBall::glutMouseMotionCB);
 	glutSpecialFunc(TrackBall::glutSpecialFuncCB);
+	TrackBall::registerDoubleClick(glutDoubleClickCB);
 
 	// check for command line argument supplied shaders
-	if (argc > 1)
+	parseCommandLine(argc, argv);
+	ErrorCheck::setLevel(ERROR_CHECKS, ERROR_SAMPLES);
+	StateTracker::setEnabled(STATE_FILTER);
+
+	// serve shaders and scenes from the bundle packed at build time (one open/mmap for all)
+	if (USE_BUNDLE)
 	{
+		RESOURCES = new ResourceBundle();
+		if (RESOURCES->open("../resources.bundle")) ResourceBundle::mount(RESOURCES);
+	}
+	if (BENCHMARK_INSTANCING)
+	{
+		// the instance format is compiled into the program variants, command line shaders
+		// cannot follow the format keys
+		if (!USE_SPIRV) INSTANCE_SHADERS = new ShaderPreprocessor();
+		useInstanceProgram();
+	}
+	else if (argc > 1)
+	{
+		USE_SPIRV = false;   // command line shaders (GLSL or .spv) replace the defaults
 		PROGRAM_ID = UtilGLSL::initShaderProgram(argc, argv);
 	}
+	else if (DEMO_TEXTURE)
+	{
+		// own file name array, initShaderProgram() skips the first entry like argv[0]
+		char vertex[] = "../../glsl/helloglsl_textured.vert";
+		char fragment[] = "../../glsl/helloglsl_textured.frag";
+		char* files[] = { argv[0], vertex, fragment };
+		PROGRAM_ID = UtilGLSL::initShaderProgram(3, files);
+	}
+	else if (USE_SPIRV)
+	{
+		vector<string> files;
+		files.push_back("../../glsl/helloglsl.vert.spv");
+		files.push_back("../../glsl/helloglsl.frag.spv");
+		PROGRAM_ID = UtilGLSL::initSpirvProgram(files);
+		StateTracker::useProgram(PROGRAM_ID);
+	}
 	else
 	{
 		argc = 3;
@@ -184,6 +1680,16 @@ int main(int argc, char *argv[])
 	// init application
 	initRendering();
 	initModel();
+	if (BENCHMARK_INSTANCING) initInstances();
+	if (DEMO_LOD) initLOD();
+	if (BENCHMARK_FRAMES) initFrameBenchmark();
+	if (DEMO_TEXTURE) initTexture();
+	if (DEMO_GRAPH) initGraph();
+	if (DEMO_LIGHTS) initLights();
+	if (DEMO_SHADOWS) initShadows();
+	if (DEMO_TERRAIN) initTerrain();
+	if (DEMO_PARTICLES) initParticles();
+	if (DYNAMIC_BUDGET > 0.0) initDynamicResolution();
 
 	// entering GLUT/FLTK main rendering loop
 	glutMainLoop();
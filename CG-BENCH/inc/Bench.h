@@ -0,0 +1,117 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   Bench.h
+//
+//  \brief      Shared timing, registration and reporting helpers of the CG benchmark suite.
+//
+//   Usage:     Microbenchmarks follow the Google Benchmark style. A function taking a
+//              BenchState runs the measured code in a while (state.keepRunning()) loop and is
+//              registered with CG_BENCHMARK(function). The runner repeats it with growing
+//              iteration counts until it ran for at least --benchmark_min_time seconds and
+//              reports the time per iteration. Use benchDoNotOptimize() on results that would
+//              otherwise be optimized away.
+//
+//              Benchmark suites (scenario benchmarks with setup) report any number of values
+//              with benchReport(). All results can be written as JSON (--benchmark_out) and
+//              compared against a stored baseline (--baseline, --benchmark_threshold).
+//              Correctness values of a suite (mismatches, errors) are reported with
+//              benchCheck(), a value above its limit fails the run (exit code 1).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef BENCH_H
+#define BENCH_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <string>
+#include <cstddef>
+
+
+
+class BenchTimer
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	BenchTimer(void) { start(); };
+
+	void   start(void) { _Start = std::chrono::high_resolution_clock::now(); };
+	double getSeconds(void) const
+	{
+		return std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - _Start).count();
+	};
+
+private:
+	std::chrono::high_resolution_clock::time_point _Start;
+};
+// class BenchTimer ///////////////////////////////////////////////////////////////////////////////
+
+
+
+class BenchState
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	explicit BenchState(size_t iterations) : _Iterations(iterations), _Remaining(iterations),
+		_Items(0.0) {};
+
+	bool   keepRunning(void) { return (_Remaining-- > 0); };
+	size_t getIterations(void) const { return _Iterations; };
+
+	// processed items per iteration (reported as items per second)
+	void   setItemsPerIteration(double items) { _Items = items; };
+	double getItemsPerIteration(void) const { return _Items; };
+
+private:
+	size_t _Iterations;
+	size_t _Remaining;
+	double _Items;
+};
+// class BenchState ///////////////////////////////////////////////////////////////////////////////
+
+
+
+// register a microbenchmark at static initialization time
+typedef void (*BenchFunctionT)(BenchState& state);
+int benchRegister(const char* name, BenchFunctionT function);
+#define CG_BENCHMARK(function) static int function##_registered = benchRegister(#function, function)
+
+
+// keep a value alive without the compiler eliminating its computation
+template<typename T> inline void benchDoNotOptimize(const T& value)
+{
+#if defined(__GNUC__)
+	__asm__ __volatile__("" : : "g"(&value) : "memory");
+#else
+	static const void* volatile sink;
+	sink = &value;
+#endif
+}
+
+
+// record one result of a suite: benchmark name, value and unit
+void benchReport(const std::string& name, double value, const std::string& unit);
+
+// record a correctness result of a suite, values above limit fail the run
+void benchCheck(const std::string& name, double value, double limit, const std::string& unit);
+
+
+// benchmark suites
+void benchBVH(void);
+void benchOctree(void);
+void benchCulling(void);
+void benchTransform(void);
+void benchSimdMath(void);
+void benchParticles(void);
+void benchNoise(void);
+
+
+
+#endif // BENCH_H
@@ -0,0 +1,104 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: BVH ray picking throughput (BVH vs. brute force glm::intersectRayTriangle)         //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/Mesh.h"
+#include "../../_COMMON/inc/BVH.h"
+#include "../inc/Bench.h"
+
+
+
+glm::vec3 randomPoint(float extent)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return extent * glm::vec3(2.0f * rand() / RAND_MAX - 1.0f, 2.0f * rand() / RAND_MAX - 1.0f,
+		2.0f * rand() / RAND_MAX - 1.0f);
+}
+
+
+
+void benchBVHMesh(int slices, size_t incoherentRays, size_t bruteForceRays)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	Mesh mesh = Mesh::createSphere(1.0f, slices, slices / 2);
+	string prefix = "bvh/" + to_string(mesh.getTriangleCount()) + "/";
+
+	BenchTimer timer;
+	BVH bvh;
+	bvh.build(mesh);
+	benchReport(prefix + "build", timer.getSeconds() * 1000.0, "ms");
+	benchReport(prefix + "nodes", bvh.getNodeCount(), "");
+	benchReport(prefix + "depth", bvh.getDepth(), "");
+
+	// incoherent rays from a surrounding sphere towards random points near the center
+	srand(1);
+	vector<glm::vec3> origins(incoherentRays), directions(incoherentRays);
+	for (size_t i = 0; i < incoherentRays; ++i)
+	{
+		origins[i] = 3.0f * glm::normalize(randomPoint(1.0f) + glm::vec3(1.0e-6f));
+		directions[i] = glm::normalize(randomPoint(0.8f) - origins[i]);
+	}
+
+	size_t hits = 0;
+	BVH::HitT hit;
+	timer.start();
+	for (size_t i = 0; i < incoherentRays; ++i) hits += bvh.intersect(origins[i], directions[i], hit);
+	double seconds = timer.getSeconds();
+	benchReport(prefix + "incoherent", incoherentRays / seconds * 1.0e-6, "Mrays/s");
+	benchReport(prefix + "incoherent_hit_rate", 100.0 * hits / incoherentRays, "%");
+
+	// coherent primary rays of an orthographic 1024 x 1024 view
+	const int size = 1024;
+	timer.start();
+	hits = 0;
+	for (int y = 0; y < size; ++y)
+	{
+		for (int x = 0; x < size; ++x)
+		{
+			glm::vec3 origin(2.4f * (x + 0.5f) / size - 1.2f, 2.4f * (y + 0.5f) / size - 1.2f, 5.0f);
+			hits += bvh.intersect(origin, glm::vec3(0.0f, 0.0f, -1.0f), hit);
+		}
+	}
+	seconds = timer.getSeconds();
+	benchReport(prefix + "coherent", size * size / seconds * 1.0e-6, "Mrays/s");
+
+	// brute force reference (also validates the closest hits)
+	size_t mismatches = 0;
+	timer.start();
+	for (size_t i = 0; i < bruteForceRays; ++i)
+	{
+		BVH::HitT reference;
+		bool expected = BVH::intersectBruteForce(mesh, origins[i], directions[i], reference);
+		if (expected != bvh.intersect(origins[i], directions[i], hit)) ++mismatches;
+		else if (expected && fabs(reference.distance - hit.distance) > 1.0e-5f) ++mismatches;
+	}
+	seconds = timer.getSeconds();
+	benchReport(prefix + "brute_force", bruteForceRays / seconds * 1.0e-6, "Mrays/s");
+	benchCheck(prefix + "mismatches", double(mismatches), 0.0, "rays");
+}
+
+
+
+void benchBVH(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	benchBVHMesh(100, 1000000, 1000);     // ~10k triangles
+	benchBVHMesh(1000, 1000000, 32);      // ~1M triangles
+}
@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: SoA frustum culling kernels (SIMD vs. scalar reference)                            //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+#include <string>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/CpuInfo.h"
+#include "../../_COMMON/inc/Frustum.h"
+#include "../../_COMMON/inc/FrustumCuller.h"
+#include "../inc/Bench.h"
+
+
+
+size_t countMismatches(const vector<GLuint>& a, GLsizei na, const vector<GLuint>& b, GLsizei nb)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t mismatches = (na > nb) ? na - nb : nb - na;
+	for (GLsizei i = 0; i < na && i < nb; ++i) mismatches += (a[i] != b[i]) ? 1 : 0;
+	return mismatches;
+}
+
+
+
+void benchCulling(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const GLsizei count = 1000000;
+	const int passes = 20;
+
+	// random volumes in a 200^3 world seen from its center (about a tenth is visible)
+	srand(1);
+	FrustumCuller::SphereArrayT spheres;
+	FrustumCuller::BoxArrayT boxes;
+	for (GLsizei i = 0; i < count; ++i)
+	{
+		glm::vec3 center(200.0f * rand() / RAND_MAX - 100.0f, 200.0f * rand() / RAND_MAX - 100.0f,
+			200.0f * rand() / RAND_MAX - 100.0f);
+		float size = 0.5f + 1.5f * rand() / RAND_MAX;
+		spheres.add(center, size);
+		boxes.add(center - glm::vec3(size, 0.5f * size, size), center + glm::vec3(size, 0.5f * size, size));
+	}
+
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+	Frustum frustum(projection * glm::lookAt(glm::vec3(0.0f), glm::vec3(1.0f, 0.2f, -1.0f),
+		glm::vec3(0.0f, 1.0f, 0.0f)));
+	vector<GLuint> visible(count), spheresReference(count), boxesReference(count);
+
+	// AoS references (FrustumCuller::cullSpheresScalar() and cullBoxesScalar())
+	BenchTimer timer;
+	GLsizei ns = 0, nb = 0, n = 0;
+	for (int p = 0; p < passes; ++p) ns = FrustumCuller::cullSpheresScalar(frustum, spheres, &spheresReference[0]);
+	benchReport("culling/spheres_reference", passes * count / timer.getSeconds() * 1.0e-6, "Mobjects/s");
+	benchReport("culling/spheres_visible", ns, "objects");
+	timer.start();
+	for (int p = 0; p < passes; ++p) nb = FrustumCuller::cullBoxesScalar(frustum, boxes, &boxesReference[0]);
+	benchReport("culling/boxes_reference", passes * count / timer.getSeconds() * 1.0e-6, "Mobjects/s");
+	benchReport("culling/boxes_visible", nb, "objects");
+
+	// SoA kernels of every level (1, 4 or 8 lanes) against the references
+	for (int level = CpuInfo::SL_SCALAR; level <= CpuInfo::getDetectedLevel(); ++level)
+	{
+		CpuInfo::setMaxLevel(CpuInfo::SimdLevelT(level));
+		string name = CpuInfo::getLevelName(CpuInfo::SimdLevelT(level));
+		cout << "  (" << name << ": " << FrustumCuller::getInstructionSet() << ", "
+			<< FrustumCuller::getLaneCount() << " lanes)" << endl;
+
+		timer.start();
+		for (int p = 0; p < passes; ++p) n = FrustumCuller::cullSpheres(frustum, spheres, &visible[0]);
+		benchReport("culling/spheres/" + name, passes * count / timer.getSeconds() * 1.0e-6,
+			"Mobjects/s");
+		benchCheck("culling/spheres_mismatch/" + name,
+			double(countMismatches(visible, n, spheresReference, ns)), 0.0, "objects");
+
+		timer.start();
+		for (int p = 0; p < passes; ++p) n = FrustumCuller::cullBoxes(frustum, boxes, &visible[0]);
+		benchReport("culling/boxes/" + name, passes * count / timer.getSeconds() * 1.0e-6,
+			"Mobjects/s");
+		benchCheck("culling/boxes_mismatch/" + name,
+			double(countMismatches(visible, n, boxesReference, nb)), 0.0, "objects");
+	}
+	CpuInfo::setMaxLevel(CpuInfo::SL_AVX512);
+}
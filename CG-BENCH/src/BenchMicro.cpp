@@ -0,0 +1,242 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: microbenchmarks of TrackBall, UtilGLSL, GLM math and packing                       //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/packing.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/CpuInfo.h"
+#include "../../_COMMON/inc/SimdMath.h"
+#include "../../_COMMON/inc/TrackBall.h"
+#include "../../_COMMON/inc/UtilGLSL.h"
+#include "../inc/Bench.h"
+
+
+
+// deterministic test data
+glm::mat4 benchMatrix(int seed)
+{
+	glm::mat4 m;
+	for (int k = 0; k < 16; ++k) m[k / 4][k % 4] = float((seed * 31 + k * 17) % 29) / 29.0f;
+	for (int k = 0; k < 4; ++k) m[k][k] += 4.0f; // well conditioned
+	return m;
+}
+
+
+
+void BM_TrackBall_getTransformation(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	TrackBall::resetTransformation();
+	while (state.keepRunning())
+	{
+		benchDoNotOptimize(TrackBall::getTransformation());
+	}
+}
+CG_BENCHMARK(BM_TrackBall_getTransformation);
+
+
+
+void BM_TrackBall_rotateTrackball(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	float rotation[4] = { 0.0f, 0.0f, 1.0f, 0.0f };
+	int step = 0;
+	while (state.keepRunning())
+	{
+		TrackBall::rotateTrackball(3 + (step & 7), 2 - (step & 3), 1024, rotation);
+		benchDoNotOptimize(rotation);
+		++step;
+	}
+}
+CG_BENCHMARK(BM_TrackBall_rotateTrackball);
+
+
+
+void BM_UtilGLSL_readShaderFile(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// typical shader size of the demos (about 1 KB)
+	const string filename = "cgbench_shader.tmp";
+	{
+		ofstream file(filename.c_str(), ios_base::binary);
+		for (int i = 0; i < 24; ++i) file << "uniform mat4 matModelView" << i << "; // padding\n";
+	}
+
+	// readShaderFile() logs every read, keep the benchmark output clean
+	ostringstream sink;
+	streambuf* coutBuffer = cout.rdbuf(sink.rdbuf());
+	while (state.keepRunning())
+	{
+		char* code = UtilGLSL::readShaderFile(filename);
+		benchDoNotOptimize(code);
+		delete[] code;
+		sink.str("");
+	}
+	cout.rdbuf(coutBuffer);
+	remove(filename.c_str());
+}
+CG_BENCHMARK(BM_UtilGLSL_readShaderFile);
+
+
+
+void BM_mat4_multiply_glm(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::mat4 a = benchMatrix(1), b = benchMatrix(2), c = a;
+	while (state.keepRunning())
+	{
+		c = a * b;
+		benchDoNotOptimize(c);
+		benchDoNotOptimize(a);
+	}
+}
+CG_BENCHMARK(BM_mat4_multiply_glm);
+
+
+
+void benchMultiply(BenchState& state, CpuInfo::SimdLevelT level)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CpuInfo::setMaxLevel(level);
+	glm::mat4 a = benchMatrix(1), b = benchMatrix(2), c;
+	while (state.keepRunning())
+	{
+		c = SimdMath::multiply(a, b);
+		benchDoNotOptimize(c);
+		benchDoNotOptimize(a);
+	}
+	CpuInfo::setMaxLevel(CpuInfo::SL_AVX512);
+}
+
+void BM_mat4_multiply_scalar(BenchState& state) { benchMultiply(state, CpuInfo::SL_SCALAR); }
+void BM_mat4_multiply_sse2(BenchState& state) { benchMultiply(state, CpuInfo::SL_SSE2); }
+void BM_mat4_multiply_avx2(BenchState& state) { benchMultiply(state, CpuInfo::SL_AVX2); }
+void BM_mat4_multiply_avx512(BenchState& state) { benchMultiply(state, CpuInfo::SL_AVX512); }
+CG_BENCHMARK(BM_mat4_multiply_scalar);
+CG_BENCHMARK(BM_mat4_multiply_sse2);
+CG_BENCHMARK(BM_mat4_multiply_avx2);
+CG_BENCHMARK(BM_mat4_multiply_avx512);
+
+
+
+void BM_mat4_inverse_glm(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::mat4 m = benchMatrix(3);
+	while (state.keepRunning())
+	{
+		m = glm::inverse(m);
+		benchDoNotOptimize(m);
+	}
+}
+CG_BENCHMARK(BM_mat4_inverse_glm);
+
+
+
+void benchInverse(BenchState& state, CpuInfo::SimdLevelT level)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CpuInfo::setMaxLevel(level);
+	glm::mat4 m = benchMatrix(3);
+	while (state.keepRunning())
+	{
+		m = SimdMath::inverse(m);
+		benchDoNotOptimize(m);
+	}
+	CpuInfo::setMaxLevel(CpuInfo::SL_AVX512);
+}
+
+void BM_mat4_inverse_scalar(BenchState& state) { benchInverse(state, CpuInfo::SL_SCALAR); }
+void BM_mat4_inverse_sse2(BenchState& state) { benchInverse(state, CpuInfo::SL_SSE2); }
+void BM_mat4_inverse_avx2(BenchState& state) { benchInverse(state, CpuInfo::SL_AVX2); }
+CG_BENCHMARK(BM_mat4_inverse_scalar);
+CG_BENCHMARK(BM_mat4_inverse_sse2);
+CG_BENCHMARK(BM_mat4_inverse_avx2);
+
+
+
+void BM_quat_slerp(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::quat p = glm::angleAxis(0.3f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+	glm::quat q = glm::angleAxis(2.1f, glm::normalize(glm::vec3(-2.0f, 1.0f, 0.5f)));
+	float t = 0.0f;
+	while (state.keepRunning())
+	{
+		benchDoNotOptimize(glm::slerp(p, q, t));
+		t = (t < 1.0f) ? t + 0.001f : 0.0f;
+	}
+}
+CG_BENCHMARK(BM_quat_slerp);
+
+
+
+void BM_pack_vertex(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// compact vertex formats: normal as 10_10_10_2, color as RGBA8, texture coordinate as half2
+	glm::vec3 normal = glm::normalize(glm::vec3(0.3f, -0.5f, 0.8f));
+	glm::vec4 color(0.25f, 0.5f, 0.75f, 1.0f);
+	glm::vec2 uv(0.125f, 0.875f);
+	while (state.keepRunning())
+	{
+		glm::uint packed[3] = { glm::packSnorm3x10_1x2(glm::vec4(normal, 0.0f)),
+			glm::packUnorm4x8(color), glm::packHalf2x16(uv) };
+		benchDoNotOptimize(packed);
+		uv.x += 1.0e-6f;
+	}
+	state.setItemsPerIteration(1.0);
+}
+CG_BENCHMARK(BM_pack_vertex);
+
+
+
+void BM_unpack_vertex(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::uint normal = glm::packSnorm3x10_1x2(glm::vec4(0.3f, -0.5f, 0.8f, 0.0f));
+	glm::uint color = glm::packUnorm4x8(glm::vec4(0.25f, 0.5f, 0.75f, 1.0f));
+	glm::uint uv = glm::packHalf2x16(glm::vec2(0.125f, 0.875f));
+	while (state.keepRunning())
+	{
+		glm::vec4 n = glm::unpackSnorm3x10_1x2(normal);
+		glm::vec4 c = glm::unpackUnorm4x8(color);
+		glm::vec2 t = glm::unpackHalf2x16(uv);
+		benchDoNotOptimize(n); benchDoNotOptimize(c); benchDoNotOptimize(t);
+		uv ^= 1;
+	}
+	state.setItemsPerIteration(1.0);
+}
+CG_BENCHMARK(BM_unpack_vertex);
+
+
+
+void BM_pack_F2x11_1x10(BenchState& state)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::vec3 color(1.5f, 0.25f, 12.0f); // HDR color as R11G11B10F
+	while (state.keepRunning())
+	{
+		benchDoNotOptimize(glm::packF2x11_1x10(color));
+		color.y += 1.0e-6f;
+	}
+}
+CG_BENCHMARK(BM_pack_F2x11_1x10);
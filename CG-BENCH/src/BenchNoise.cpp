@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: batched fBm / ridged noise fields (GLM reference vs. SIMD levels and threads)      //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/CpuInfo.h"
+#include "../../_COMMON/inc/NoiseField.h"
+#include "../inc/Bench.h"
+
+
+
+// largest absolute difference of two fields
+static double maxError(const vector<float>& a, const vector<float>& b)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	double error = 0.0;
+	for (size_t i = 0; i < a.size(); ++i) error = max(error, fabs(double(a[i]) - double(b[i])));
+	return error;
+}
+
+
+
+void benchNoise(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const int size = 512;       // heightfield size x size
+	const int volume = 96;      // density volume volume^3
+	const double tolerance = 100.0; // 1e-6 units, the rounding bound documented in NoiseField.h
+	const char* NOISE_NAMES[] = { "perlin", "simplex" };
+	const char* FRACTAL_NAMES[] = { "fbm", "ridged" };
+
+	BenchTimer timer;
+	vector<float> reference(size_t(size) * size), field(reference.size());
+	for (int noise = NoiseField::NOISE_PERLIN; noise <= NoiseField::NOISE_SIMPLEX; ++noise)
+	{
+		for (int fractal = NoiseField::FRACTAL_FBM; fractal <= NoiseField::FRACTAL_RIDGED; ++fractal)
+		{
+			NoiseField::ParametersT parameters = NoiseField::getDefaultParameters();
+			parameters.noise = NoiseField::NoiseT(noise);
+			parameters.fractal = NoiseField::FractalT(fractal);
+			string prefix = string("noise/") + NOISE_NAMES[noise] + "/" + FRACTAL_NAMES[fractal] + "/";
+			double samples = double(reference.size());
+
+			// one glm::perlin() or glm::simplex() call per octave and sample
+			timer.start();
+			for (int j = 0; j < size; ++j)
+			{
+				for (int i = 0; i < size; ++i)
+				{
+					reference[size_t(j) * size + i] = NoiseField::sample(parameters,
+						glm::vec3(float(i), float(j), 0.0f));
+				}
+			}
+			benchReport(prefix + "reference", samples / timer.getSeconds() * 1.0e-6, "Msamples/s");
+
+			for (int level = CpuInfo::SL_SCALAR; level <= CpuInfo::getDetectedLevel(); ++level)
+			{
+				CpuInfo::setMaxLevel(CpuInfo::SimdLevelT(level));
+				string name = CpuInfo::getLevelName(CpuInfo::SimdLevelT(level));
+
+				timer.start();
+				NoiseField::generate(parameters, &field[0], size, size, 1, 1);
+				benchReport(prefix + name, samples / timer.getSeconds() * 1.0e-6, "Msamples/s");
+				benchCheck(prefix + "error/" + name, maxError(field, reference) * 1.0e6, tolerance,
+					"1e-6");
+			}
+			CpuInfo::setMaxLevel(CpuInfo::SL_AVX512);
+
+			timer.start();
+			NoiseField::generate(parameters, &field[0], size, size);
+			benchReport(prefix + "threads", samples / timer.getSeconds() * 1.0e-6, "Msamples/s");
+		}
+	}
+
+	// 3D density volume on all threads
+	NoiseField::ParametersT parameters = NoiseField::getDefaultParameters();
+	parameters.octaves = 4;
+	parameters.frequency = 1.0f / 32.0f;
+	vector<float> density(size_t(volume) * volume * volume);
+	timer.start();
+	NoiseField::generate(parameters, &density[0], volume, volume, volume);
+	benchReport("noise/volume/threads", density.size() / timer.getSeconds() * 1.0e-6,
+		"Msamples/s");
+}
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: loose octree scene index (insert, update, frustum and sphere queries)              //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <cmath>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/Frustum.h"
+#include "../../_COMMON/inc/LooseOctree.h"
+#include "../inc/Bench.h"
+
+
+
+float randomFloat(float minimum, float maximum)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return minimum + (maximum - minimum) * float(rand()) / RAND_MAX;
+}
+
+
+
+void benchOctreeScene(GLuint count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// constant object density: the world grows with the object count
+	float halfSize = 50.0f * pow(count / 1000.0f, 1.0f / 3.0f);
+	string prefix = "octree/" + to_string(count) + "/";
+
+	srand(1);
+	vector<glm::vec4> spheres(count), velocities(count);
+	for (GLuint i = 0; i < count; ++i)
+	{
+		spheres[i] = glm::vec4(randomFloat(-halfSize, halfSize), randomFloat(-halfSize, halfSize),
+			randomFloat(-halfSize, halfSize), randomFloat(0.5f, 1.5f));
+		velocities[i] = glm::vec4(randomFloat(-0.1f, 0.1f), randomFloat(-0.1f, 0.1f),
+			randomFloat(-0.1f, 0.1f), 0.0f);
+	}
+
+	// subdivide until the leaf cells hold about eight objects
+	LooseOctree octree;
+	octree.init(glm::vec3(0.0f), halfSize, int(log(count / 8.0f) / log(8.0f) + 0.5f));
+
+	BenchTimer timer;
+	for (GLuint i = 0; i < count; ++i) octree.insert(glm::vec3(spheres[i]), spheres[i].w);
+	benchReport(prefix + "insert", timer.getSeconds() * 1.0e9 / count, "ns/object");
+	benchReport(prefix + "nodes", octree.getNodeCount(), "");
+
+	// move all objects (most stay in their cell) for a few frames
+	const int frames = 10;
+	timer.start();
+	for (int frame = 0; frame < frames; ++frame)
+	{
+		for (GLuint i = 0; i < count; ++i)
+		{
+			spheres[i] += velocities[i];
+			octree.update(i, glm::vec3(spheres[i]), spheres[i].w);
+		}
+	}
+	benchReport(prefix + "update", timer.getSeconds() * 1.0e9 / (frames * count), "ns/object");
+
+	// camera in the world center, looking along -z with a 60 degree field of view
+	glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.0f, 0.1f, halfSize);
+	glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+	vector<GLuint> visible, reference;
+	visible.reserve(count);
+	const int queries = 20;
+	timer.start();
+	for (int q = 0; q < queries; ++q)
+	{
+		Frustum frustum(projection * glm::rotate(view, 0.3f * q, glm::vec3(0.0f, 1.0f, 0.0f)));
+		visible.clear();
+		octree.queryFrustum(frustum, visible);
+	}
+	benchReport(prefix + "frustum_query", timer.getSeconds() * 1.0e3 / queries, "ms");
+	benchReport(prefix + "frustum_visible", double(visible.size()), "objects");
+
+	// brute force reference over all spheres (also validates the last query)
+	timer.start();
+	for (int q = 0; q < queries; ++q)
+	{
+		Frustum frustum(projection * glm::rotate(view, 0.3f * q, glm::vec3(0.0f, 1.0f, 0.0f)));
+		reference.clear();
+		for (GLuint i = 0; i < count; ++i)
+		{
+			if (frustum.testSphere(glm::vec3(spheres[i]), spheres[i].w)) reference.push_back(i);
+		}
+	}
+	benchReport(prefix + "frustum_brute_force", timer.getSeconds() * 1.0e3 / queries, "ms");
+	sort(visible.begin(), visible.end());
+	benchReport(prefix + "frustum_mismatch", visible == reference ? 0.0 : 1.0, "");
+
+	// proximity queries around random objects
+	const int sphereQueries = 1000;
+	size_t found = 0;
+	timer.start();
+	for (int q = 0; q < sphereQueries; ++q)
+	{
+		const glm::vec4& s = spheres[rand() % count];
+		visible.clear();
+		octree.querySphere(glm::vec3(s), 10.0f, visible);
+		found += visible.size();
+	}
+	benchReport(prefix + "sphere_query", timer.getSeconds() * 1.0e6 / sphereQueries, "us");
+	benchReport(prefix + "sphere_found", double(found) / sphereQueries, "objects");
+
+	// remove and reinsert half of the objects
+	timer.start();
+	for (GLuint i = 0; i < count; i += 2) octree.remove(i);
+	for (GLuint i = 0; i < count; i += 2) octree.insert(glm::vec3(spheres[i]), spheres[i].w);
+	benchReport(prefix + "remove_insert", timer.getSeconds() * 1.0e9 / count, "ns/object");
+}
+
+
+
+void benchOctree(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	benchOctreeScene(10000);
+	benchOctreeScene(100000);
+	benchOctreeScene(1000000);
+}
@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: CPU particle simulation over structure of arrays (scalar vs. SSE2)                 //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/CpuInfo.h"
+#include "../../_COMMON/inc/ParticleSystem.h"
+#include "../inc/Bench.h"
+
+
+
+// particles that differ between two simulations (bitwise)
+static size_t countMismatches(const ParticleSystem::ParticleArrayT& a,
+	const ParticleSystem::ParticleArrayT& b)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (a.count != b.count) return max(a.count, b.count);
+	size_t mismatches = 0;
+	for (size_t i = 0; i < a.count; ++i)
+	{
+		mismatches += (a.x[i] != b.x[i]) || (a.y[i] != b.y[i]) || (a.z[i] != b.z[i])
+			|| (a.vx[i] != b.vx[i]) || (a.vy[i] != b.vy[i]) || (a.vz[i] != b.vz[i])
+			|| (a.life[i] != b.life[i]);
+	}
+	return mismatches;
+}
+
+
+
+void benchParticles(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const size_t capacity = 1 << 20;
+	const int warmup = 240;   // frames until emission and deaths balance
+	const int frames = 60;
+	const float deltaTime = 1.0f / 60.0f;
+
+	// the fountain of the demo, 90 percent of the capacity alive
+	ParticleSystem::ParametersT parameters;
+	parameters.position = glm::vec3(0.0f);
+	parameters.speed = 6.0f;
+	parameters.spread = 0.25f;
+	parameters.lifetime = 4.0f;
+	parameters.gravity = 9.81f;
+	parameters.restitution = 0.5f;
+	parameters.radius = 0.02f;
+	parameters.rate = 0.9f * capacity / (0.75f * parameters.lifetime);
+	size_t emit = size_t(parameters.rate * deltaTime);
+
+	ParticleSystem::ParticleArrayT start;
+	start.resize(capacity);
+	GLuint seed = 0;
+	for (int f = 0; f < warmup; ++f, seed += GLuint(emit))
+	{
+		ParticleSystem::simulate(start, parameters, deltaTime, emit, seed);
+	}
+	benchReport("particles/alive", double(start.count), "particles");
+
+	// scalar reference, every level starts from the same particles
+	ParticleSystem::ParticleArrayT reference = start;
+	BenchTimer timer;
+	size_t updated = 0;
+	for (int f = 0; f < frames; ++f)
+	{
+		updated += reference.count;
+		ParticleSystem::simulateScalar(reference, parameters, deltaTime, emit,
+			seed + GLuint(f * emit));
+	}
+	benchReport("particles/update/reference", updated / timer.getSeconds() * 1.0e-6,
+		"Mparticles/s");
+
+	for (int level = CpuInfo::SL_SCALAR; level <= CpuInfo::getDetectedLevel(); ++level)
+	{
+		CpuInfo::setMaxLevel(CpuInfo::SimdLevelT(level));
+		string name = CpuInfo::getLevelName(CpuInfo::SimdLevelT(level));
+
+		ParticleSystem::ParticleArrayT particles = start;
+		timer.start();
+		updated = 0;
+		for (int f = 0; f < frames; ++f)
+		{
+			updated += particles.count;
+			ParticleSystem::simulate(particles, parameters, deltaTime, emit,
+				seed + GLuint(f * emit));
+		}
+		benchReport("particles/update/" + name, updated / timer.getSeconds() * 1.0e-6,
+			"Mparticles/s");
+		benchReport("particles/mismatch/" + name, double(countMismatches(particles, reference)),
+			"particles");
+	}
+	CpuInfo::setMaxLevel(CpuInfo::SL_AVX512);
+}
@@ -0,0 +1,102 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: runtime dispatched matrix and quaternion math (all CPU levels vs. GLM)             //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <string>
+#include <cstdlib>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/CpuInfo.h"
+#include "../../_COMMON/inc/SimdMath.h"
+#include "../inc/Bench.h"
+
+
+
+void benchSimdMath(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const size_t count = 4096;
+	const size_t repeat = 1000;
+
+	srand(1);
+	vector<glm::mat4> matrices(count);
+	vector<glm::quat> quats(count), results(count);
+	for (size_t i = 0; i < count; ++i)
+	{
+		for (int k = 0; k < 16; ++k) matrices[i][k / 4][k % 4] = float(rand()) / RAND_MAX;
+		matrices[i][0][0] += 4.0f; matrices[i][1][1] += 4.0f; matrices[i][2][2] += 4.0f; matrices[i][3][3] += 4.0f;
+		quats[i] = glm::normalize(glm::quat(float(rand()) / RAND_MAX, float(rand()) / RAND_MAX,
+			float(rand()) / RAND_MAX, float(rand()) / RAND_MAX));
+	}
+	glm::quat spin = glm::angleAxis(0.01f, glm::vec3(0.0f, 0.0f, 1.0f));
+
+	// GLM reference (compiled for the GLM_ARCH of this build)
+	glm::mat4 sum(0.0f);
+	BenchTimer timer;
+	for (size_t r = 0; r < repeat; ++r)
+	{
+		for (size_t i = 0; i + 1 < count; ++i) sum += matrices[i] * matrices[i + 1];
+		benchDoNotOptimize(sum);
+	}
+	benchReport("simdmath/mat4_mul/glm", timer.getSeconds() * 1.0e9 / (repeat * (count - 1)), "ns");
+	timer.start();
+	for (size_t r = 0; r < repeat; ++r)
+	{
+		for (size_t i = 0; i < count; ++i) sum += glm::inverse(matrices[i]);
+		benchDoNotOptimize(sum);
+	}
+	benchReport("simdmath/mat4_inverse/glm", timer.getSeconds() * 1.0e9 / (repeat * count), "ns");
+	timer.start();
+	for (size_t r = 0; r < repeat; ++r)
+	{
+		for (size_t i = 0; i < count; ++i) results[i] = spin * quats[i];
+		benchDoNotOptimize(results[0]);
+	}
+	benchReport("simdmath/quat_mul/glm", timer.getSeconds() * 1.0e9 / (repeat * count), "ns");
+
+	for (int level = CpuInfo::SL_SCALAR; level <= CpuInfo::getDetectedLevel(); ++level)
+	{
+		CpuInfo::setMaxLevel(CpuInfo::SimdLevelT(level));
+		string name = CpuInfo::getLevelName(CpuInfo::SimdLevelT(level));
+
+		timer.start();
+		for (size_t r = 0; r < repeat; ++r)
+		{
+			for (size_t i = 0; i + 1 < count; ++i) sum += SimdMath::multiply(matrices[i], matrices[i + 1]);
+			benchDoNotOptimize(sum);
+		}
+		benchReport("simdmath/mat4_mul/" + name, timer.getSeconds() * 1.0e9 / (repeat * (count - 1)), "ns");
+
+		// the AVX-512 level inverts with the AVX2 kernel
+		if (level <= CpuInfo::SL_AVX2)
+		{
+			timer.start();
+			for (size_t r = 0; r < repeat; ++r)
+			{
+				for (size_t i = 0; i < count; ++i) sum += SimdMath::inverse(matrices[i]);
+				benchDoNotOptimize(sum);
+			}
+			benchReport("simdmath/mat4_inverse/" + name, timer.getSeconds() * 1.0e9 / (repeat * count), "ns");
+		}
+
+		timer.start();
+		for (size_t r = 0; r < repeat; ++r)
+		{
+			SimdMath::multiply(spin, &quats[0], &results[0], count);
+			benchDoNotOptimize(results[0]);
+		}
+		benchReport("simdmath/quat_mul_batch/" + name, timer.getSeconds() * 1.0e9 / (repeat * count), "ns");
+	}
+	CpuInfo::setMaxLevel(CpuInfo::SL_AVX512);
+}
@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: batched mat4 transforms (SSE2/AVX2/AVX-512 kernels vs. per element GLM loop)       //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <cstdlib>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/CpuInfo.h"
+#include "../../_COMMON/inc/BatchTransform.h"
+#include "../inc/Bench.h"
+
+
+
+void benchTransformBatch(size_t count, size_t total)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// total elements per measurement, so small (cache resident) batches are repeated
+	size_t repeat = total / count;
+	string prefix = "transform/" + to_string(count) + "/";
+
+	glm::vec4* vectors = (glm::vec4*) BatchTransform::allocate(count * sizeof(glm::vec4));
+	glm::vec4* results = (glm::vec4*) BatchTransform::allocate(count * sizeof(glm::vec4));
+	glm::mat4* a = (glm::mat4*) BatchTransform::allocate(count * sizeof(glm::mat4));
+	glm::mat4* b = (glm::mat4*) BatchTransform::allocate(count * sizeof(glm::mat4));
+	glm::mat4* c = (glm::mat4*) BatchTransform::allocate(count * sizeof(glm::mat4));
+	float* soa = (float*) BatchTransform::allocate(8 * count * sizeof(float));
+	BatchTransform::StreamT in = { soa, soa + count, soa + 2 * count, soa + 3 * count };
+	BatchTransform::StreamT out = { soa + 4 * count, soa + 5 * count, soa + 6 * count, soa + 7 * count };
+
+	srand(1);
+	glm::mat4 matrix;
+	for (int k = 0; k < 16; ++k) matrix[k / 4][k % 4] = float(rand()) / RAND_MAX;
+	for (size_t i = 0; i < count; ++i)
+	{
+		vectors[i] = glm::vec4(float(rand()) / RAND_MAX, float(rand()) / RAND_MAX, float(rand()) / RAND_MAX, 1.0f);
+		a[i] = b[i] = matrix;
+		in.x[i] = vectors[i].x; in.y[i] = vectors[i].y; in.z[i] = vectors[i].z; in.w[i] = 1.0f;
+	}
+
+	// naive per element GLM loops (compiled for the GLM_ARCH of this build)
+	BenchTimer timer;
+	for (size_t r = 0; r < repeat; ++r)
+	{
+		for (size_t i = 0; i < count; ++i) results[i] = matrix * vectors[i];
+	}
+	benchReport(prefix + "mat4_vec4/glm", repeat * count / timer.getSeconds() * 1.0e-6, "Mvec/s");
+	timer.start();
+	for (size_t r = 0; r < repeat; ++r)
+	{
+		for (size_t i = 0; i < count; ++i) c[i] = a[i] * b[i];
+	}
+	benchReport(prefix + "mat4_mat4/glm", repeat * count / timer.getSeconds() * 1.0e-6, "Mmat/s");
+
+	// batch kernels of every level the CPU supports
+	for (int level = CpuInfo::SL_SCALAR; level <= CpuInfo::getDetectedLevel(); ++level)
+	{
+		CpuInfo::setMaxLevel(CpuInfo::SimdLevelT(level));
+		string name = CpuInfo::getLevelName(CpuInfo::SimdLevelT(level));
+
+		timer.start();
+		for (size_t r = 0; r < repeat; ++r) BatchTransform::transform(matrix, vectors, results, count);
+		benchReport(prefix + "mat4_vec4/" + name, repeat * count / timer.getSeconds() * 1.0e-6, "Mvec/s");
+
+		timer.start();
+		for (size_t r = 0; r < repeat; ++r) BatchTransform::multiply(a, b, c, count);
+		benchReport(prefix + "mat4_mat4/" + name, repeat * count / timer.getSeconds() * 1.0e-6, "Mmat/s");
+
+		timer.start();
+		for (size_t r = 0; r < repeat; ++r) BatchTransform::transformSoA(matrix, in, out, count);
+		benchReport(prefix + "soa/" + name, repeat * count / timer.getSeconds() * 1.0e-6, "Mvec/s");
+	}
+	CpuInfo::setMaxLevel(CpuInfo::SL_AVX512);
+
+	BatchTransform::release(vectors);
+	BatchTransform::release(results);
+	BatchTransform::release(a);
+	BatchTransform::release(b);
+	BatchTransform::release(c);
+	BatchTransform::release(soa);
+}
+
+
+
+void benchTransform(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	cout << "  (detected: " << CpuInfo::getLevelName(CpuInfo::getDetectedLevel()) << ")" << endl;
+	benchTransformBatch(1024, 1 << 24);         // L1/L2 resident
+	benchTransformBatch(1 << 20, 1 << 24);      // memory bound
+}
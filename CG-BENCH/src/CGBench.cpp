@@ -0,0 +1,445 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmark: CG-BENCH - CPU benchmark suite for the _COMMON helpers (Ver 1.1)                   //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <map>
+#include <ctime>
+#include <cstdlib>
+#include <cmath>
+#include <thread>
+using namespace std;
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/CpuInfo.h"
+#include "../inc/Bench.h"
+
+
+// registered benchmark suites ////////////////////////////////////////////////////////////////////
+struct SuiteT
+{
+	const char* name;
+	void (*run)(void);
+};
+
+SuiteT SUITES[] =
+{
+	{ "bvh", benchBVH },
+	{ "octree", benchOctree },
+	{ "culling", benchCulling },
+	{ "transform", benchTransform },
+	{ "simdmath", benchSimdMath },
+	{ "particles", benchParticles },
+	{ "noise", benchNoise },
+};
+
+
+// benchmark results and command line options /////////////////////////////////////////////////////
+struct ResultT
+{
+	string name;
+	double value;          // time per iteration for microbenchmarks
+	string unit;
+	size_t iterations;     // 0 for suite results
+	double cpuTime;
+	double itemsPerSecond;
+};
+
+struct MicroT
+{
+	string name;
+	BenchFunctionT function;
+};
+
+vector<ResultT> RESULTS;
+string FILTER;
+string OUTPUT_FILE;
+string BASELINE_FILE;
+double MIN_TIME = 0.5;     // seconds per microbenchmark
+double THRESHOLD = 10.0;   // allowed regression in percent
+int    FAILED_CHECKS = 0;
+
+
+
+vector<MicroT>& getMicroBenchmarks(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// (function local, so registration from other translation units is order independent)
+	static vector<MicroT> benchmarks;
+	return benchmarks;
+}
+
+
+
+int benchRegister(const char* name, BenchFunctionT function)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	MicroT micro = { name, function };
+	getMicroBenchmarks().push_back(micro);
+	return int(getMicroBenchmarks().size());
+}
+
+
+
+void benchReport(const string& name, double value, const string& unit)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ResultT result = { name, value, unit, 0, 0.0, 0.0 };
+	RESULTS.push_back(result);
+
+	cout << "  " << left << setw(48) << name << right << setw(16) << fixed << setprecision(3)
+		<< value << " " << unit << endl;
+}
+
+
+
+void benchCheck(const string& name, double value, double limit, const string& unit)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	benchReport(name, value, unit);
+	if (value > limit)
+	{
+		cout << "Error: " << name << " exceeds the limit of " << limit << " " << unit << endl;
+		FAILED_CHECKS++;
+	}
+}
+
+
+
+bool isSelected(const string& name)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return FILTER.empty() || (name.find(FILTER) != string::npos);
+}
+
+
+
+void runMicroBenchmark(const MicroT& micro)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// grow the iteration count until the benchmark runs long enough (as Google Benchmark does)
+	size_t iterations = 1;
+	for (;;)
+	{
+		BenchState state(iterations);
+		clock_t cpuStart = clock();
+		BenchTimer timer;
+		micro.function(state);
+		double seconds = timer.getSeconds();
+		double cpuSeconds = double(clock() - cpuStart) / CLOCKS_PER_SEC;
+
+		if (seconds >= MIN_TIME || iterations >= 1000000000)
+		{
+			ResultT result = { micro.name, seconds * 1.0e9 / iterations, "ns", iterations,
+				cpuSeconds * 1.0e9 / iterations, state.getItemsPerIteration() * iterations / seconds };
+			RESULTS.push_back(result);
+
+			cout << "  " << left << setw(40) << micro.name << right << setw(14) << fixed
+				<< setprecision(2) << result.value << " ns" << setw(14) << result.cpuTime << " ns"
+				<< setw(12) << iterations;
+			if (result.itemsPerSecond > 0.0)
+			{
+				cout << setw(12) << setprecision(3) << result.itemsPerSecond * 1.0e-6 << " M items/s";
+			}
+			cout << endl;
+			return;
+		}
+
+		// predict the required iterations from this run (at most 10x more)
+		double factor = (seconds > 0.0) ? 1.4 * MIN_TIME / seconds : 10.0;
+		iterations = size_t(iterations * (factor > 10.0 ? 10.0 : factor)) + 1;
+	}
+}
+
+
+
+string escapeJSON(const string& text)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	string escaped;
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		if (text[i] == '"' || text[i] == '\\') escaped += '\\';
+		escaped += text[i];
+	}
+	return escaped;
+}
+
+
+
+void writeJSON(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ofstream file(filename.c_str());
+	if (!file)
+	{
+		cout << "Error: unable to write " << filename << endl;
+		return;
+	}
+
+	time_t now = time(NULL);
+	char date[32];
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+	// one benchmark per line, so readBaseline() does not need a full JSON parser
+	file << "{" << endl;
+	file << "  \"context\": { \"date\": \"" << date << "\", \"num_cpus\": "
+		<< thread::hardware_concurrency() << ", \"simd_level\": \""
+		<< CpuInfo::getLevelName(CpuInfo::getDetectedLevel()) << "\", \"library_build_type\": \""
+#ifdef NDEBUG
+		<< "release"
+#else
+		<< "debug"
+#endif
+		<< "\" }," << endl;
+	file << "  \"benchmarks\": [" << endl;
+	file << setprecision(9);
+	for (size_t i = 0; i < RESULTS.size(); ++i)
+	{
+		const ResultT& r = RESULTS[i];
+		file << "    { \"name\": \"" << escapeJSON(r.name) << "\", ";
+		if (r.iterations > 0)
+		{
+			file << "\"iterations\": " << r.iterations << ", \"real_time\": " << r.value
+				<< ", \"cpu_time\": " << r.cpuTime << ", \"time_unit\": \"ns\"";
+			if (r.itemsPerSecond > 0.0) file << ", \"items_per_second\": " << r.itemsPerSecond;
+		}
+		else
+		{
+			file << "\"value\": " << r.value << ", \"unit\": \"" << escapeJSON(r.unit) << "\"";
+		}
+		file << " }" << (i + 1 < RESULTS.size() ? "," : "") << endl;
+	}
+	file << "  ]" << endl << "}" << endl;
+	cout << "Results written to " << filename << endl;
+}
+
+
+
+bool findJSONValue(const string& line, const string& key, string& value)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t pos = line.find("\"" + key + "\":");
+	if (pos == string::npos) return false;
+
+	pos = line.find_first_not_of(" ", pos + key.size() + 3);
+	if (pos == string::npos) return false;
+	if (line[pos] == '"')
+	{
+		size_t end = pos + 1;
+		while (end < line.size() && (line[end] != '"' || line[end - 1] == '\\')) ++end;
+		value = line.substr(pos + 1, end - pos - 1);
+	}
+	else
+	{
+		value = line.substr(pos, line.find_first_of(",}", pos) - pos);
+	}
+	return true;
+}
+
+
+
+map<string, ResultT> readBaseline(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	map<string, ResultT> baseline;
+	ifstream file(filename.c_str());
+	if (!file)
+	{
+		cout << "Error: unable to read baseline " << filename << endl;
+		return baseline;
+	}
+
+	string line, name, value, unit;
+	while (getline(file, line))
+	{
+		if (!findJSONValue(line, "name", name)) continue;
+
+		ResultT result = { name, 0.0, "", 0, 0.0, 0.0 };
+		if (findJSONValue(line, "real_time", value))
+		{
+			result.value = atof(value.c_str());
+			result.unit = "ns";
+			result.iterations = 1;
+		}
+		else if (findJSONValue(line, "value", value) && findJSONValue(line, "unit", unit))
+		{
+			result.value = atof(value.c_str());
+			result.unit = unit;
+		}
+		else continue;
+		baseline[name] = result;
+	}
+	return baseline;
+}
+
+
+
+int compareBaseline(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	map<string, ResultT> baseline = readBaseline(filename);
+	int regressions = 0;
+
+	cout << "Comparison against " << filename << " (threshold " << fixed << setprecision(1) << THRESHOLD << "%)" << endl;
+	for (size_t i = 0; i < RESULTS.size(); ++i)
+	{
+		const ResultT& current = RESULTS[i];
+		map<string, ResultT>::const_iterator it = baseline.find(current.name);
+		if (it == baseline.end() || it->second.unit != current.unit || it->second.value == 0.0) continue;
+
+		// times are better when lower, rates (units per second) when higher, counts are skipped
+		const string& unit = current.unit;
+		bool rate = (unit.size() > 2) && (unit.compare(unit.size() - 2, 2, "/s") == 0);
+		bool time = (unit == "ns") || (unit == "us") || (unit == "ms") || (unit == "s") ||
+			(unit.compare(0, 3, "ns/") == 0);
+		if (!rate && !time) continue;
+
+		double change = 100.0 * (current.value - it->second.value) / it->second.value;
+		double slowdown = rate ? -change : change;
+		bool regression = (slowdown > THRESHOLD);
+		regressions += regression ? 1 : 0;
+
+		cout << "  " << left << setw(48) << current.name << right << setw(14) << fixed
+			<< setprecision(3) << it->second.value << setw(14) << current.value << " " << setw(10)
+			<< left << unit << right << showpos << setw(8) << setprecision(1) << change << "%"
+			<< noshowpos << (regression ? "  REGRESSION" : "") << endl;
+	}
+
+	cout << regressions << " regression(s)" << endl;
+	return regressions;
+}
+
+
+
+void printUsage(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	cout << "usage: CG-BENCH [suite|micro|microbenchmark ...] [--benchmark_filter=text]" << endl;
+	cout << "                [--benchmark_min_time=s] [--benchmark_out=results.json]" << endl;
+	cout << "                [--baseline=baseline.json] [--benchmark_threshold=percent] [--help]" << endl;
+
+	cout << "suites:";
+	for (size_t i = 0; i < sizeof(SUITES) / sizeof(SUITES[0]); ++i) cout << " " << SUITES[i].name;
+	cout << endl;
+
+	cout << "microbenchmarks (all with \"micro\"):";
+	vector<MicroT>& micros = getMicroBenchmarks();
+	for (size_t i = 0; i < micros.size(); ++i) cout << " " << micros[i].name;
+	cout << endl;
+}
+
+
+
+bool isKnownSelection(const string& name)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (name == "micro") return true;
+	for (size_t i = 0; i < sizeof(SUITES) / sizeof(SUITES[0]); ++i)
+	{
+		if (name == SUITES[i].name) return true;
+	}
+
+	vector<MicroT>& micros = getMicroBenchmarks();
+	for (size_t i = 0; i < micros.size(); ++i)
+	{
+		if (name == micros[i].name) return true;
+	}
+	return false;
+}
+
+
+
+bool parseCommandLine(int argc, char *argv[], vector<string>& suites)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		string option = argv[i];
+		string value = option.substr(option.find('=') + 1);
+
+		if (option.compare(0, 19, "--benchmark_filter=") == 0) FILTER = value;
+		else if (option.compare(0, 16, "--benchmark_out=") == 0) OUTPUT_FILE = value;
+		else if (option.compare(0, 21, "--benchmark_min_time=") == 0) MIN_TIME = atof(value.c_str());
+		else if (option.compare(0, 22, "--benchmark_threshold=") == 0) THRESHOLD = atof(value.c_str());
+		else if (option.compare(0, 11, "--baseline=") == 0) BASELINE_FILE = value;
+		else if (isKnownSelection(option)) suites.push_back(option);
+		else
+		{
+			cout << "Error: unknown option or benchmark \"" << option << "\"" << endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+
+
+int main(int argc, char *argv[])
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 1; i < argc; ++i)
+	{
+		if (string(argv[i]) == "--help")
+		{
+			printUsage();
+			return 0;
+		}
+	}
+
+	vector<string> selection;
+	if (!parseCommandLine(argc, argv, selection))
+	{
+		printUsage();
+		return 1;
+	}
+
+	cout << "CPU SIMD level: " << CpuInfo::getLevelName(CpuInfo::getDetectedLevel()) << endl;
+
+	// microbenchmarks run with "micro" or when given by name
+	vector<MicroT>& micros = getMicroBenchmarks();
+	bool runMicros = selection.empty();
+	for (size_t s = 0; s < selection.size(); ++s) runMicros |= (selection[s] == "micro");
+
+	vector<MicroT> selectedMicros;
+	for (size_t i = 0; i < micros.size(); ++i)
+	{
+		bool selected = runMicros;
+		for (size_t s = 0; s < selection.size(); ++s) selected |= (selection[s] == micros[i].name);
+		if (selected && isSelected(micros[i].name)) selectedMicros.push_back(micros[i]);
+	}
+
+	if (!selectedMicros.empty())
+	{
+		cout << "Microbenchmarks" << left << setw(39) << " " << right << setw(10) << "Time"
+			<< setw(17) << "CPU" << setw(12) << "Iterations" << endl;
+		for (size_t i = 0; i < selectedMicros.size(); ++i) runMicroBenchmark(selectedMicros[i]);
+		cout << endl;
+	}
+
+	// run all suites or only the ones given on the command line
+	for (size_t i = 0; i < sizeof(SUITES) / sizeof(SUITES[0]); ++i)
+	{
+		bool selected = selection.empty();
+		for (size_t s = 0; s < selection.size(); ++s) selected |= (SUITES[i].name == selection[s]);
+		if (!selected || !isSelected(SUITES[i].name)) continue;
+
+		cout << "Benchmark suite: " << SUITES[i].name << endl;
+		SUITES[i].run();
+		cout << endl;
+	}
+
+	if (!OUTPUT_FILE.empty()) writeJSON(OUTPUT_FILE);
+	int regressions = BASELINE_FILE.empty() ? 0 : compareBaseline(BASELINE_FILE);
+	if (FAILED_CHECKS > 0) cout << FAILED_CHECKS << " failed check(s)" << endl;
+	return (regressions > 0 || FAILED_CHECKS > 0) ? 1 : 0;
+}
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Tool: CG-BCN - Compresses images to BC1/BC3/BC5/BC7 texture containers (Ver 1.0)              //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <algorithm>
+using namespace std;
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/ImageDecoder.h"
+#include "../../_COMMON/inc/TextureCompressor.h"
+#include "../../_COMMON/inc/CpuInfo.h"
+
+
+typedef chrono::steady_clock ClockT;
+
+
+
+double compressLevels(TextureCompressor::FormatT format,
+	const vector<vector<unsigned char> >& images, const vector<int>& widths,
+	const vector<int>& heights, unsigned threads, vector<vector<unsigned char> >& levels)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	levels.resize(images.size());
+	ClockT::time_point start = ClockT::now();
+	for (size_t i = 0; i < images.size(); ++i)
+	{
+		levels[i].resize(TextureCompressor::getLevelSize(format, widths[i], heights[i]));
+		TextureCompressor::compress(format, &images[i][0], widths[i], heights[i], &levels[i][0],
+			threads);
+	}
+	return chrono::duration<double>(ClockT::now() - start).count();
+}
+
+
+
+int main(int argc, char *argv[])
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	TextureCompressor::FormatT format = TextureCompressor::FORMAT_BC7;
+	unsigned threads = 0;
+	bool mipmaps = true, benchmark = false;
+	vector<string> files;
+	for (int i = 1; i < argc; ++i)
+	{
+		string option = argv[i];
+		if (option == "-format" && (i + 1 < argc)
+			&& TextureCompressor::parseFormat(argv[i + 1], format)) ++i;
+		else if (option == "-threads" && (i + 1 < argc))
+			threads = unsigned(max(0, atoi(argv[++i])));
+		else if (option == "-nomips") mipmaps = false;
+		else if (option == "-benchmark") benchmark = true;
+		else files.push_back(option);
+	}
+
+	if (files.size() != (benchmark ? 1u : 2u))
+	{
+		cout << "Usage: CG-BCN [-format bc1|bc3|bc5|bc7] [-threads N] [-nomips] <image> <container>"
+			<< endl;
+		cout << "       CG-BCN -benchmark [-nomips] <image>" << endl;
+		cout << "       (PNG or JPEG images, default format BC7 with all mipmap levels)" << endl;
+		return 1;
+	}
+
+	// decode and build the mipmap chain
+	vector<vector<unsigned char> > images(1);
+	vector<int> widths(1), heights(1);
+	if (!ImageDecoder::decode(files[0], widths[0], heights[0], images[0]))
+	{
+		cout << "Error: unable to decode image " << files[0] << endl;
+		return 1;
+	}
+	int levelCount = mipmaps ? min(TextureCompressor::MAX_LEVELS,
+		ImageDecoder::getLevelCount(widths[0], heights[0])) : 1;
+	size_t pixels = size_t(widths[0]) * heights[0];
+	for (int level = 1; level < levelCount; ++level)
+	{
+		widths.push_back(max(1, widths[0] >> level));
+		heights.push_back(max(1, heights[0] >> level));
+		images.push_back(vector<unsigned char>(size_t(widths[level]) * heights[level] * 4));
+		ImageDecoder::downsample(&images[level - 1][0], widths[level - 1], heights[level - 1],
+			&images[level][0]);
+		pixels += size_t(widths[level]) * heights[level];
+	}
+
+	unsigned hardwareThreads = max(1u, thread::hardware_concurrency());
+	vector<vector<unsigned char> > levels;
+	cout << fixed << setprecision(1);
+
+	if (benchmark)
+	{
+		// throughput of every format: scalar and SSE2 on one thread, SSE2 on all threads
+		cout << "Image " << files[0] << ": " << widths[0] << "x" << heights[0] << ", " << levelCount
+			<< " levels, " << pixels << " pixels" << endl;
+		cout << "MPix/s   scalar     SSE2  SSE2 x " << hardwareThreads << endl;
+		CpuInfo::SimdLevelT detected = CpuInfo::getDetectedLevel();
+		for (int f = TextureCompressor::FORMAT_BC1; f <= TextureCompressor::FORMAT_BC7; ++f)
+		{
+			TextureCompressor::FormatT current = TextureCompressor::FormatT(f);
+			CpuInfo::setMaxLevel(CpuInfo::SL_SCALAR);
+			double scalar = compressLevels(current, images, widths, heights, 1, levels);
+			CpuInfo::setMaxLevel(detected);
+			double simd = compressLevels(current, images, widths, heights, 1, levels);
+			double parallel = compressLevels(current, images, widths, heights, hardwareThreads,
+				levels);
+			cout << TextureCompressor::getFormatName(current) << setw(11)
+				<< pixels * 1.0e-6 / scalar << setw(9) << pixels * 1.0e-6 / simd << setw(9)
+				<< pixels * 1.0e-6 / parallel << endl;
+		}
+		return 0;
+	}
+
+	double seconds = compressLevels(format, images, widths, heights, threads, levels);
+	if (!TextureCompressor::write(files[1], format, widths[0], heights[0], levels)) return 1;
+
+	size_t rgbaBytes = pixels * 4, compressedBytes = 0;
+	for (size_t i = 0; i < levels.size(); ++i) compressedBytes += levels[i].size();
+
+	cout << "Compressed " << files[0] << " (" << widths[0] << "x" << heights[0] << ", "
+		<< levelCount << " levels) to " << TextureCompressor::getFormatName(format) << " in "
+		<< seconds * 1000.0 << " ms: " << pixels * 1.0e-6 / seconds << " MPix/s on "
+		<< (threads ? threads : hardwareThreads) << " threads ("
+		<< ((CpuInfo::getLevel() >= CpuInfo::SL_SSE2) ? "SSE2" : "scalar") << ")" << endl;
+	cout << "VRAM: " << (compressedBytes >> 10) << " KB instead of " << (rgbaBytes >> 10)
+		<< " KB as RGBA8, saves " << ((rgbaBytes - compressedBytes) >> 10) << " KB ("
+		<< 100.0 * (rgbaBytes - compressedBytes) / rgbaBytes << " %)" << endl;
+	cout << "Written " << files[1] << endl;
+	return 0;
+}
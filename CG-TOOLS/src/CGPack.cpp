@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// Tool: CG-PACK - Packs shaders and assets into one ResourceBundle archive (Ver 1.0)            //
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../../_COMMON/inc/ResourceBundle.h"
+
+
+
+int main(int argc, char *argv[])
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// list the contents of an existing bundle
+	if (argc == 3 && string(argv[1]) == "-list")
+	{
+		ResourceBundle bundle;
+		if (!bundle.open(argv[2])) return 1;
+		for (size_t i = 0; i < bundle.getEntryCount(); ++i)
+		{
+			ResourceBundle::ViewT name = bundle.getName(i), data;
+			bundle.find(name.data, name.size, data);
+			cout << "  " << name.data << " (" << data.size << " bytes)" << endl;
+		}
+		return 0;
+	}
+
+	if (argc < 3)
+	{
+		cout << "Usage: CG-PACK <bundle> <root directory> <file> ..." << endl;
+		cout << "       CG-PACK -list <bundle>" << endl;
+		cout << "       (file names relative to the root directory)" << endl;
+		return 1;
+	}
+
+	vector<string> names(argv + 3, argv + argc);
+	if (!ResourceBundle::pack(argv[1], argv[2], names)) return 1;
+
+	cout << "Packed " << names.size() << " files into " << argv[1] << endl;
+	return 0;
+}
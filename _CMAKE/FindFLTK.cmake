@@ -18,9 +18,17 @@ if(WIN32)
 
     set(FLTK_LIBRARY "${FLTK_LIBRARIES_PATH}/Release/fltk.lib") 
     set(FLTK_GL_LIBRARY "${FLTK_LIBRARIES_PATH}/Release/fltk_gl.lib")
+    set(FLTK_IMAGES_LIBRARY "${FLTK_LIBRARIES_PATH}/Release/fltk_images.lib"
+                            "${FLTK_LIBRARIES_PATH}/Release/fltk_png.lib"
+                            "${FLTK_LIBRARIES_PATH}/Release/fltk_jpeg.lib"
+                            "${FLTK_LIBRARIES_PATH}/Release/fltk_z.lib")
     
     set(FLTK_LIBRARY_DEBUG "${FLTK_LIBRARIES_PATH}/Debug/fltkd.lib") 
     set(FLTK_GL_LIBRARY_DEBUG "${FLTK_LIBRARIES_PATH}/Debug/fltk_gld.lib")
+    set(FLTK_IMAGES_LIBRARY_DEBUG "${FLTK_LIBRARIES_PATH}/Debug/fltk_imagesd.lib"
+                                  "${FLTK_LIBRARIES_PATH}/Debug/fltk_pngd.lib"
+                                  "${FLTK_LIBRARIES_PATH}/Debug/fltk_jpegd.lib"
+                                  "${FLTK_LIBRARIES_PATH}/Debug/fltk_zd.lib")
  endif()
 
 if(UNIX)
@@ -29,9 +37,11 @@ if(UNIX)
 
     find_library(FLTK_LIBRARY          NAMES fltk             PATHS "${ARCH_LIBRARY_PATH}/Release" ${CMAKE_LIBRARY_PATH} PATH_SUFFIXES lib)
     find_library(FLTK_GL_LIBRARY       NAMES fltk_gl          PATHS "${ARCH_LIBRARY_PATH}/Release" ${CMAKE_LIBRARY_PATH} PATH_SUFFIXES lib)
+    find_library(FLTK_IMAGES_LIBRARY   NAMES fltk_images      PATHS "${ARCH_LIBRARY_PATH}/Release" ${CMAKE_LIBRARY_PATH} PATH_SUFFIXES lib)
     
     find_library(FLTK_LIBRARY_DEBUG    NAMES fltk       PATHS "${ARCH_LIBRARY_PATH}/Debug"   ${CMAKE_LIBRARY_PATH} PATH_SUFFIXES lib)
     find_library(FLTK_GL_LIBRARY_DEBUG NAMES fltk_gl PATHS "${ARCH_LIBRARY_PATH}/Debug"   ${CMAKE_LIBRARY_PATH} PATH_SUFFIXES lib)
+    find_library(FLTK_IMAGES_LIBRARY_DEBUG NAMES fltk_images PATHS "${ARCH_LIBRARY_PATH}/Debug" ${CMAKE_LIBRARY_PATH} PATH_SUFFIXES lib)
 endif()
 
 if(APPLE)
@@ -43,9 +53,11 @@ if(APPLE)
 
    set(FLTK_LIBRARY "${FLTK_LIBRARIES_PATH}/Release/libfltk.a") 
    set(FLTK_GL_LIBRARY "${FLTK_LIBRARIES_PATH}/Release/libfltk_gl.a")
+   set(FLTK_IMAGES_LIBRARY "${FLTK_LIBRARIES_PATH}/Release/libfltk_images.a")
 
    set(FLTK_LIBRARY_DEBUG "${FLTK_LIBRARIES_PATH}/Debug/libfltk.a") 
    set(FLTK_GL_LIBRARY_DEBUG "${FLTK_LIBRARIES_PATH}/Debug/libfltk_gl.a")
+   set(FLTK_IMAGES_LIBRARY_DEBUG "${FLTK_LIBRARIES_PATH}/Debug/libfltk_images.a")
 endif()
 
 # locate header files and put user specified location at beginning of search
@@ -63,7 +75,17 @@ FIND_PACKAGE_HANDLE_STANDARD_ARGS(FLTK DEFAULT_MSG FLTK_LIBRARY FLTK_LIBRARY_DEB
 
 if(FLTK_FOUND)
    set(FLTK_INCLUDE_DIRS ${FLTK_INCLUDE_DIR})
-   set(FLTK_LIBRARIES ${FLTK_LIBRARY} ${FLTK_GL_LIBRARY})
-   set(FLTK_LIBRARIES_DEBUG ${FLTK_LIBRARY_DEBUG} ${FLTK_GL_LIBRARY_DEBUG})
+   set(FLTK_LIBRARIES ${FLTK_IMAGES_LIBRARY} ${FLTK_LIBRARY} ${FLTK_GL_LIBRARY})
+   set(FLTK_LIBRARIES_DEBUG ${FLTK_IMAGES_LIBRARY_DEBUG} ${FLTK_LIBRARY_DEBUG} ${FLTK_GL_LIBRARY_DEBUG})
+
+   # the image decoders (Fl_PNG_Image, Fl_JPEG_Image) of the unix builds use the system libraries
+   if(UNIX)
+      find_package(PNG)
+      find_package(JPEG)
+      if(PNG_FOUND AND JPEG_FOUND)
+         list(APPEND FLTK_LIBRARIES ${PNG_LIBRARIES} ${JPEG_LIBRARIES})
+         list(APPEND FLTK_LIBRARIES_DEBUG ${PNG_LIBRARIES} ${JPEG_LIBRARIES})
+      endif()
+   endif(UNIX)
 endif(FLTK_FOUND)
 
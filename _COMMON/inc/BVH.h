@@ -0,0 +1,120 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   BVH.h
+//
+//  \brief      Bounding volume hierarchy over triangle meshes for CPU ray picking.
+//
+//   Usage:     build() creates a binary hierarchy with the binned surface area heuristic (SAH)
+//              and collapses it into a 4-wide hierarchy. intersect() traverses it with an
+//              explicit stack, testing the four child boxes of a node at once with SSE (if
+//              GLM_ARCH provides it, otherwise with a scalar loop). Use
+//              TrackBall::unprojectMouse() to create the pick ray for a mouse position.
+//
+//              Skewed inputs would let the SAH build grow arbitrarily deep. Once object median
+//              splits are the only way left to reach the leaves within MAX_DEPTH levels, the
+//              build uses them, which bounds the size of the traversal stack.
+//
+//              The hit record matches glm::intersectRayTriangle() (GLM_GTX_intersect):
+//              two sided triangles, barycentric coordinates and the ray parameter.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef BVH_H
+#define BVH_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cfloat>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "Mesh.h"
+
+
+
+class BVH
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct HitT
+	{
+		float     distance;     // ray parameter (distance for normalized directions)
+		glm::vec2 barycentric;  // weights of the second and third triangle vertex
+		GLuint    triangle;     // triangle index of the source mesh
+	};
+
+	BVH(void);
+
+	void   build(const Mesh& mesh);
+	void   build(const glm::vec3* positions, const GLuint* indices, GLsizei triangleCount);
+
+	bool   intersect(const glm::vec3& origin, const glm::vec3& direction, HitT& hit,
+			float maxDistance = FLT_MAX) const;
+
+	GLsizei getNodeCount(void) const { return GLsizei(_Nodes.size()); };
+	GLsizei getTriangleCount(void) const { return GLsizei(_Triangles.size()); };
+	int     getDepth(void) const { return _Depth; };
+
+	// reference: test all triangles of a mesh with glm::intersectRayTriangle()
+	static bool intersectBruteForce(const Mesh& mesh, const glm::vec3& origin,
+			const glm::vec3& direction, HitT& hit, float maxDistance = FLT_MAX);
+
+private:
+	static const int    MAX_LEAF_SIZE = 4;
+	static const int    SAH_BINS = 16;
+	static const int    MAX_DEPTH = 48;                   // binary build levels
+	static const int    STACK_SIZE = 3 * MAX_DEPTH + 4;   // 3 entries per 4-wide level + 4
+	static const GLuint LEAF_BIT = 0x80000000u;
+	static const GLuint EMPTY = 0xffffffffu;
+
+	// 4-wide node: child boxes in structure of arrays layout (minX, minY, minZ, maxX, maxY, maxZ)
+	struct NodeT
+	{
+		float  bounds[6][4];
+		GLuint child[4];       // node index, LEAF_BIT | first << 3 | count, or EMPTY
+	};
+
+	// precomputed triangle (vertex and edges) for the Moeller-Trumbore test
+	struct TriangleT
+	{
+		glm::vec3 v0, e1, e2;
+		GLuint    id;
+	};
+
+	// binary build node
+	struct BuildNodeT
+	{
+		glm::vec3 minimum, maximum;
+		GLuint    left, right;   // children (interior nodes)
+		GLuint    first, count;  // triangle range (leaf nodes, count > 0)
+	};
+
+	struct BuildDataT;
+
+	GLuint buildRecursive(BuildDataT& data, GLuint first, GLuint count, int depth);
+	GLuint collapse(const std::vector<BuildNodeT>& nodes, GLuint node, int depth);
+	bool   intersectLeaf(GLuint leaf, const glm::vec3& origin, const glm::vec3& direction,
+			HitT& hit) const;
+
+	std::vector<NodeT>     _Nodes;
+	std::vector<TriangleT> _Triangles;
+	int                    _Depth;
+};
+// class BVH //////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // BVH_H
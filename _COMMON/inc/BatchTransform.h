@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   BatchTransform.h
+//
+//  \brief      Batched matrix transforms of vector and matrix streams with SSE2, AVX2 and
+//              AVX-512 kernels selected at runtime.
+//
+//   Usage:     transform() applies one matrix to an array of glm::vec4 (the batched version of
+//              glm_mat4_mul_vec4), multiply() computes out[i] = a[i] * b[i] for matrix arrays.
+//              transformSoA() works on transposed streams (one float array per component) as
+//              used for skinning, culling and CPU vertex processing; it transforms 4, 8 or 16
+//              vectors per instruction without any shuffles.
+//
+//              The kernel set is chosen once from CpuInfo::getLevel(), so a binary compiled for
+//              SSE2 uses AVX2/FMA or AVX-512 where available. All pointers may be unaligned, but
+//              arrays from allocate() (64 byte aligned) avoid split cache lines. Input and
+//              output arrays may be identical.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef BATCHTRANSFORM_H
+#define BATCHTRANSFORM_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "CpuInfo.h"
+
+
+
+class BatchTransform
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	// transposed vector stream, w may be NULL for points (w = 1)
+	struct StreamT
+	{
+		float* x;
+		float* y;
+		float* z;
+		float* w;
+	};
+
+	static void   transform(const glm::mat4& matrix, const glm::vec4* in, glm::vec4* out, size_t count);
+	static void   multiply(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count);
+	static void   transformSoA(const glm::mat4& matrix, const StreamT& in, const StreamT& out, size_t count);
+
+	static void*  allocate(size_t bytes);
+	static void   release(void* memory);
+
+	static CpuInfo::SimdLevelT getLevel(void);
+};
+// class BatchTransform ///////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // BATCHTRANSFORM_H
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ClusteredLighting.h
+//
+//  \brief      Clustered light assignment: bins point and spot lights into a 3D grid of view
+//              frustum cells (froxels) and provides the per-cluster light index lists in
+//              shader storage buffers for forward shading.
+//
+//   Usage:     init() creates the grid of tilesX x tilesY screen tiles and slices depth slices
+//              (exponentially spaced between the near and far plane of the projection, so the
+//              clusters stay roughly cubic) and the buffers. update() is called every frame
+//              with the projection, the model view matrix (e.g. of the TrackBall) and the
+//              lights in model coordinates: it transforms the lights to view coordinates,
+//              rebuilds the cluster bounds if the projection changed and assigns every light
+//              to the clusters its bounding sphere (cone bounding sphere of spot lights)
+//              overlaps, either with the compute program given to init() (MODE_GPU) or on the
+//              CPU with SSE2 (MODE_CPU, scalar without SSE2). Only perspective projections are
+//              supported. Both modes produce the same lists (lights in ascending order, at most
+//              MAX_CLUSTER_LIGHTS per cluster), only the order of the lists in the index buffer
+//              differs.
+//
+//              bind() binds the buffers for the shading pass; the fragment shader finds its
+//              cluster from gl_FragCoord and the view depth and loops over the lights of the
+//              cluster only, so the shading cost depends on the lights per cluster and not on
+//              the total light count. Bindings (see glsl/clusters.glsl of the demo):
+//                 uniform buffer 0          grid size, light count and depth slicing
+//                 shader storage buffer 0   lights in view coordinates
+//                 shader storage buffer 1   cluster bounds in view coordinates (min, max)
+//                 shader storage buffer 2   offset and count of every cluster's light list
+//                 shader storage buffer 3   index count and overflow flag followed by the
+//                                           light indices
+//
+//              getStatistics() reads the lists back in MODE_GPU and therefore waits for the
+//              dispatch, readClusters() returns all lists (for validation and debugging).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef CLUSTEREDLIGHTING_H
+#define CLUSTEREDLIGHTING_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+
+class ClusteredLighting
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum ModeT { MODE_GPU, MODE_CPU };
+
+	// light in model coordinates
+	struct LightT
+	{
+		glm::vec4 position;    // xyz position, w range (the light falls off to zero)
+		glm::vec4 color;       // rgb intensity, w cosine of the spot cone angle (-1 point light)
+		glm::vec4 direction;   // xyz spot direction, w unused
+	};
+
+	struct StatisticsT
+	{
+		int    lights;
+		int    clusters;
+		int    activeClusters;     // clusters with at least one light
+		int    maxClusterLights;   // longest list
+		size_t indices;            // entries of all lists
+		bool   overflow;           // a list or the index buffer was full
+		double milliseconds;       // assignment time on the CPU or the GPU (last finished one)
+	};
+
+	static const int    MAX_CLUSTER_LIGHTS = 128;
+	static const GLuint PARAMETER_BINDING = 0;   // uniform buffer binding
+	static const GLuint LIGHT_BINDING = 0;       // shader storage buffer bindings
+	static const GLuint BOUNDS_BINDING = 1;
+	static const GLuint GRID_BINDING = 2;
+	static const GLuint INDEX_BINDING = 3;
+
+	ClusteredLighting(void);
+	~ClusteredLighting(void);
+
+	bool  init(int tilesX, int tilesY, int slices, size_t indexCapacity, GLuint program = 0);
+	void  release(void);
+
+	void  setMode(ModeT mode) { _Mode = _Program ? mode : MODE_CPU; };
+	ModeT getMode(void) const { return _Mode; };
+
+	bool  update(const glm::mat4& projection, const glm::mat4& modelView, GLsizei width,
+	             GLsizei height, const std::vector<LightT>& lights);
+	void  bind(void) const;
+
+	int   getClusterCount(void) const { return _TilesX * _TilesY * _Slices; };
+	int   getClusterIndex(int tileX, int tileY, int slice) const;
+	void  readClusters(std::vector<std::vector<GLuint> >& clusters) const;
+	StatisticsT getStatistics(void);
+	void  report(std::ostream& out);
+
+private:
+	// light buffer entry, the bounds are the (cone) bounding sphere used for the assignment
+	struct ShaderLightT
+	{
+		glm::vec4 position;
+		glm::vec4 color;
+		glm::vec4 direction;
+		glm::vec4 bounds;   // xyz center, w radius
+	};
+
+	// uniform buffer (std140)
+	struct ParametersT
+	{
+		GLuint  grid[4];      // tiles x, tiles y, slices, lights
+		GLfloat slicing[4];   // slice = log(depth) * scale + bias, viewport width and height
+		GLuint  limits[4];    // index capacity, MAX_CLUSTER_LIGHTS
+	};
+
+	enum BufferT { BUFFER_PARAMETERS, BUFFER_LIGHTS, BUFFER_BOUNDS, BUFFER_GRID, BUFFER_INDICES,
+	               BUFFER_COUNT };
+
+	bool  buildClusters(const glm::mat4& projection);
+	void  transformLights(const glm::mat4& modelView, const std::vector<LightT>& lights);
+	void  assignCPU(void);
+	void  assignGPU(void);
+	void  readTimer(bool wait);
+	int   getSlice(float depth) const;
+
+	ClusteredLighting(const ClusteredLighting&);
+	ClusteredLighting& operator=(const ClusteredLighting&);
+
+	int      _TilesX;
+	int      _TilesY;
+	int      _Slices;
+	int      _RowStride;       // SoA bounds per tile row, padded to a multiple of 4
+	size_t   _IndexCapacity;
+	GLuint   _Program;
+	ModeT    _Mode;
+	GLuint   _Buffers[BUFFER_COUNT];
+	GLuint   _Queries[2];     // timestamps around the dispatch
+	bool     _QueryPending;
+	double   _Milliseconds;
+	glm::mat4   _Projection;   // of the current cluster bounds
+	ParametersT _Parameters;
+
+	std::vector<ShaderLightT> _Lights;
+	std::vector<glm::vec4>    _Positions;    // transform staging
+	std::vector<glm::vec4>    _Directions;
+
+	// cluster bounds as structure of arrays (padding entries are empty boxes) and the bounds
+	// of every tile column and row per slice to restrict the tiles tested per light
+	std::vector<float> _MinX, _MinY, _MinZ, _MaxX, _MaxY, _MaxZ;
+	std::vector<float> _ColumnMin, _ColumnMax, _RowMin, _RowMax;
+	std::vector<float> _SliceDepths;   // slices + 1 boundaries
+
+	// CPU assignment: fixed slots per cluster, compacted into grid and index list
+	std::vector<GLuint> _Counts;
+	std::vector<GLuint> _Slots;
+	std::vector<GLuint> _Grid;
+	std::vector<GLuint> _Indices;   // index count and overflow flag followed by the indices
+};
+// class ClusteredLighting ////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // CLUSTEREDLIGHTING_H
@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   CompressedTexture.h
+//
+//  \brief      Loads block compressed textures (BC1/BC3/BC5/BC7 containers of the CG-BCN tool)
+//              straight from a memory mapping.
+//
+//   Usage:     load() looks the container up in the mounted ResourceBundle or maps the file,
+//              allocates immutable storage (glTexStorage2D) in the compressed format and
+//              passes every mipmap level to glCompressedTexSubImage2D() as pointer into the
+//              mapping, so the blocks are read from the page cache without an intermediate
+//              copy. The GL_PIXEL_UNPACK_BUFFER binding has to be 0.
+//
+//              getStatistics() sums the VRAM of the loaded textures and of the same textures
+//              as RGBA8 (with the same mipmap levels).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef COMPRESSEDTEXTURE_H
+#define COMPRESSEDTEXTURE_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "TextureCompressor.h"
+
+
+
+class CompressedTexture
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct StatisticsT
+	{
+		size_t textures;
+		size_t compressedBytes;   // VRAM of the block data
+		size_t rgbaBytes;         // VRAM the same levels would need as RGBA8
+	};
+
+	static GLuint load(const std::string& filename);
+
+	static GLenum getInternalFormat(TextureCompressor::FormatT format);
+	static bool   isSupported(TextureCompressor::FormatT format);
+
+	static const StatisticsT& getStatistics(void) { return _Statistics; };
+
+private:
+	static StatisticsT _Statistics;
+};
+// class CompressedTexture ////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // COMPRESSEDTEXTURE_H
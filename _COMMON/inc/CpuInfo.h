@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   CpuInfo.h
+//
+//  \brief      Runtime detection of the SIMD instruction sets supported by CPU and OS.
+//
+//   Usage:     getLevel() returns the best usable level (queried once with cpuid and xgetbv).
+//              Code compiled for several instruction sets selects its variant with it at
+//              runtime, independent of the GLM_ARCH compile time setting. setMaxLevel() limits
+//              the reported level, e.g. to compare the variants in benchmarks; the environment
+//              variable CG_SIMD_LEVEL (sse2, avx2 or avx512) does the same at startup.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef CPUINFO_H
+#define CPUINFO_H
+
+
+
+// GCC and Clang compile single functions for other instruction sets with target attributes,
+// MSVC accepts all intrinsics without special compiler options
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CG_TARGET_AVX2     __attribute__((target("avx2,fma")))
+#define CG_TARGET_AVX512   __attribute__((target("avx512f,avx2,fma")))
+#define CG_SIMD_X86 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define CG_TARGET_AVX2
+#define CG_TARGET_AVX512
+#define CG_SIMD_X86 1
+#else
+#define CG_TARGET_AVX2
+#define CG_TARGET_AVX512
+#define CG_SIMD_X86 0
+#endif
+
+
+
+class CpuInfo
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum SimdLevelT { SL_SCALAR, SL_SSE2, SL_AVX2, SL_AVX512 };
+
+	static SimdLevelT  getLevel(void);
+	static SimdLevelT  getDetectedLevel(void);
+	static void        setMaxLevel(SimdLevelT level);
+	static const char* getLevelName(SimdLevelT level);
+
+private:
+	static SimdLevelT  detect(void);
+
+	static SimdLevelT  _MaxLevel;
+};
+// class CpuInfo //////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // CPUINFO_H
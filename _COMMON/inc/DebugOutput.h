@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   DebugOutput.h
+//
+//  \brief      OpenGL debug output (KHR_debug) with filters, rate limiting of repeated
+//              messages and an asynchronous background logger.
+//
+//   Usage:     init() registers the debug message callback. In MODE_SYNCHRONOUS (default of
+//              debug builds) the driver calls back on the GL thread right inside the offending
+//              GL call and the message is printed immediately, so a breakpoint shows the
+//              culprit. In MODE_ASYNCHRONOUS (default of release builds, NDEBUG) the driver may
+//              call back from any thread; the callback only copies the message into a bounded
+//              lock-free queue and a background thread formats and prints it.
+//
+//              Filters are passed to the driver with glDebugMessageControl(), so filtered
+//              messages are not even generated: setMinSeverity() (notifications are off by
+//              default), setSourceEnabled(), setTypeEnabled() and setIdEnabled().
+//
+//              Every message id (per source and type) may be logged maxMessages times per
+//              interval (setRateLimit()), further repetitions are only counted and reported as
+//              one "repeated N times" line when the interval ends. Ids are hashed into a fixed
+//              table of RATE_SLOTS counters, colliding ids share their limit.
+//
+//              shutdown() (registered with atexit() by init()) drains the queue, stops the
+//              logger and prints the statistics.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef DEBUGOUTPUT_H
+#define DEBUGOUTPUT_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <atomic>
+#include <thread>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+
+class DebugOutput
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum ModeT { MODE_SYNCHRONOUS, MODE_ASYNCHRONOUS };
+
+	struct StatisticsT
+	{
+		size_t received;     // callbacks from the driver
+		size_t logged;       // messages printed
+		size_t repeated;     // repetitions suppressed by the rate limit
+		size_t dropped;      // messages lost because the queue was full
+	};
+
+#ifdef NDEBUG
+	static const ModeT DEFAULT_MODE = MODE_ASYNCHRONOUS;
+#else
+	static const ModeT DEFAULT_MODE = MODE_SYNCHRONOUS;
+#endif
+
+	static bool   init(ModeT mode = DEFAULT_MODE);
+	static void   shutdown(void);
+	static ModeT  getMode(void) { return _Mode; };
+
+	static void   setMinSeverity(GLenum severity);
+	static void   setSourceEnabled(GLenum source, bool enabled);
+	static void   setTypeEnabled(GLenum type, bool enabled);
+	static void   setIdEnabled(GLenum source, GLenum type, GLuint id, bool enabled);
+	static void   setRateLimit(unsigned maxMessages, unsigned intervalMilliseconds);
+
+	static StatisticsT getStatistics(void);
+
+	static const char* getSourceName(GLenum source);
+	static const char* getTypeName(GLenum type);
+	static const char* getSeverityName(GLenum severity);
+
+private:
+	static const size_t QUEUE_SIZE = 1024;   // power of two
+	static const size_t MESSAGE_LENGTH = 256;
+	static const size_t RATE_SLOTS = 256;    // power of two
+
+	struct MessageT
+	{
+		GLenum   source;
+		GLenum   type;
+		GLenum   severity;
+		GLuint   id;
+		unsigned repeated;   // > 0: summary of suppressed repetitions
+		char     text[MESSAGE_LENGTH];
+	};
+
+	struct QueueSlotT
+	{
+		std::atomic<size_t> sequence;
+		MessageT message;
+	};
+
+	struct RateSlotT
+	{
+		std::atomic<GLuint64> key;
+		std::atomic<unsigned> count;
+	};
+
+	static void GLAPIENTRY callback(GLenum source, GLenum type, GLuint id, GLenum severity,
+			GLsizei length, const GLchar* message, const void* userParam);
+	static void   dispatch(const MessageT& message);
+	static bool   enqueue(const MessageT& message);
+	static bool   dequeue(MessageT& message);
+	static void   print(const MessageT& message);
+	static void   endInterval(GLint64 now);
+	static void   runLogger(void);
+
+	static ModeT  _Mode;
+	static bool   _Initialized;
+	static std::thread* _Logger;
+	static std::atomic<bool> _Running;
+
+	static QueueSlotT _Queue[QUEUE_SIZE];
+	static std::atomic<size_t> _QueueTail;   // producers (driver threads)
+	static size_t _QueueHead;                // consumer (logger thread)
+
+	static RateSlotT _Rates[RATE_SLOTS];
+	static std::atomic<GLint64> _IntervalStart;
+	static unsigned _MaxMessages;
+	static unsigned _Interval;
+
+	static std::atomic<size_t> _Received;
+	static std::atomic<size_t> _Logged;
+	static std::atomic<size_t> _Repeated;
+	static std::atomic<size_t> _Dropped;
+};
+// class DebugOutput //////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // DEBUGOUTPUT_H
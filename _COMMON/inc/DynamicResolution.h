@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   DynamicResolution.h
+//
+//  \brief      Dynamic resolution scaling: the scene is rendered into an offscreen target
+//              whose resolution follows the measured GPU time of the scene and is upscaled to
+//              the window with a sharpening pass.
+//
+//   Usage:     init() takes the upscale program (fullscreen triangle and sharpening fragment
+//              shader, e.g. glsl/helloglsl_fullscreen.vert and glsl/helloglsl_upscale.frag of
+//              the demo, owned by the caller) and setBudget() the GPU time in milliseconds the
+//              scene may take. Every frame the scene is rendered between begin() (binds the
+//              target and sets the viewport of the scaled size, getWidth() and getHeight()
+//              return it for projections and viewports of the scene) and end() (upscales into
+//              the framebuffer bound before begin(), normally the default framebuffer, and
+//              restores the window viewport).
+//
+//              The target is allocated at window size and the scaled image uses its lower
+//              left part, so a scale change costs no reallocation. The scene time is measured
+//              with GL_TIME_ELAPSED queries read back a few frames later (without
+//              ARB_timer_query the CPU frame time between begin() calls is used instead) and
+//              drives a PID controller (velocity form) of the scale:
+//
+//                 error      headroom relative to the budget, (budget - time) / budget,
+//                            zero within a dead band of +-DEAD_BAND around the budget
+//                 target     changed by the proportional, integral and derivative terms of
+//                            the error and clamped to the scale range, which also stops the
+//                            integral from winding up
+//                 hysteresis the applied scale follows the target only when they differ by
+//                            at least SCALE_STEP; measurements of frames rendered with another
+//                            scale are dropped
+//
+//              getStatistics() and report() show the current scale, the render size, the
+//              last measured time and the number of scale changes.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef DYNAMICRESOLUTION_H
+#define DYNAMICRESOLUTION_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+
+class DynamicResolution
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct StatisticsT
+	{
+		float   scale;           // applied scale of both dimensions
+		float   targetScale;     // controller output
+		GLsizei width;           // render size
+		GLsizei height;
+		double  milliseconds;    // last measured scene (GPU) or frame (CPU) time
+		double  budget;
+		int     changes;         // applied scale changes since init()
+		bool    gpuTiming;
+	};
+
+	static const float DEAD_BAND;    // relative error without correction
+	static const float SCALE_STEP;   // smallest applied scale change
+
+	DynamicResolution(void);
+	~DynamicResolution(void);
+
+	bool    init(GLuint program);
+	void    release(void);
+
+	void    setBudget(double milliseconds) { _Statistics.budget = milliseconds; };
+	double  getBudget(void) const { return _Statistics.budget; };
+	void    setScaleRange(float minimum, float maximum);
+	void    setSharpness(float sharpness) { _Sharpness = sharpness; };
+
+	void    begin(GLsizei width, GLsizei height);
+	void    end(void);
+
+	float   getScale(void) const { return _Statistics.scale; };
+	GLsizei getWidth(void) const { return _Statistics.width; };
+	GLsizei getHeight(void) const { return _Statistics.height; };
+	const   StatisticsT& getStatistics(void) const { return _Statistics; };
+	void    report(std::ostream& out) const;
+
+private:
+	static const int QUERY_COUNT = 4;   // frames in flight for the GPU timer queries
+
+	typedef std::chrono::steady_clock ClockT;
+
+	bool    resize(GLsizei width, GLsizei height);
+	void    readQueries(void);
+	void    control(double milliseconds);
+
+	DynamicResolution(const DynamicResolution&);
+	DynamicResolution& operator=(const DynamicResolution&);
+
+	GLuint  _Program;
+	GLuint  _Framebuffer;
+	GLuint  _ColorTexture;
+	GLuint  _DepthBuffer;
+	GLuint  _VertexArray;           // empty, the fullscreen triangle has no attributes
+	GLuint  _WindowFramebuffer;     // bound before begin(), restored by end()
+	GLsizei _TargetWidth;           // allocated size (window size)
+	GLsizei _TargetHeight;
+	float   _MinScale;
+	float   _MaxScale;
+	float   _Sharpness;
+	GLint   _ScaleLocation;         // uniforms of the upscale program
+	GLint   _TexelLocation;
+	GLint   _SharpnessLocation;
+	float   _Errors[2];             // previous two errors of the controller
+	bool    _GPUTiming;
+	GLuint  _Queries[QUERY_COUNT];
+	float   _QueryScales[QUERY_COUNT];   // scale of the pending query or 0
+	int     _NextQuery;
+	bool    _Timing;                // begin() started a query
+	bool    _FrameStarted;          // CPU timing: a previous begin() exists
+	ClockT::time_point _FrameStart;
+	StatisticsT _Statistics;
+};
+// class DynamicResolution ////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // DYNAMICRESOLUTION_H
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ErrorCheck.h
+//
+//  \brief      OpenGL error checking with selectable cost: none, sampled every Nth frame,
+//              per scope (debug groups) or after every check point.
+//
+//   Usage:     glGetError() forces a client/server synchronization on many drivers, so the
+//              render loop must not call it after every draw in release builds. Check points
+//              are placed with the macros below and their cost depends on the level:
+//
+//                 LEVEL_NONE      no checks at all
+//                 LEVEL_SAMPLED   check points and scopes are checked in every Nth frame only
+//                 LEVEL_SCOPED    single check points are skipped, every CG_GL_SCOPE() pushes
+//                                 a debug group (names the scope in debug output messages)
+//                                 and checks once when it ends
+//                 LEVEL_FULL      every check point and scope is checked (debug default)
+//
+//              beginFrame() is called once per frame and decides whether the frame is checked.
+//              A disabled check point costs one test of a static flag. Compiling with
+//              CG_GL_ERROR_CHECKS=0 removes the check points and scopes completely.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef ERRORCHECK_H
+#define ERRORCHECK_H
+
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+
+// check points and scopes (compiled out with CG_GL_ERROR_CHECKS=0)
+#ifndef CG_GL_ERROR_CHECKS
+#define CG_GL_ERROR_CHECKS 1
+#endif
+
+#define CG_GL_SCOPE_JOIN(name, line)   name##line
+#define CG_GL_SCOPE_NAME(name, line)   CG_GL_SCOPE_JOIN(name, line)
+
+#if CG_GL_ERROR_CHECKS
+#define CG_GL_CHECK(label) \
+	do { if (ErrorCheck::isPointActive()) ErrorCheck::check(label, __FILE__, __LINE__); } while (0)
+#define CG_GL_SCOPE(label) \
+	ErrorCheck::ScopeT CG_GL_SCOPE_NAME(glScope, __LINE__)(label, __FILE__, __LINE__)
+#else
+#define CG_GL_CHECK(label)   ((void) 0)
+#define CG_GL_SCOPE(label)   ((void) 0)
+#endif
+
+
+
+class ErrorCheck
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum LevelT { LEVEL_NONE, LEVEL_SAMPLED, LEVEL_SCOPED, LEVEL_FULL };
+
+#ifdef NDEBUG
+	static const LevelT DEFAULT_LEVEL = LEVEL_SAMPLED;
+#else
+	static const LevelT DEFAULT_LEVEL = LEVEL_FULL;
+#endif
+
+	class ScopeT
+	{
+	public:
+		ScopeT(const char* label, const char* file, int line);
+		~ScopeT(void);
+
+	private:
+		const char* _Label;
+		const char* _File;
+		int         _Line;
+		bool        _Active;
+		bool        _Group;
+	};
+
+	static void   setLevel(LevelT level, unsigned sampleInterval = 60);
+	static LevelT getLevel(void) { return _Level; };
+	static bool   parseLevel(const char* name, LevelT& level);
+
+	static void   beginFrame(void);
+	static bool   isPointActive(void) { return _PointsActive; };
+	static bool   isScopeActive(void) { return _ScopesActive; };
+	static bool   check(const char* label, const char* file, int line);
+
+	static size_t getCheckCount(void) { return _Checks; };
+	static size_t getErrorCount(void) { return _Errors; };
+
+private:
+	static void   update(void);
+
+	static LevelT   _Level;
+	static unsigned _SampleInterval;
+	static size_t   _Frame;
+	static bool     _PointsActive;
+	static bool     _ScopesActive;
+	static size_t   _Checks;
+	static size_t   _Errors;
+};
+// class ErrorCheck ///////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // ERRORCHECK_H
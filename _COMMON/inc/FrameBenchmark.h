@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   FrameBenchmark.h
+//
+//  \brief      End-to-end frame benchmark: scripted scene and camera path, warmup, frame time
+//              statistics with CPU/GPU split and draw call counts.
+//
+//   Usage:     loadScene() reads a scene description (see below). The application calls
+//              beginFrame() at the start of every display callback, which returns false once
+//              all frames are measured, renders the scene with getCameraTransformation(),
+//              counts its draws with addDrawCalls() and calls endFrame() before swapping the
+//              buffers. report() prints mean, median, 95th and 99th percentile of the frame,
+//              CPU and GPU times, writeJSON() stores them in the CG-BENCH result format.
+//
+//              Frame time is measured between consecutive beginFrame() calls, CPU time from
+//              beginFrame() to endFrame() and GPU time with GL_TIME_ELAPSED queries that are
+//              read back a few frames later, so the measurement does not stall the pipeline.
+//              Without ARB_timer_query the GPU column is omitted. With Mesa (e.g. llvmpipe)
+//              set vblank_mode=0 to measure without vertical sync.
+//
+//              Scene file (one keyword per line, '#' starts a comment):
+//                objects   <N>                    number of objects placed on a grid
+//                triangles <M>                    triangles per object (sphere tessellation)
+//                warmup    <frames>               frames rendered before measuring
+//                frames    <K>                    measured frames
+//                camera    <frame> <yaw> <pitch> <zoom>
+//                                                 camera key frame (angles in degrees),
+//                                                 linearly interpolated, the path repeats
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Scenes served from the mounted ResourceBundle
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef FRAMEBENCHMARK_H
+#define FRAMEBENCHMARK_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <string>
+#include <chrono>
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+
+class FrameBenchmark
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct KeyFrameT
+	{
+		float frame;
+		float yaw;     // degrees around the y axis
+		float pitch;   // degrees around the x axis
+		float zoom;
+	};
+
+	struct SceneT
+	{
+		GLsizei objectCount;
+		GLsizei triangleCount;   // per object
+		int     warmupFrames;
+		int     frameCount;
+		std::vector<KeyFrameT> path;
+	};
+
+	struct StatisticsT
+	{
+		double mean;
+		double median;
+		double p95;
+		double p99;
+		double minimum;
+		double maximum;
+	};
+
+	FrameBenchmark(void);
+	~FrameBenchmark(void);
+
+	bool   loadScene(const std::string& filename);
+	const  SceneT& getScene(void) const { return _Scene; };
+
+	bool   beginFrame(void);
+	void   addDrawCalls(GLsizei drawCalls, GLsizei triangles);
+	void   endFrame(void);
+
+	int    getFrame(void) const { return _Frame; };
+	glm::mat4 getCameraTransformation(void) const;
+
+	void   report(std::ostream& out) const;
+	bool   writeJSON(const std::string& filename) const;
+
+	static StatisticsT computeStatistics(std::vector<double> samples);
+
+private:
+	static const int QUERY_COUNT = 8;   // frames in flight for the GPU timer queries
+
+	typedef std::chrono::high_resolution_clock ClockT;
+
+	void   readQueries(bool wait);
+	void   release(void);
+
+	FrameBenchmark(const FrameBenchmark&);
+	FrameBenchmark& operator=(const FrameBenchmark&);
+
+	SceneT _Scene;
+	int    _Frame;   // counts warmup and measured frames
+	bool   _GPUTiming;
+	GLuint _Queries[QUERY_COUNT];
+	int    _QueryFrames[QUERY_COUNT];   // frame of the pending query or -1
+
+	ClockT::time_point _FrameStart;
+	GLsizei _DrawCalls;
+	GLsizei _Triangles;
+
+	std::vector<double>  _FrameTimes;   // milliseconds, indexed by measured frame
+	std::vector<double>  _CPUTimes;
+	std::vector<double>  _GPUTimes;
+	std::vector<GLsizei> _FrameDrawCalls;
+	std::vector<GLsizei> _FrameTriangles;
+};
+// class FrameBenchmark ///////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // FRAMEBENCHMARK_H
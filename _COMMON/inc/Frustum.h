@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   Frustum.h
+//
+//  \brief      View frustum planes extracted from a combined projection and model view matrix
+//              with bounding sphere and axis aligned box tests.
+//
+//   Usage:     set(projection * modelView) extracts the six clip planes in the coordinate system
+//              the model view matrix transforms from (Gribb/Hartmann). The planes are normalized
+//              and point inwards, so plane distances of sphere centers can be compared with the
+//              radius directly.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+
+
+
+class Frustum
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum PlaneT { FP_LEFT, FP_RIGHT, FP_BOTTOM, FP_TOP, FP_NEAR, FP_FAR, FP_COUNT };
+	enum IntersectionT { FI_OUTSIDE, FI_INTERSECT, FI_INSIDE };
+
+	Frustum(void);
+	explicit Frustum(const glm::mat4& viewProjection);
+
+	void          set(const glm::mat4& viewProjection);
+	const         glm::vec4& getPlane(int plane) const { return _Planes[plane]; };
+
+	bool          testSphere(const glm::vec3& center, float radius) const;
+	IntersectionT classifySphere(const glm::vec3& center, float radius) const;
+	IntersectionT classifyBox(const glm::vec3& minimum, const glm::vec3& maximum) const;
+
+private:
+	glm::vec4 _Planes[FP_COUNT];   // (normal, distance), normal points inwards
+};
+// class Frustum //////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // FRUSTUM_H
@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   FrustumCuller.h
+//
+//  \brief      Frustum culling kernels over bounding volumes stored as structure of arrays.
+//
+//   Usage:     Keep the bounds of all objects in a SphereArrayT or BoxArrayT (one float array
+//              per component) and call cullSpheres() or cullBoxes() with the Frustum of the
+//              current view projection. The indices of all visible objects are written to
+//              visible (which must hold count entries) and their number is returned.
+//
+//              The kernels test 8 objects at once with AVX2 (and FMA) or 4 with SSE2 against all
+//              six planes, selected at runtime by CpuInfo::getLevel() like BatchTransform. The
+//              visible list is compacted without branches. The *Scalar() functions are the
+//              reference implementation based on the Frustum tests; results only differ by
+//              rounding for volumes touching a plane.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef FRUSTUMCULLER_H
+#define FRUSTUMCULLER_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "Frustum.h"
+
+
+
+class FrustumCuller
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct SphereArrayT
+	{
+		std::vector<float> x, y, z, radius;
+
+		void    add(const glm::vec3& center, float r);
+		void    set(GLsizei index, const glm::vec3& center, float r);
+		void    clear(void);
+		GLsizei size(void) const { return GLsizei(x.size()); };
+	};
+
+	struct BoxArrayT
+	{
+		std::vector<float> centerX, centerY, centerZ;
+		std::vector<float> extentX, extentY, extentZ;   // half sizes
+
+		void    add(const glm::vec3& minimum, const glm::vec3& maximum);
+		void    set(GLsizei index, const glm::vec3& minimum, const glm::vec3& maximum);
+		void    clear(void);
+		GLsizei size(void) const { return GLsizei(centerX.size()); };
+	};
+
+	static GLsizei cullSpheres(const Frustum& frustum, const SphereArrayT& spheres, GLuint* visible);
+	static GLsizei cullBoxes(const Frustum& frustum, const BoxArrayT& boxes, GLuint* visible);
+
+	static GLsizei cullSpheresScalar(const Frustum& frustum, const SphereArrayT& spheres, GLuint* visible);
+	static GLsizei cullBoxesScalar(const Frustum& frustum, const BoxArrayT& boxes, GLuint* visible);
+
+	static int     getLaneCount(void);
+	static const   char* getInstructionSet(void);
+};
+// class FrustumCuller ////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // FRUSTUMCULLER_H
@@ -0,0 +1,50 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ImageDecoder.h
+//
+//  \brief      Decoding of PNG and JPEG image files to RGBA8 pixels and mipmap generation with
+//              a SIMD 2x2 box filter, independent of OpenGL.
+//
+//   Usage:     decode() uses the FLTK image decoders (Fl_PNG_Image, Fl_JPEG_Image), which keep
+//              no shared state, so several threads may decode at the same time (the cache of
+//              Fl_Shared_Image is not thread safe and not used). Gray, gray alpha and RGB images
+//              are expanded to RGBA and the rows are flipped, so the first row in memory is the
+//              bottom row of the image (texture coordinate t = 0). JPEG files are also read from
+//              the mounted ResourceBundle, PNG files only from the file system.
+//
+//              downsample() builds the next mipmap level with SSE2 if CpuInfo reports it. Used
+//              by TextureLoader at runtime and by the CG-BCN texture compressor at build time.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef IMAGEDECODER_H
+#define IMAGEDECODER_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+
+
+
+class ImageDecoder
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	static bool decode(const std::string& filename, int& width, int& height,
+			std::vector<unsigned char>& pixels);
+
+	static int  getLevelCount(int width, int height);
+	static void downsample(const unsigned char* src, int width, int height, unsigned char* dst);
+};
+// class ImageDecoder /////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // IMAGEDECODER_H
@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   InstanceBuffer.h
+//
+//  \brief      Per-instance attribute stream for hardware instanced rendering with
+//              glDrawArraysInstanced() and glVertexAttribDivisor().
+//
+//   Usage:     The instance transforms are streamed every frame through a dynamic vertex buffer,
+//              which is split into a small ring of segments guarded by fence objects. The
+//              following per-instance formats are supported:
+//              IF_MAT4:     full 4x4 matrix (4 x vec4, 64 bytes per instance)
+//              IF_MAT3X4:   affine 3x4 matrix rows (3 x vec4, 48 bytes per instance)
+//              IF_QUAT_TRS: rotation quaternion + translation and uniform scale
+//                           (2 x vec4, 32 bytes per instance)
+//              The vertex shader has to decode the selected format from the consecutive
+//              attribute locations starting at the location passed to init().
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef INSTANCEBUFFER_H
+#define INSTANCEBUFFER_H
+
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+
+
+class InstanceBuffer
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum InstanceFormatT { IF_MAT4, IF_MAT3X4, IF_QUAT_TRS };
+
+	InstanceBuffer(void);
+	~InstanceBuffer(void);
+
+	void    init(GLuint vao, GLuint location, GLsizei maxInstances, InstanceFormatT format = IF_MAT4);
+	void    release(void);
+
+	// stream instance data into the next ring segment (returns the number of instances written)
+	GLsizei update(const glm::mat4* transforms, GLsizei count);
+	GLsizei update(const glm::quat* rotations, const glm::vec4* translationScale, GLsizei count);
+
+	// draw the bound vertex array once per streamed instance
+	void    drawArrays(GLenum mode, GLint first, GLsizei vertexCount);
+
+	InstanceFormatT getFormat(void) const { return _Format; };
+	GLsizei getInstanceCount(void) const { return _InstanceCount; };
+
+	static GLsizei getAttributeCount(InstanceFormatT format);
+	static GLsizei getInstanceSize(InstanceFormatT format);
+
+private:
+	static const int RING_SEGMENTS = 3;
+
+	void*   mapSegment(GLsizei count);
+	void    unmapSegment(GLsizei count);
+
+	InstanceBuffer(const InstanceBuffer&);
+	InstanceBuffer& operator=(const InstanceBuffer&);
+
+	GLuint  _VAO;
+	GLuint  _VBO;
+	GLuint  _Location;
+	GLsizei _MaxInstances;
+	GLsizei _InstanceCount;
+	GLsizei _Segment;
+	GLsync  _Fences[RING_SEGMENTS];
+	InstanceFormatT _Format;
+};
+// class InstanceBuffer ///////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // INSTANCEBUFFER_H
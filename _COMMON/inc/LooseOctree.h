@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   LooseOctree.h
+//
+//  \brief      Loose octree scene index over bounding spheres for frustum culling and proximity
+//              queries of large dynamic scenes.
+//
+//   Usage:     init() defines the cubic root cell. insert() returns a handle for an object
+//              bounding sphere, update() moves it and remove() releases the handle for reuse.
+//              Cells are loose by a factor of two, so an object is stored in the deepest cell
+//              whose half size is at least its radius and which contains its center - moving
+//              objects rarely change cells and update() then only writes the new bounds.
+//
+//              Choose maxDepth such that the leaf cells hold a few objects on average, deeper
+//              trees mostly add nodes with a single object.
+//
+//              All nodes live in one array (eight siblings per block, empty blocks are recycled)
+//              and the objects of a node are linked by index, so insert, update and remove do
+//              not allocate once the arrays have grown. Objects whose center leaves the root
+//              cell are kept in the root node.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef LOOSEOCTREE_H
+#define LOOSEOCTREE_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "Frustum.h"
+
+
+
+class LooseOctree
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	static const GLuint INVALID = 0xFFFFFFFF;
+	static const int    MAX_DEPTH = 24;
+
+	LooseOctree(void);
+
+	void   init(const glm::vec3& center, float halfSize, int maxDepth = 8);
+	void   clear(void);
+
+	GLuint insert(const glm::vec3& center, float radius);
+	void   update(GLuint handle, const glm::vec3& center, float radius);
+	void   remove(GLuint handle);
+
+	// append the handles of all (potentially) intersecting objects to result
+	void   queryFrustum(const Frustum& frustum, std::vector<GLuint>& result) const;
+	void   querySphere(const glm::vec3& center, float radius, std::vector<GLuint>& result) const;
+
+	const  glm::vec4& getBounds(GLuint handle) const { return _Bounds[handle]; };
+	GLuint getObjectCount(void) const { return _Nodes.empty() ? 0 : _Nodes[0].objectCount; };
+	GLuint getNodeCount(void) const { return GLuint(_Nodes.size() - 8 * _FreeBlocks.size()); };
+	int    getMaxDepth(void) const { return _MaxDepth; };
+
+private:
+	struct NodeT
+	{
+		glm::vec3 center;
+		float     halfSize;       // half size of the tight cell, the loose cell is twice as large
+		GLuint    parent;
+		GLuint    firstChild;     // first node of a block of eight children or INVALID
+		GLuint    firstObject;    // head of the linked object list of this node
+		GLuint    objectCount;    // objects in the whole subtree (empty subtrees are skipped)
+	};
+
+	GLuint locate(const glm::vec3& center, float radius, bool create);
+	GLuint allocateChildren(GLuint node);
+	void   link(GLuint handle, GLuint node);
+	void   unlink(GLuint handle);
+	void   releaseChildren(GLuint node);
+
+	template<typename TestT>
+	void   query(const TestT& test, std::vector<GLuint>& result) const;
+
+	std::vector<NodeT>     _Nodes;
+	std::vector<GLuint>    _FreeBlocks;
+
+	std::vector<glm::vec4> _Bounds;        // per object: sphere center and radius
+	std::vector<GLuint>    _ObjectNode;    // per object: owning node or INVALID if free
+	std::vector<GLuint>    _Next;
+	std::vector<GLuint>    _Previous;
+	std::vector<GLuint>    _FreeObjects;
+
+	int _MaxDepth;
+};
+// class LooseOctree //////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // LOOSEOCTREE_H
@@ -0,0 +1,56 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   MappedFile.h
+//
+//  \brief      Read only memory mapping of a whole file (mmap, file mapping on Windows).
+//
+//   Usage:     open() maps the file, getData() and getSize() give access to its bytes until
+//              close() (or the destructor) removes the mapping. Pages are read on demand, so
+//              the data can be passed to GL calls without an intermediate copy.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <cstddef>
+
+
+
+class MappedFile
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	MappedFile(void);
+	~MappedFile(void);
+
+	bool   open(const std::string& filename);
+	void   close(void);
+	bool   isOpen(void) const { return _Data != NULL; };
+
+	const char* getData(void) const { return _Data; };
+	size_t getSize(void) const { return _Size; };
+
+private:
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+
+	const char* _Data;
+	size_t      _Size;
+	void*       _File;      // Windows file and mapping handles
+	void*       _Mapping;
+};
+// class MappedFile ///////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // MAPPEDFILE_H
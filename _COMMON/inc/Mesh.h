@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   Mesh.h
+//
+//  \brief      Simple indexed triangle mesh container with procedural mesh generators.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef MESH_H
+#define MESH_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+
+class Mesh
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	std::vector<glm::vec3> positions;
+	std::vector<GLuint>    indices;   // three indices per triangle
+
+	GLsizei getVertexCount(void) const { return GLsizei(positions.size()); };
+	GLsizei getTriangleCount(void) const { return GLsizei(indices.size() / 3); };
+
+	void    getBounds(glm::vec3& minimum, glm::vec3& maximum) const;
+
+	// procedural meshes (closed and without duplicated seam vertices)
+	static Mesh createSphere(float radius, int slices, int stacks);
+};
+// class Mesh /////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // MESH_H
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   MeshLOD.h
+//
+//  \brief      Level of detail chain built with a quadric error metric (QEM) edge collapse
+//              simplifier and runtime level selection by projected screen-space error.
+//
+//   Usage:     build() simplifies the mesh progressively and records a snapshot each time the
+//              triangle count dropped by the reduction factor. All levels share one vertex
+//              buffer, the vertices are sorted such that every level only references a prefix
+//              of it. Each level stores its geometric error in model units.
+//
+//              selectLevel() projects these errors with the current model view (including the
+//              TrackBall scale) and projection matrix into pixels and returns the coarsest level
+//              whose error stays below the given pixel tolerance (default: one pixel), so level
+//              switches are not visible and no distance thresholds have to be tuned.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef MESHLOD_H
+#define MESHLOD_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "Mesh.h"
+
+
+
+class MeshLOD
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct LevelT
+	{
+		GLuint  firstIndex;   // offset into the shared index buffer
+		GLsizei indexCount;
+		GLsizei vertexCount;  // the level references the vertices [0, vertexCount)
+		float   error;        // geometric error in model units
+	};
+
+	MeshLOD(void);
+	~MeshLOD(void);
+
+	void   build(const Mesh& mesh, float reduction = 0.5f, GLsizei minTriangles = 32, int maxLevels = 12);
+	void   upload(GLuint positionLocation);
+	void   release(void);
+
+	int    selectLevel(const glm::mat4& modelView, const glm::mat4& projection,
+			float viewportHeight, float pixelError = 1.0f) const;
+	float  getProjectedError(int level, const glm::mat4& modelView, const glm::mat4& projection,
+			float viewportHeight) const;
+	void   draw(int level) const;
+
+	int    getLevelCount(void) const { return int(_Levels.size()); };
+	const  LevelT& getLevel(int level) const { return _Levels[level]; };
+
+	const  std::vector<glm::vec3>& getPositions(void) const { return _Positions; };
+	const  std::vector<GLuint>& getIndices(void) const { return _Indices; };
+
+private:
+	MeshLOD(const MeshLOD&);
+	MeshLOD& operator=(const MeshLOD&);
+
+	float  getPixelsPerUnit(const glm::mat4& modelView, const glm::mat4& projection,
+			float viewportHeight, float& scale) const;
+
+	std::vector<glm::vec3> _Positions;
+	std::vector<GLuint>    _Indices;
+	std::vector<LevelT>    _Levels;
+	glm::vec3 _Center;
+	float     _Radius;
+
+	GLuint _VAO;
+	GLuint _VBO;
+	GLuint _IBO;
+};
+// class MeshLOD //////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // MESHLOD_H
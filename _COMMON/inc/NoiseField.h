@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   NoiseField.h
+//
+//  \brief      Batched 3D gradient noise (the classic Perlin and simplex noise of
+//              glm/gtc/noise.hpp) with fBm and ridged octaves, evaluated 4, 8 or 16 samples
+//              per instruction and generated in parallel rows for heightfields and volumes.
+//
+//   Usage:     ParametersT selects the noise (glm::perlin() or glm::simplex() of a glm::vec3),
+//              the octave sum and its frequencies. Every octave o evaluates the noise at
+//              (position + offset) * frequency * lacunarity^o, fBm sums the values weighted by
+//              gain^o, ridged sums (1 - |noise|)^2 with the same weights.
+//
+//              sample() is the reference: one position with the GLM functions. evaluate() does
+//              the same for arrays of positions (structure of arrays) with the SSE2, AVX2 or
+//              AVX-512 kernel selected by CpuInfo::getLevel(). The kernels repeat the
+//              operations of GLM in the same order: SSE2 returns the same bits as sample(),
+//              AVX2 and AVX-512 differ by rounding (fused multiply-adds, below 1e-4 in total).
+//              Positions must stay within +-2^31 (the SSE2 floor converts to integers).
+//
+//              generate() fills a width x height x depth grid (x fastest) with the values at
+//              the integer positions of the grid, depth 1 gives a heightfield. The rows of the
+//              grid are shared by threads workers (0 uses all hardware threads).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef NOISEFIELD_H
+#define NOISEFIELD_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "CpuInfo.h"
+
+
+
+class NoiseField
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum NoiseT { NOISE_PERLIN, NOISE_SIMPLEX };
+	enum FractalT { FRACTAL_FBM, FRACTAL_RIDGED };
+
+	struct ParametersT
+	{
+		NoiseT    noise;
+		FractalT  fractal;
+		int       octaves;
+		float     frequency;    // of the first octave
+		float     lacunarity;   // frequency factor from one octave to the next
+		float     gain;         // amplitude factor from one octave to the next
+		glm::vec3 offset;       // added to the positions
+	};
+
+	static ParametersT getDefaultParameters(void);
+
+	static float  sample(const ParametersT& parameters, const glm::vec3& position);
+	static void   evaluate(const ParametersT& parameters, const float* x, const float* y,
+	                       const float* z, float* out, size_t count);
+	static void   generate(const ParametersT& parameters, float* out, int width, int height,
+	                       int depth = 1, unsigned threads = 0);
+
+	static CpuInfo::SimdLevelT getLevel(void);
+};
+// class NoiseField ///////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // NOISEFIELD_H
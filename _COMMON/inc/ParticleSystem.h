@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ParticleSystem.h
+//
+//  \brief      Particle fountain kept entirely on the GPU: emission, simulation, compaction
+//              and depth sorting run in compute shaders, the draw count never leaves the GPU.
+//              A CPU simulation over structure of arrays is the fallback for software
+//              renderers.
+//
+//   Usage:     init() creates the buffers for capacity particles and takes the programs of
+//              the demo (e.g. glsl/helloglsl_particles.comp with PARTICLE_PASS 0, 1 and 2,
+//              glsl/helloglsl_radixsort.comp with RADIX_PASS 0, 1 and 2 and the point sprite
+//              program of glsl/helloglsl_particles.vert and .frag, owned by the caller).
+//              setParameters() describes the emitter, update() advances the simulation by a
+//              time step and draw() renders the particles as point sprites (premultiplied
+//              alpha, depth test without depth writes). Every frame on the GPU (MODE_GPU):
+//
+//                 prepare    clamps the requested emission to the free capacity, writes the
+//                            work groups of the update pass and resets the particle counter
+//                 update     one thread per alive and per new particle: integrates gravity and
+//                            the bounce on the ground plane y = 0, drops dead particles and
+//                            appends the survivors and the new particles to the other particle
+//                            buffer through an atomic counter. The counter is the count of the
+//                            DrawArraysIndirectCommand, so glDrawArraysIndirect() draws exactly
+//                            the particles alive (all dispatches are indirect as well)
+//                 sort       with setSorting(true) the update writes squared eye distances as
+//                            keys and a stable LSD radix sort (8 passes of 4 bit digits: block
+//                            histograms, one scan, ranked scatter) orders the particle indices
+//                            back to front for the blending
+//
+//              MODE_CPU runs the same simulation with simulate() (SSE2, scalar without SSE2)
+//              on the structure of arrays, sorts the indices with std::sort and uploads both
+//              for the same draw. Switching the mode restarts the fountain. The random
+//              emission (random(), a 32 bit integer hash of the emission count) is the same in
+//              both modes, so the particle counts match.
+//
+//              Bindings (see glsl/particles.glsl of the demo):
+//                 uniform buffer 0          emitter and simulation parameters
+//                 shader storage buffer 0   particles (input of the update and of the draw)
+//                 shader storage buffer 1   particles written by the update, sort histogram
+//                 shader storage buffer 2   dispatch commands and counts
+//                 shader storage buffer 3   draw command (atomic counter buffer 0 in the update)
+//                 shader storage buffer 4-7 sort keys and values (input, output)
+//
+//              getStatistics() reads the particle count back in MODE_GPU and therefore waits
+//              for the update. The GPU times of update, sort and draw are measured with
+//              timestamp queries read a few frames later.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef PARTICLESYSTEM_H
+#define PARTICLESYSTEM_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+
+class ParticleSystem
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum ModeT { MODE_GPU, MODE_CPU };
+
+	// emitter at position shooting particles upwards in a cone
+	struct ParametersT
+	{
+		glm::vec3 position;
+		float     rate;          // particles per second
+		float     speed;         // initial vertical speed
+		float     spread;        // horizontal speed relative to the vertical one
+		float     lifetime;      // maximum, particles live between half and all of it
+		float     gravity;
+		float     restitution;   // speed kept when bouncing off the ground plane y = 0
+		float     radius;        // of the point sprites
+	};
+
+	// particles of the CPU simulation
+	struct ParticleArrayT
+	{
+		std::vector<float> x, y, z;
+		std::vector<float> vx, vy, vz;
+		std::vector<float> life;   // remaining seconds
+		size_t count;              // alive particles at the front of the arrays
+
+		ParticleArrayT(void) : count(0) {};
+		void   resize(size_t capacity);
+		size_t capacity(void) const { return x.size(); };
+	};
+
+	// programs of the passes, see init()
+	struct ProgramsT
+	{
+		GLuint prepare;
+		GLuint update;
+		GLuint sortSetup;
+		GLuint histogram;
+		GLuint scan;
+		GLuint scatter;
+		GLuint render;
+	};
+
+	struct StatisticsT
+	{
+		ModeT  mode;
+		GLuint particles;
+		GLuint capacity;
+		bool   sorting;
+		double updateMilliseconds;   // GPU (emission, simulation and upload in MODE_CPU)
+		double sortMilliseconds;
+		double drawMilliseconds;
+	};
+
+	static const GLuint PARAMETER_BINDING = 0;   // uniform buffer binding
+	static const GLuint PARTICLE_BINDING = 0;    // shader storage buffer bindings
+	static const GLuint OUTPUT_BINDING = 1;
+	static const GLuint STATE_BINDING = 2;
+	static const GLuint DRAW_BINDING = 3;
+	static const GLuint KEY_BINDING = 4;
+	static const GLuint VALUE_BINDING = 5;
+	static const GLuint SORTED_KEY_BINDING = 6;
+	static const GLuint SORTED_VALUE_BINDING = 7;
+	static const GLuint COUNTER_BINDING = 0;     // atomic counter buffer binding
+
+	ParticleSystem(void);
+	~ParticleSystem(void);
+
+	bool   init(GLsizei capacity, const ProgramsT& programs);
+	void   release(void);
+
+	void   setMode(ModeT mode);
+	ModeT  getMode(void) const { return _Mode; };
+	void   setSorting(bool sorting) { _Sorting = sorting; };
+	bool   isSorting(void) const { return _Sorting; };
+	void   setParameters(const ParametersT& parameters) { _Parameters = parameters; };
+	const  ParametersT& getParameters(void) const { return _Parameters; };
+
+	void   update(float deltaTime, const glm::vec3& eye);
+	void   draw(const glm::mat4& projection, const glm::mat4& modelView, GLsizei height);
+
+	StatisticsT getStatistics(void);
+	void   report(std::ostream& out);
+
+	// CPU simulation: advances the alive particles, compacts them in order and appends up to
+	// emit new particles with the seeds firstSeed, firstSeed + 1, ...; returns the particles
+	// emitted. simulate() uses SSE2 where available, simulateScalar() is the reference.
+	static size_t simulate(ParticleArrayT& particles, const ParametersT& parameters,
+	                       float deltaTime, size_t emit, GLuint firstSeed);
+	static size_t simulateScalar(ParticleArrayT& particles, const ParametersT& parameters,
+	                             float deltaTime, size_t emit, GLuint firstSeed);
+	static float  random(GLuint seed);
+
+private:
+	static const int    QUERY_COUNT = 4;     // frames in flight for the GPU timer queries
+	static const GLuint UPDATE_GROUP = 256;  // local size of the update pass
+	static const GLuint SORT_BLOCK = 1024;   // keys per work group of the radix sort
+	static const int    SORT_PASSES = 8;     // 4 bit digits of 32 bit keys
+
+	// particle buffer entry
+	struct ShaderParticleT
+	{
+		glm::vec4 position;   // xyz position, w remaining life
+		glm::vec4 velocity;
+	};
+
+	// uniform buffer (std140)
+	struct ShaderParametersT
+	{
+		glm::vec4 emitter;      // xyz position, w radius
+		glm::vec4 velocity;     // speed, spread, lifetime, gravity
+		glm::vec4 simulation;   // time step, restitution, depth keys
+		glm::vec4 eye;
+		GLuint    emission[4];  // requested particles, first seed, capacity
+	};
+
+	enum BufferT { BUFFER_PARAMETERS, BUFFER_PARTICLES, BUFFER_OUTPUT, BUFFER_STATE, BUFFER_DRAW,
+	               BUFFER_KEYS, BUFFER_VALUES, BUFFER_SORTED_KEYS, BUFFER_SORTED_VALUES,
+	               BUFFER_HISTOGRAM, BUFFER_COUNT };
+
+	static size_t emitParticles(ParticleArrayT& particles, const ParametersT& parameters,
+	                            size_t emit, GLuint firstSeed);
+
+	void   reset(void);
+	GLuint takeEmission(float deltaTime);
+	void   updateGPU(void);
+	void   sortGPU(void);
+	void   updateCPU(float deltaTime, const glm::vec3& eye, GLuint emit);
+	void   writeParameters(float deltaTime, const glm::vec3& eye, GLuint emit);
+	void   readQueries(void);
+
+	ParticleSystem(const ParticleSystem&);
+	ParticleSystem& operator=(const ParticleSystem&);
+
+	GLsizei _Capacity;
+	ProgramsT _Programs;
+	GLint   _HistogramShift;            // radixShift locations of the sort programs
+	GLint   _ScatterShift;
+	GLint   _RenderLocations[4];        // matModelView, matProjection, viewportHeight, sorted
+	GLuint  _Buffers[BUFFER_COUNT];
+	GLuint  _VertexArray;               // empty, the particles come from the storage buffer
+	ModeT   _Mode;
+	bool    _Sorting;
+	bool    _Sorted;                    // the last update produced sorted indices
+	ParametersT _Parameters;
+	float   _EmissionDebt;              // fraction of a particle carried to the next frame
+	GLuint  _Emitted;                   // particles emitted so far, the seed of the next one
+
+	ParticleArrayT _CPUParticles;
+	std::vector<ShaderParticleT> _Upload;
+	std::vector<GLuint> _Order;
+	std::vector<float>  _Distances;
+
+	GLuint  _Queries[4 * QUERY_COUNT];  // timestamps: start, updated, sorted, drawn
+	bool    _QueryPending[QUERY_COUNT];
+	int     _NextQuery;
+	bool    _Timing;                    // update() started the timestamps of a frame
+	StatisticsT _Statistics;
+};
+// class ParticleSystem ///////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // PARTICLESYSTEM_H
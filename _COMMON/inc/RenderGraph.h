@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   RenderGraph.h
+//
+//  \brief      Declarative render graph: passes declare the textures they read and write, the
+//              graph culls unused passes, orders them, aliases transient textures and inserts
+//              the memory barriers.
+//
+//   Usage:     The graph is declared again every frame: reset(), then createTexture() for
+//              transient textures (render targets that live within the frame only),
+//              importTexture() for textures owned by the application (texture 0 stands for
+//              the default framebuffer), addPass() with the callback that records the GL
+//              commands of the pass and read()/write() for every texture the pass accesses.
+//              compile() and execute() run the frame.
+//
+//              compile()
+//                 culling    passes writing an imported texture are kept, every other pass
+//                            only if a kept pass reads one of its textures
+//                 ordering   writers of a texture run in declaration order, passes that only
+//                            read it run after all of its writers (passes that blend into a
+//                            texture read and write it); ties keep the declaration order
+//                 aliasing   transient textures whose lifetimes (first to last use in the
+//                            pass order) do not overlap share a texture object of the pool
+//                            if their descriptions are equal; pool textures not used for
+//                            MAX_UNUSED_FRAMES frames are deleted
+//                 barriers   writes through image stores (USAGE_IMAGE) are incoherent, the
+//                            next pass accessing the same texture object gets a
+//                            glMemoryBarrier() with only the bits of its usage and a barrier
+//                            covers all textures written before it (textures written through
+//                            attachments or read only need none)
+//
+//              execute() issues the barriers, binds the framebuffer of the attachments a pass
+//              writes (graph owned FBO or the default framebuffer, viewport of the first
+//              attachment, compute passes keep the current framebuffer) and calls the pass
+//              callback, which looks the texture objects up with getTexture(). Every pass is
+//              an ErrorCheck scope named after the pass.
+//
+//              getStatistics() and report() show the culled passes, the pool assignments and
+//              the peak transient memory of the frame compared with unaliased textures.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDERGRAPH_H
+#define RENDERGRAPH_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+
+class RenderGraph
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum UsageT
+	{
+		USAGE_SAMPLED,      // texture fetches through a sampler
+		USAGE_IMAGE,        // image load/store
+		USAGE_ATTACHMENT    // framebuffer color or depth attachment
+	};
+
+	struct TextureDescT
+	{
+		GLsizei width;
+		GLsizei height;
+		GLenum  format;   // sized internal format
+	};
+
+	struct StatisticsT
+	{
+		int    passes;          // declared passes
+		int    culledPasses;
+		int    transients;      // declared transient textures
+		int    textures;        // pool textures used by the frame
+		int    barriers;        // glMemoryBarrier() calls of the frame
+		size_t peakBytes;       // transient memory live at the same time
+		size_t unaliasedBytes;  // transient memory without aliasing
+		size_t poolBytes;       // all pool textures (including ones kept for other frames)
+	};
+
+	typedef void (*ExecuteT)(const RenderGraph& graph);
+
+	static const int MAX_UNUSED_FRAMES = 60;
+
+	RenderGraph(void);
+	~RenderGraph(void);
+
+	void   reset(void);
+	int    createTexture(const std::string& name, const TextureDescT& desc);
+	int    importTexture(const std::string& name, GLuint texture, const TextureDescT& desc);
+	int    addPass(const std::string& name, ExecuteT execute);
+	void   read(int pass, int texture, UsageT usage = USAGE_SAMPLED);
+	void   write(int pass, int texture, UsageT usage = USAGE_ATTACHMENT);
+
+	bool   compile(void);
+	void   execute(void);
+	void   release(void);
+
+	GLuint getTexture(int texture) const { return _Resources[texture].texture; };
+	const  TextureDescT& getDesc(int texture) const { return _Resources[texture].desc; };
+	const  StatisticsT& getStatistics(void) const { return _Statistics; };
+	void   report(std::ostream& out) const;
+
+	static size_t getTextureSize(const TextureDescT& desc);
+	static bool   isDepthFormat(GLenum format);
+
+private:
+	struct AccessT
+	{
+		int    resource;
+		UsageT usage;
+		bool   write;
+	};
+
+	struct PassT
+	{
+		std::string name;
+		ExecuteT    execute;
+		std::vector<AccessT> accesses;
+		bool        live;
+		GLbitfield  barriers;   // issued before the pass
+	};
+
+	struct ResourceT
+	{
+		std::string  name;
+		TextureDescT desc;
+		GLuint       texture;
+		bool         imported;
+		int          first;   // lifetime in the pass order, -1 if unused
+		int          last;
+		int          pool;    // pool texture of a transient
+	};
+
+	struct PoolTextureT
+	{
+		TextureDescT desc;
+		GLuint       texture;
+		int          unusedFrames;
+		bool         used;         // assigned to a transient of the current frame
+		GLbitfield   pending;      // barrier bits outstanding after image stores
+	};
+
+	void   cull(void);
+	bool   sort(void);
+	void   allocate(void);
+	void   placeBarriers(void);
+	void   bindFramebuffer(const PassT& pass);
+
+	static bool       isEqual(const TextureDescT& a, const TextureDescT& b);
+	static GLbitfield getBarrierBit(UsageT usage);
+
+	RenderGraph(const RenderGraph&);
+	RenderGraph& operator=(const RenderGraph&);
+
+	std::vector<PassT>        _Passes;
+	std::vector<ResourceT>    _Resources;
+	std::vector<int>          _Order;      // live passes in execution order
+	std::vector<PoolTextureT> _Pool;
+	GLuint      _Framebuffer;
+	int         _ColorAttachments;   // currently attached to the graph FBO
+	bool        _DepthAttachment;
+	bool        _Compiled;
+	StatisticsT _Statistics;
+};
+// class RenderGraph //////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // RENDERGRAPH_H
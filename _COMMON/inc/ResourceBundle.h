@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ResourceBundle.h
+//
+//  \brief      Read only resource archive (shader sources, SPIR-V modules, scenes) that is
+//              memory mapped as a whole and serves its files without copying them.
+//
+//   Usage:     pack() writes the archive at build time (see CG-TOOLS/CG-PACK and the
+//              CMakeLists.txt of the demos), open() maps it with a single open/mmap call.
+//              find() looks a file name up in the sorted index by binary search and returns a
+//              view (pointer and size) into the mapping, no memory is allocated. Every file is
+//              followed by a '\0' and starts 16 byte aligned, so text can be passed directly
+//              to glShaderSource() and SPIR-V words to glShaderBinary().
+//
+//              File names are stored relative to the packed root directory with '/' as
+//              separator. Leading "./" and "../" components of a requested name are ignored,
+//              so "../../glsl/helloglsl.vert" (relative to bin/Debug) finds "glsl/helloglsl.vert".
+//
+//              mount() makes a bundle visible to the file loaders of UtilGLSL,
+//              ShaderPreprocessor and FrameBenchmark, which fall back to the file system for
+//              names that are not in the mounted bundle.
+//
+//              Archive layout (little endian):
+//                 HeaderT                 magic "CGRB", version, entry count
+//                 EntryT[count]           sorted by name (byte wise)
+//                 names and file data     '\0' terminated, file data 16 byte aligned
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Mapping moved to MappedFile
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef RESOURCEBUNDLE_H
+#define RESOURCEBUNDLE_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <cstddef>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "MappedFile.h"
+
+
+
+class ResourceBundle
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct ViewT
+	{
+		const char* data;   // '\0' terminated, valid while the bundle is open
+		size_t      size;   // without the terminating '\0'
+	};
+
+	ResourceBundle(void);
+	~ResourceBundle(void);
+
+	bool   open(const std::string& filename);
+	void   close(void);
+	bool   isOpen(void) const { return _Data != NULL; };
+
+	bool   find(const char* name, size_t length, ViewT& view) const;
+	bool   find(const std::string& name, ViewT& view) const { return find(name.c_str(), name.size(), view); };
+
+	size_t getEntryCount(void) const { return _Count; };
+	ViewT  getName(size_t entry) const;
+	size_t getSize(void) const { return _Size; };
+
+	static bool pack(const std::string& filename, const std::string& root,
+			const std::vector<std::string>& names);
+
+	static void mount(const ResourceBundle* bundle) { _Mounted = bundle; };
+	static bool findMounted(const std::string& name, ViewT& view);
+
+private:
+	struct HeaderT
+	{
+		char     magic[4];
+		unsigned version;
+		unsigned count;
+		unsigned reserved;
+	};
+
+	struct EntryT
+	{
+		unsigned name;         // offsets from the start of the archive
+		unsigned nameLength;
+		unsigned data;
+		unsigned size;
+	};
+
+	static const unsigned VERSION = 1;
+	static const unsigned ALIGNMENT = 16;
+
+	ResourceBundle(const ResourceBundle&);
+	ResourceBundle& operator=(const ResourceBundle&);
+
+	bool   validate(void);
+
+	MappedFile    _File;
+	const char*   _Data;
+	size_t        _Size;
+	const EntryT* _Entries;
+	size_t        _Count;
+
+	static const ResourceBundle* _Mounted;
+};
+// class ResourceBundle ///////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // RESOURCEBUNDLE_H
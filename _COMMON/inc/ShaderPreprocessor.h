@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ShaderPreprocessor.h
+//
+//  \brief      GLSL preprocessor with #include resolution, injected defines and cached shader
+//              variants (permutations), separable stage programs and program pipelines.
+//
+//   Usage:     expand() returns the source of a shader file with all #include "file" lines
+//              replaced by the file contents (relative to the including file or one of the
+//              include paths, #pragma once is honored) and the given defines inserted after
+//              the #version line. #line directives keep the compiler messages pointing to the
+//              original file and line, getFileName() maps the source string numbers back.
+//
+//              A variant is identified by the file name and its permutation key (the sorted
+//              NAME=value list of the defines). Only defines that occur in the expanded source
+//              are injected, so variants that differ in unused defines expand to the same text.
+//              Expanded sources are stored once per content hash, getShader() compiles every
+//              distinct source only once and getProgram() links every distinct combination of
+//              shader objects only once. The GLSL compiler removes the branches disabled by
+//              the injected defines, so each variant is a specialized program.
+//
+//              getStageProgram() links a single shader object into a separable program
+//              (GL_PROGRAM_SEPARABLE) and getPipeline() combines such stage programs into a
+//              program pipeline object. Stages are shared across pipelines, so switching e.g.
+//              the vertex variant while keeping the fragment stage needs no relink at all, and
+//              identical stage sources (after expansion) end up in the same program object.
+//              Bind a pipeline with glUseProgram(0) and glBindProgramPipeline(), uniforms are
+//              set per stage with glProgramUniform*() or through glActiveShaderProgram().
+//
+//              The preprocessor owns all returned shader, program and pipeline objects (see
+//              release()).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Separable stage programs and program pipelines
+//     2026-10-18   1.20      agt      Sources served from the mounted ResourceBundle
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SHADERPREPROCESSOR_H
+#define SHADERPREPROCESSOR_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "ResourceBundle.h"
+
+
+
+class ShaderPreprocessor
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	typedef std::map<std::string, std::string> DefinesT;
+
+	struct StatisticsT
+	{
+		size_t expansions;      // expand() requests
+		size_t expansionHits;   // requests served from the variant cache
+		size_t sources;         // distinct expanded sources
+		size_t shaders;         // compiled shader objects
+		size_t shaderHits;      // getShader() requests served by an existing shader object
+		size_t programs;        // linked programs
+		size_t programHits;
+		size_t stages;          // linked separable stage programs
+		size_t stageHits;
+		size_t pipelines;       // program pipeline objects
+		size_t pipelineHits;
+	};
+
+	ShaderPreprocessor(void);
+	~ShaderPreprocessor(void);
+
+	void   addIncludePath(const std::string& path);
+
+	const  std::string* expand(const std::string& filename, const DefinesT& defines = DefinesT());
+	GLuint getShader(GLenum type, const std::string& filename, const DefinesT& defines = DefinesT());
+	GLuint getProgram(const std::vector<std::string>& filenames, const DefinesT& defines = DefinesT());
+	GLuint getStageProgram(GLenum type, const std::string& filename, const DefinesT& defines = DefinesT());
+	GLuint getPipeline(const std::vector<std::string>& filenames, const DefinesT& defines = DefinesT());
+	void   release(void);
+
+	const  std::string& getFileName(int sourceString) const { return _Files[sourceString]; };
+	const  StatisticsT& getStatistics(void) const { return _Statistics; };
+
+	static std::string getPermutationKey(const DefinesT& defines);
+	static GLenum      getShaderType(const std::string& filename);
+	static GLuint64    getHash(const std::string& text);
+	static GLbitfield  getStageBit(GLenum type);
+
+private:
+	static const int MAX_INCLUDE_DEPTH = 32;
+
+	bool   expandFile(const std::string& filename, int depth, std::string& source,
+			size_t& injection, std::vector<std::string>& stack, std::set<std::string>& once);
+	const  ResourceBundle::ViewT* readFile(const std::string& filename);
+	bool   resolveInclude(const std::string& name, const std::string& includer, std::string& filename);
+	int    getSourceString(const std::string& filename);
+
+	ShaderPreprocessor(const ShaderPreprocessor&);
+	ShaderPreprocessor& operator=(const ShaderPreprocessor&);
+
+	std::vector<std::string>           _IncludePaths;
+	std::vector<std::string>           _Files;       // file names by source string number
+	std::map<std::string, ResourceBundle::ViewT> _Contents; // views of the files read so far
+	std::map<std::string, std::string> _FileCopies;  // files read from the file system
+	std::map<std::string, GLuint64>    _Variants;    // file name and permutation key -> hash
+	std::map<GLuint64, std::string>    _Sources;     // expanded sources by hash
+	std::map<std::pair<GLenum, GLuint64>, GLuint> _Shaders;
+	std::map<std::vector<GLuint>, GLuint> _Programs; // attached shader objects -> program
+	std::map<GLuint, GLuint>              _Stages;   // shader object -> separable program
+	std::map<std::vector<GLuint>, GLuint> _Pipelines; // stage programs -> pipeline
+	StatisticsT _Statistics;
+};
+// class ShaderPreprocessor ///////////////////////////////////////////////////////////////////////
+
+
+
+#endif // SHADERPREPROCESSOR_H
@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ShadowCascades.h
+//
+//  \brief      Cascaded shadow maps of a directional light with cached static casters: the
+//              static part of every cascade is re-rendered only when the light or the static
+//              casters change and scrolled incrementally when the view moves.
+//
+//   Usage:     init() creates cascades depth maps of size x size texels (layers of one
+//              depth array texture with comparison sampling). setLightDirection() and
+//              setCasterBounds() (box of all casters and receivers, defines the depth range
+//              of the light) are set once and whenever they change; invalidate() tells the
+//              cascades that static casters moved. update() is called every frame before the
+//              scene is drawn with the camera projection (perspective) and view matrix (e.g.
+//              lookAt() * TrackBall transformation):
+//
+//                 splits     the view frustum is split between near and far plane with the
+//                            practical split scheme (log and uniform splits blended 3:1)
+//                 fitting    every cascade covers the bounding sphere of its frustum split,
+//                            so its extent does not change when the camera rotates, and its
+//                            origin is snapped to whole texels in light space
+//                 caching    the static casters of a cascade are rendered into a separate
+//                            depth map that is kept as long as the light and the static
+//                            casters do not change. When the snapped origin moves, the
+//                            still valid texels are copied to their new place and only the
+//                            exposed strips are rendered; a cascade that does not move costs
+//                            no static draw at all. The cascade layer is then a copy of the
+//                            static map with the dynamic casters drawn on top.
+//
+//              The draw callback renders the casters with the given light view projection
+//              matrix (into the currently bound depth target, viewport and scissor are set)
+//              and should skip the casters outside the region frustum. It is called with
+//              dynamicCasters false for the static casters of a (partial) region and with
+//              true for the dynamic ones. setCaching(false) renders everything every frame
+//              for comparison.
+//
+//              The shading pass uses bind() (array texture for a sampler2DArrayShadow),
+//              getMatrix() (world to light clip coordinates per cascade) and getSplit() (far
+//              view depth per cascade) to select the cascade of a fragment. update() restores
+//              the framebuffer binding, the caller restores its viewport.
+//
+//              Every cascade is an ErrorCheck scope ("shadow cascade N") for debug output and
+//              GPU profilers. getStatistics() counts the cascades rendered, scrolled and
+//              cached and the static texels re-rendered in the last frame; GPU time is
+//              measured with timestamp queries and compared with the last full re-render.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SHADOWCASCADES_H
+#define SHADOWCASCADES_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "Frustum.h"
+
+
+
+class ShadowCascades
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct StatisticsT
+	{
+		int    cascades;
+		int    rendered;           // cascades with a full static re-render
+		int    scrolled;           // cascades with static strips rendered after scrolling
+		int    cached;             // cascades without static draws
+		size_t texelsRendered;     // static texels rendered in the frame
+		size_t texels;             // texels of all cascades
+		double milliseconds;       // GPU time of the last measured update()
+		double fullMilliseconds;   // GPU time of the last update() that rendered everything
+	};
+
+	typedef void (*DrawCastersT)(const glm::mat4& viewProjection, const Frustum& region,
+		bool dynamicCasters);
+
+	static const int MAX_CASCADES = 4;
+
+	ShadowCascades(void);
+	~ShadowCascades(void);
+
+	bool   init(int cascades, GLsizei size);
+	void   release(void);
+
+	void   setLightDirection(const glm::vec3& direction);
+	void   setCasterBounds(const glm::vec3& minimum, const glm::vec3& maximum);
+	void   setCaching(bool caching) { _Caching = caching; };
+	bool   isCaching(void) const { return _Caching; };
+	void   invalidate(void);
+
+	void   update(const glm::mat4& projection, const glm::mat4& view, DrawCastersT draw);
+	void   bind(GLuint unit) const;
+
+	int    getCascadeCount(void) const { return _Cascades; };
+	const  glm::mat4& getMatrix(int cascade) const { return _Matrices[cascade]; };
+	float  getSplit(int cascade) const { return _Splits[cascade + 1]; };
+	GLuint getTexture(void) const { return _Texture; };
+	const  StatisticsT& getStatistics(void) const { return _Statistics; };
+	void   report(std::ostream& out) const;
+
+private:
+	static const int QUERY_COUNT = 4;   // updates in flight for the GPU timer queries
+
+	void   setupLight(void);
+	void   renderRegion(int cascade, int x0, int y0, int x1, int y1, DrawCastersT draw);
+	void   scroll(int cascade, const glm::ivec2& delta, DrawCastersT draw);
+	void   readQueries(void);
+
+	ShadowCascades(const ShadowCascades&);
+	ShadowCascades& operator=(const ShadowCascades&);
+
+	int       _Cascades;
+	GLsizei   _Size;
+	bool      _Caching;
+	GLuint    _Texture;                  // depth array, one layer per cascade
+	GLuint    _Static[MAX_CASCADES];     // cached static casters
+	GLuint    _Scratch;                  // scroll target, swapped with a static map
+	GLuint    _Framebuffer;
+	bool      _Valid[MAX_CASCADES];      // static map matches light and casters
+	glm::ivec2 _Origins[MAX_CASCADES];   // texel origin in light space of the static map
+
+	glm::vec3 _Direction;
+	glm::vec3 _BoundsMin;
+	glm::vec3 _BoundsMax;
+	glm::mat4 _LightView;                // rotation into light space, light along -z
+	float     _Near;                     // depth range of the casters along the light
+	float     _Far;
+
+	float     _Splits[MAX_CASCADES + 1]; // view depths
+	float     _TexelSize[MAX_CASCADES];
+	glm::mat4 _Matrices[MAX_CASCADES];
+
+	GLuint    _Queries[2 * QUERY_COUNT]; // timestamps before and after update()
+	int       _QueryStates[QUERY_COUNT]; // 0 free, 1 pending, 2 pending full re-render
+	int       _NextQuery;
+	StatisticsT _Statistics;
+};
+// class ShadowCascades ///////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // SHADOWCASCADES_H
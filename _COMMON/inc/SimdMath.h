@@ -0,0 +1,64 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   SimdMath.h
+//
+//  \brief      Runtime dispatched versions of the hot GLM math paths (matrix multiply and
+//              inverse, quaternion products and batch transforms).
+//
+//   Usage:     glm/detail/setup.hpp fixes GLM_ARCH at compile time, so a binary built for
+//              SSE2 never uses AVX2. The functions of this class exist in several instruction
+//              set variants (compiled with function target attributes) and forward to the
+//              variant selected by CpuInfo::getLevel(), which queries cpuid once at startup.
+//              Results match the corresponding GLM operators up to rounding.
+//
+//              A single multiply() of two matrices costs about as much as the dispatched call,
+//              it only pays off against GLM builds for the lowest GLM_ARCH. inverse() has no
+//              AVX-512 variant, that level inverts with the AVX2 kernel.
+//
+//              Batch transforms of vector and matrix arrays are provided by BatchTransform,
+//              which dispatches the same way.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef SIMDMATH_H
+#define SIMDMATH_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "CpuInfo.h"
+
+
+
+class SimdMath
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	static glm::mat4 multiply(const glm::mat4& a, const glm::mat4& b);
+	static glm::mat4 inverse(const glm::mat4& m);
+
+	static glm::quat multiply(const glm::quat& p, const glm::quat& q);
+	static void      multiply(const glm::quat& p, const glm::quat* q, glm::quat* out, size_t count);
+	static void      multiply(const glm::quat* p, const glm::quat* q, glm::quat* out, size_t count);
+
+	static CpuInfo::SimdLevelT getLevel(void);
+};
+// class SimdMath /////////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // SIMDMATH_H
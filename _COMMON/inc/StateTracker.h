@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   StateTracker.h
+//
+//  \brief      Thin layer over the OpenGL state calls that shadows the bound objects and the
+//              fixed function state and drops calls that would not change anything.
+//
+//   Usage:     Call the wrappers instead of the GL entry points (StateTracker::useProgram()
+//              instead of glUseProgram() etc.). Each wrapper compares the request with the
+//              shadowed value and only calls OpenGL if it differs; both outcomes are counted
+//              per call type as issued or elided. beginFrame() closes the counters of the
+//              previous frame (getFrameStatistics()), getTotalStatistics() sums all frames.
+//
+//              Shadowed state:
+//                 program, program pipeline, vertex array, buffer bindings (generic binding
+//                 points), active texture unit and the texture bindings of 32 units, the
+//                 capabilities of enable()/disable(), blend function, depth function and
+//                 mask, polygon mode (front and back) and clear color.
+//
+//              The shadow starts unknown (the first call of each kind is always issued) and
+//              has to be invalidated with invalidate() when code outside the tracker changes
+//              the same state. Deleting a bound buffer, texture, vertex array or pipeline
+//              resets its bindings to 0, so these objects are deleted with the wrappers as
+//              well (glDeleteProgram() needs no wrapper, a current program stays current).
+//              Binding a vertex array also switches the element array buffer binding, which
+//              becomes unknown. setEnabled(false) passes every call through (all counted as
+//              issued) to compare the cost with and without filtering.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef STATETRACKER_H
+#define STATETRACKER_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+
+class StateTracker
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum CallT
+	{
+		CALL_PROGRAM, CALL_PIPELINE, CALL_VERTEX_ARRAY, CALL_BUFFER, CALL_ACTIVE_TEXTURE,
+		CALL_TEXTURE, CALL_CAPABILITY, CALL_BLEND, CALL_DEPTH, CALL_POLYGON_MODE,
+		CALL_CLEAR_COLOR, CALL_COUNT
+	};
+
+	struct StatisticsT
+	{
+		size_t issued[CALL_COUNT];
+		size_t elided[CALL_COUNT];
+
+		size_t getIssued(void) const;
+		size_t getElided(void) const;
+	};
+
+	static const int MAX_TEXTURE_UNITS = 32;
+
+	static void setEnabled(bool enabled) { _Enabled = enabled; };
+	static bool isEnabled(void) { return _Enabled; };
+	static void invalidate(void);
+
+	// bound objects
+	static void useProgram(GLuint program);
+	static void bindProgramPipeline(GLuint pipeline);
+	static void bindVertexArray(GLuint vertexArray);
+	static void bindBuffer(GLenum target, GLuint buffer);
+	static void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+	static void activeTexture(GLenum unit);
+	static void bindTexture(GLenum target, GLuint texture);
+
+	static void deleteBuffers(GLsizei count, const GLuint* buffers);
+	static void deleteTextures(GLsizei count, const GLuint* textures);
+	static void deleteVertexArrays(GLsizei count, const GLuint* vertexArrays);
+	static void deleteProgramPipelines(GLsizei count, const GLuint* pipelines);
+
+	// fixed function state
+	static void enable(GLenum capability);
+	static void disable(GLenum capability);
+	static void blendFunc(GLenum source, GLenum destination);
+	static void depthFunc(GLenum function);
+	static void depthMask(GLboolean flag);
+	static void polygonMode(GLenum face, GLenum mode);
+	static void clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
+
+	// counters
+	static void beginFrame(void);
+	static const StatisticsT& getFrameStatistics(void) { return _LastFrame; };
+	static const StatisticsT& getTotalStatistics(void) { return _Total; };
+	static void report(std::ostream& out);
+
+private:
+	static const GLuint UNKNOWN = ~0u;   // shadow value of state that has to be issued
+	static const int BUFFER_TARGETS = 14;
+	static const int TEXTURE_TARGETS = 9;
+	static const int CAPABILITIES = 11;
+
+	static int  getBufferIndex(GLenum target);
+	static int  getTextureIndex(GLenum target);
+	static int  getCapabilityIndex(GLenum capability);
+	static bool filter(CallT call, bool unchanged);
+	static void setCapability(GLenum capability, bool enabled);
+
+	static bool        _Enabled;
+	static StatisticsT _Frame;
+	static StatisticsT _LastFrame;
+	static StatisticsT _Total;
+
+	static GLuint  _Program;
+	static GLuint  _Pipeline;
+	static GLuint  _VertexArray;
+	static GLuint  _Buffers[BUFFER_TARGETS];
+	static GLuint  _ActiveTexture;   // unit index
+	static GLuint  _Textures[MAX_TEXTURE_UNITS][TEXTURE_TARGETS];
+	static GLuint  _Capabilities[CAPABILITIES];   // GL_TRUE, GL_FALSE or UNKNOWN
+	static GLuint  _BlendFunc[2];
+	static GLuint  _DepthFunc;
+	static GLuint  _DepthMask;
+	static GLuint  _PolygonMode[2];   // front, back
+	static GLfloat _ClearColor[4];
+	static bool    _ClearColorKnown;
+};
+// class StateTracker /////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // STATETRACKER_H
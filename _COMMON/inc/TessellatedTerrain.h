@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   TessellatedTerrain.h
+//
+//  \brief      GPU driven adaptive tessellation of a terrain: a coarse grid of quad patches is
+//              subdivided by the tessellation stages so that the triangle density follows the
+//              screen space size of the terrain instead of a fixed mesh resolution.
+//
+//   Usage:     init() takes the terrain program (vertex, tessellation control (.tecs),
+//              tessellation evaluation (.tess) and fragment shader, e.g. glsl/helloglsl_terrain.*
+//              of the demo, owned by the caller) and creates patches x patches quad patches
+//              covering [-extent, extent] in x and z; the heights (up to height) are computed
+//              by the shaders. draw() renders the terrain with the projection (perspective),
+//              the model view matrix (e.g. lookAt() * TrackBall transformation) and the
+//              viewport size in pixels. The tessellation control shader decides per patch:
+//
+//                 levels     every edge is subdivided so that its segments cover about
+//                            setPixelsPerEdge() pixels: the diameter of the sphere around the
+//                            edge is projected to the screen, which gives both patches sharing
+//                            the edge the same level (no cracks) and does not depend on the
+//                            orientation of the edge on the screen
+//                 culling    patches whose bounding box (corners and full height range) lies
+//                            outside one clip plane and patches facing away from the eye (all
+//                            sampled normals back-facing beyond a small tolerance) get outer
+//                            levels of zero and are discarded before evaluation
+//
+//              Uniforms set by draw(): matModelView, matProjection, viewportSize, pixelsPerEdge,
+//              maxTessLevel, patchCulling, terrainSize (extent, height) and eyePosition (model
+//              coordinates). setCulling(false) tessellates all patches for comparison.
+//
+//              getStatistics() and report() show the triangles generated by the tessellator
+//              (GL_PRIMITIVES_GENERATED, read back a few frames later without waiting).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TESSELLATEDTERRAIN_H
+#define TESSELLATEDTERRAIN_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+
+class TessellatedTerrain
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	struct StatisticsT
+	{
+		int      patches;
+		GLuint64 triangles;       // generated by the tessellator in the last measured frame
+		float    pixelsPerEdge;
+		GLint    maxLevel;        // GL_MAX_TESS_GEN_LEVEL
+		bool     culling;
+	};
+
+	TessellatedTerrain(void);
+	~TessellatedTerrain(void);
+
+	bool   init(GLuint program, int patches, float extent, float height);
+	void   release(void);
+
+	void   setPixelsPerEdge(float pixels);
+	float  getPixelsPerEdge(void) const { return _Statistics.pixelsPerEdge; };
+	void   setCulling(bool culling) { _Statistics.culling = culling; };
+	bool   isCulling(void) const { return _Statistics.culling; };
+
+	void   draw(const glm::mat4& projection, const glm::mat4& modelView, GLsizei width,
+	            GLsizei height);
+
+	const  StatisticsT& getStatistics(void) const { return _Statistics; };
+	void   report(std::ostream& out) const;
+
+private:
+	static const int QUERY_COUNT = 4;   // frames in flight for the primitive queries
+
+	enum UniformT { U_MODELVIEW, U_PROJECTION, U_VIEWPORT, U_PIXELS, U_MAXLEVEL, U_CULLING,
+	                U_SIZE, U_EYE, U_COUNT };
+
+	void   readQueries(void);
+
+	TessellatedTerrain(const TessellatedTerrain&);
+	TessellatedTerrain& operator=(const TessellatedTerrain&);
+
+	GLuint  _Program;
+	GLuint  _VertexArray;
+	GLuint  _Buffers[2];              // grid corners (xz), 4 indices per patch
+	GLsizei _IndexCount;
+	float   _Extent;
+	float   _Height;
+	GLint   _Locations[U_COUNT];
+	GLuint  _Queries[QUERY_COUNT];
+	bool    _Pending[QUERY_COUNT];
+	int     _NextQuery;
+	StatisticsT _Statistics;
+};
+// class TessellatedTerrain ///////////////////////////////////////////////////////////////////////
+
+
+
+#endif // TESSELLATEDTERRAIN_H
@@ -0,0 +1,154 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   TextureLoader.h
+//
+//  \brief      Asynchronous texture loading: image files are decoded on a pool of worker
+//              threads and uploaded through a ring of pixel unpack buffers.
+//
+//   Usage:     init() creates the ring of RING_SIZE pixel unpack buffers (PBOs) and starts the
+//              worker threads. load() returns a texture name at once and queues the file; a
+//              worker decodes it to RGBA8 with ImageDecoder (FLTK image decoders, t = 0 is
+//              the bottom row) and, with MIPMAP_CPU, builds the mipmap chain with its SIMD 2x2
+//              box filter.
+//
+//              update() is called once per frame on the GL thread. It allocates immutable
+//              storage (glTexStorage2D) for decoded images and copies at most byteBudget bytes
+//              into the ring buffers, from which glTexSubImage2D() transfers them
+//              asynchronously. A buffer is reused only after its fence has signaled; if it has
+//              not, the upload continues in the next frame, so the render loop never waits for
+//              file I/O, decoding or the transfer. With MIPMAP_GPU the mipmaps are built with
+//              glGenerateMipmap() after the last row of level 0 has been uploaded.
+//
+//              Until isReady() returns true the texture has no storage and samples as
+//              incomplete texture (black). update() leaves the GL_PIXEL_UNPACK_BUFFER binding
+//              and the GL_TEXTURE_2D binding of the active texture unit at 0.
+//
+//              report() prints the number of textures, the decode time and the upload
+//              bandwidth (bytes per second spent in update()).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Decoding and box filter moved to ImageDecoder
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef TEXTURELOADER_H
+#define TEXTURELOADER_H
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <deque>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <iostream>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+
+class TextureLoader
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+public:
+	enum MipmapT { MIPMAP_NONE, MIPMAP_GPU, MIPMAP_CPU };
+
+	struct StatisticsT
+	{
+		size_t requested;       // load() calls
+		size_t loaded;          // textures completely uploaded
+		size_t failed;          // files that could not be decoded
+		size_t uploadBytes;     // bytes copied to the pixel unpack buffers
+		size_t updates;         // update() calls that uploaded data
+		size_t stalls;          // update() calls stopped by a busy ring buffer
+		double uploadSeconds;   // time spent in update() for uploads
+		double decodeSeconds;   // summed decode and mipmap time of the workers
+	};
+
+	static const size_t DEFAULT_BUFFER_SIZE = 4 << 20;
+	static const size_t DEFAULT_BUDGET = 8 << 20;
+
+	TextureLoader(void);
+	~TextureLoader(void);
+
+	void   init(unsigned workers = 0, size_t bufferSize = DEFAULT_BUFFER_SIZE);
+	void   release(void);
+
+	GLuint load(const std::string& filename, MipmapT mipmaps = MIPMAP_GPU);
+	void   update(size_t byteBudget = DEFAULT_BUDGET);
+
+	bool   isReady(GLuint texture) const { return texture && !_Loading.count(texture); };
+	size_t getPendingCount(void) const { return _Loading.size(); };
+	unsigned getWorkerCount(void) const { return unsigned(_Workers.size()); };
+
+	StatisticsT getStatistics(void);
+	void   report(std::ostream& out);
+
+private:
+	static const int RING_SIZE = 3;
+
+	struct JobT
+	{
+		GLuint      texture;
+		std::string filename;
+		MipmapT     mipmaps;
+	};
+
+	struct ImageT
+	{
+		GLuint  texture;
+		MipmapT mipmaps;
+		int     width;
+		int     height;
+		int     levels;         // levels of the texture storage
+		int     uploadLevels;   // levels contained in pixels (1 unless MIPMAP_CPU)
+		std::vector<size_t> offsets;
+		std::vector<unsigned char> pixels;   // RGBA8, level after level
+	};
+
+	struct BufferT
+	{
+		GLuint buffer;
+		GLsync fence;
+	};
+
+	TextureLoader(const TextureLoader&);
+	TextureLoader& operator=(const TextureLoader&);
+
+	void    runWorker(void);
+	ImageT* decode(const JobT& job);
+	bool    beginImage(void);
+	bool    uploadRows(size_t& bytes, size_t byteBudget);
+	void    endImage(void);
+
+	std::vector<std::thread*> _Workers;
+	std::mutex              _Mutex;      // guards jobs, decoded images and the decode statistics
+	std::condition_variable _Condition;
+	std::deque<JobT>        _Jobs;
+	std::deque<ImageT*>     _Decoded;
+	bool                    _Stop;
+
+	BufferT _Ring[RING_SIZE];
+	int     _RingNext;
+	size_t  _BufferSize;
+
+	ImageT* _Current;                    // image being uploaded
+	int     _Level;
+	int     _Row;
+
+	std::set<GLuint> _Loading;           // textures without complete storage
+	StatisticsT _Statistics;
+};
+// class TextureLoader ////////////////////////////////////////////////////////////////////////////
+
+
+
+#endif // TEXTURELOADER_H
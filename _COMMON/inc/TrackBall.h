@@ -23,6 +23,8 @@
 //     yyyy-mm-dd   Version   Author   Comment
 //     2015-09-10   1.00      klu      Initial file release
 //     2016-03-16   1.10      klu      Update for CPP course apps
+//     2026-10-18   1.20      agt      Added mouse unproject helper for picking
+//     2026-10-18   1.21      agt      Viewport width passed to rotateTrackball() for benchmarks
 //  \endverbatim
 */
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,7 +44,6 @@ private:
 
 	static void axisAmountToMat(float aa[], float mat[]);
 	static void matToAxisAmount(float mat[], float aa[]);
-	static void rotateTrackball(int dx, int dy, float rotation[4]);
 	static TrackballModeT evaluateTrackballMode(TrackballModeT new_mode = TM_INVALID);
 
 private:
@@ -76,6 +77,13 @@ public:
 	static glm::mat4& getTransformation(void);
 	static void resetTransformation(void);
 
+	// rotate an axis-angle rotation by a mouse motion (dx, dy) in a viewport width pixels wide
+	static void rotateTrackball(int dx, int dy, int width, float rotation[4]);
+
+	// create a pick ray (in the space transformed by modelView) for GLUT mouse coordinates
+	static void unprojectMouse(int x, int y, const glm::mat4& modelView, const glm::mat4& projection,
+	                           glm::vec3& origin, glm::vec3& direction);
+
 	// if required, set model origin offset
 	static void setOffset(const float offset[3]) {for (int i=0; i<3; i++) _Offset[i] = offset[i];};
 	static void getOffset(float offset[3]) { offset = _Offset; };
@@ -9,6 +9,11 @@
 //  \history
 //     yyyy-mm-dd   Version   Author   Comment
 //     2015-09-24   1.30      klu      Update for new shader based CG course
+//     2026-10-18   1.40      agt      #include support through ShaderPreprocessor
+//     2026-10-18   1.50      agt      Precompiled SPIR-V shaders (GL_ARB_gl_spirv)
+//     2026-10-18   1.60      agt      Shader files served from the mounted ResourceBundle
+//     2026-10-18   1.70      agt      Debug output filtered and logged through DebugOutput
+//     2026-10-18   1.80      agt      Info log error checks follow the ErrorCheck level
 //     2014-11-27   1.10      klu      Initial file release
 //  \endverbatim
 */
@@ -18,12 +23,28 @@
 
 // system includes ////////////////////////////////////////////////////////////////////////////////
 #include <string>
+#include <vector>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "ResourceBundle.h"
 
 
 class UtilGLSL
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
 public:
+	// specialization constants of SPIR-V shaders (constant_id and 32-bit value)
+	struct SpecializationT
+	{
+		vector<GLuint> ids;
+		vector<GLuint> values;
+
+		void set(GLuint id, GLuint value);
+		void set(GLuint id, GLint value);
+		void set(GLuint id, float value);
+	};
+
 	static void   showOpenGLVersion(void);
 	static void   showGLSLVersion(void);
 	static float  checkOpenGLVersion(void);
@@ -32,10 +53,18 @@ public:
 	static void   checkShaderInfoLog(GLuint shader);
 	static void   checkProgramInfoLog(GLuint program);
 	static GLuint initShaderProgram(int argc, char **argv);
+	static bool   findShaderFile(const string& filename, ResourceBundle::ViewT& code);
+	static char*  readShaderFile(const string& filename);   // delete[] the returned code
+
+	static bool   isSpirvSupported(void);
+	static bool   isSpirvProgram(GLuint program);
+	static GLuint initSpirvShader(GLenum type, const string& filename,
+					const SpecializationT& constants = SpecializationT(), const char* entryPoint = "main");
+	static GLuint initSpirvProgram(const vector<string>& filenames,
+					const SpecializationT& constants = SpecializationT());
 
 private:
-	static char*  readShaderFile(const string& filename);
-	static void   DebugMessageCallback(GLenum source, GLenum type, GLuint id,
-					GLenum severity, GLsizei length, const GLchar* message,	void* userParam);
+	static bool   loadSpirvShader(GLuint shader, const string& filename,
+					const SpecializationT& constants, const char* entryPoint);
 };
 // class UtilGLSL /////////////////////////////////////////////////////////////////////////////////
\ No newline at end of file
@@ -0,0 +1,497 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   BVH.cpp
+//
+//  \brief      Bounding volume hierarchy over triangle meshes for CPU ray picking.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cfloat>
+#include <cassert>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtx/intersect.hpp>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#include <emmintrin.h>
+#define BVH_USE_SSE 1
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/BVH.h"
+
+
+
+// build time triangle references /////////////////////////////////////////////////////////////////
+struct BVH::BuildDataT
+{
+	vector<BuildNodeT> nodes;
+	vector<GLuint>     refs;
+	vector<glm::vec3>  minimum, maximum, centroid;
+};
+
+
+
+namespace
+{
+	float halfArea(const glm::vec3& minimum, const glm::vec3& maximum)
+	{
+		glm::vec3 d = glm::max(maximum - minimum, glm::vec3(0.0f));
+		return d.x * d.y + d.y * d.z + d.z * d.x;
+	}
+}
+
+
+
+BVH::BVH(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Depth(0)
+{
+}
+// BVH::BVH() /////////////////////////////////////////////////////////////////////////////////////
+
+
+
+void BVH::build(const Mesh& mesh)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	build(mesh.positions.empty() ? NULL : &mesh.positions[0],
+		mesh.indices.empty() ? NULL : &mesh.indices[0], mesh.getTriangleCount());
+}
+// BVH::build() ///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: build()
+// purpose:  Builds a binary SAH hierarchy over the triangles and collapses it into the 4-wide
+//           node layout used for traversal.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void BVH::build(const glm::vec3* positions, const GLuint* indices, GLsizei triangleCount)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Nodes.clear();
+	_Triangles.clear();
+	_Depth = 0;
+	if (triangleCount <= 0) return;
+
+	BuildDataT data;
+	data.refs.resize(triangleCount);
+	data.minimum.resize(triangleCount);
+	data.maximum.resize(triangleCount);
+	data.centroid.resize(triangleCount);
+	data.nodes.reserve(2 * triangleCount / MAX_LEAF_SIZE + 1);
+
+	for (GLsizei t = 0; t < triangleCount; ++t)
+	{
+		const glm::vec3& a = positions[indices[3 * t + 0]];
+		const glm::vec3& b = positions[indices[3 * t + 1]];
+		const glm::vec3& c = positions[indices[3 * t + 2]];
+		data.refs[t] = GLuint(t);
+		data.minimum[t] = glm::min(a, glm::min(b, c));
+		data.maximum[t] = glm::max(a, glm::max(b, c));
+		data.centroid[t] = 0.5f * (data.minimum[t] + data.maximum[t]);
+	}
+
+	buildRecursive(data, 0, GLuint(triangleCount), 0);
+
+	// store the triangles in leaf order
+	_Triangles.resize(triangleCount);
+	for (GLsizei i = 0; i < triangleCount; ++i)
+	{
+		GLuint t = data.refs[i];
+		const glm::vec3& a = positions[indices[3 * t + 0]];
+		_Triangles[i].v0 = a;
+		_Triangles[i].e1 = positions[indices[3 * t + 1]] - a;
+		_Triangles[i].e2 = positions[indices[3 * t + 2]] - a;
+		_Triangles[i].id = t;
+	}
+
+	_Nodes.reserve(data.nodes.size() / 2 + 1);
+	collapse(data.nodes, 0, 1);
+}
+// BVH::build() ///////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: buildRecursive()
+// purpose:  Splits the triangle range with the binned surface area heuristic over all three
+//           axes and returns the index of the created binary node. Splits at the object median
+//           when only these still reach the leaves within MAX_DEPTH.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint BVH::buildRecursive(BuildDataT& data, GLuint first, GLuint count, int depth)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	assert(depth <= MAX_DEPTH);
+	GLuint index = GLuint(data.nodes.size());
+	data.nodes.push_back(BuildNodeT());
+
+	glm::vec3 minimum(FLT_MAX), maximum(-FLT_MAX);
+	glm::vec3 cmin(FLT_MAX), cmax(-FLT_MAX);
+	for (GLuint i = first; i < first + count; ++i)
+	{
+		GLuint t = data.refs[i];
+		minimum = glm::min(minimum, data.minimum[t]);
+		maximum = glm::max(maximum, data.maximum[t]);
+		cmin = glm::min(cmin, data.centroid[t]);
+		cmax = glm::max(cmax, data.centroid[t]);
+	}
+
+	BuildNodeT& node = data.nodes[index];
+	node.minimum = minimum;
+	node.maximum = maximum;
+	node.first = first;
+	node.count = count;
+	node.left = node.right = 0;
+	if (count <= GLuint(MAX_LEAF_SIZE)) return index;
+
+	// median splits need medianLevels more levels, an SAH split must leave room for them
+	int medianLevels = 0;
+	for (GLuint n = count; n > GLuint(MAX_LEAF_SIZE); n = (n + 1) / 2) ++medianLevels;
+	bool useSAH = (depth + 1 + medianLevels <= MAX_DEPTH);
+
+	// evaluate SAH_BINS - 1 split planes per axis
+	int bestAxis = -1, bestSplit = 0;
+	float bestCost = FLT_MAX;
+	for (int axis = 0; useSAH && axis < 3; ++axis)
+	{
+		float extent = cmax[axis] - cmin[axis];
+		if (extent <= 0.0f) continue;
+
+		GLuint    binCount[SAH_BINS] = { 0 };
+		glm::vec3 binMin[SAH_BINS], binMax[SAH_BINS];
+		for (int b = 0; b < SAH_BINS; ++b) { binMin[b] = glm::vec3(FLT_MAX); binMax[b] = glm::vec3(-FLT_MAX); }
+
+		float scale = SAH_BINS / extent;
+		for (GLuint i = first; i < first + count; ++i)
+		{
+			GLuint t = data.refs[i];
+			int b = min(int((data.centroid[t][axis] - cmin[axis]) * scale), SAH_BINS - 1);
+			binCount[b]++;
+			binMin[b] = glm::min(binMin[b], data.minimum[t]);
+			binMax[b] = glm::max(binMax[b], data.maximum[t]);
+		}
+
+		// sweep from the right to get the right side costs, then from the left
+		float  rightCost[SAH_BINS];
+		GLuint n = 0;
+		glm::vec3 bmin(FLT_MAX), bmax(-FLT_MAX);
+		for (int b = SAH_BINS - 1; b > 0; --b)
+		{
+			n += binCount[b];
+			bmin = glm::min(bmin, binMin[b]);
+			bmax = glm::max(bmax, binMax[b]);
+			rightCost[b] = n ? n * halfArea(bmin, bmax) : 0.0f;
+		}
+
+		n = 0;
+		bmin = glm::vec3(FLT_MAX); bmax = glm::vec3(-FLT_MAX);
+		for (int b = 0; b < SAH_BINS - 1; ++b)
+		{
+			n += binCount[b];
+			bmin = glm::min(bmin, binMin[b]);
+			bmax = glm::max(bmax, binMax[b]);
+			float cost = (n ? n * halfArea(bmin, bmax) : 0.0f) + rightCost[b + 1];
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				bestAxis = axis;
+				bestSplit = b + 1;
+			}
+		}
+	}
+
+	GLuint middle = first + count / 2;
+	if (bestAxis >= 0)
+	{
+		float extent = cmax[bestAxis] - cmin[bestAxis];
+		float scale = SAH_BINS / extent;
+		GLuint* begin = &data.refs[0] + first;
+		GLuint* split = std::partition(begin, begin + count, [&](GLuint t)
+		{
+			return min(int((data.centroid[t][bestAxis] - cmin[bestAxis]) * scale), SAH_BINS - 1) < bestSplit;
+		});
+		middle = GLuint(split - &data.refs[0]);
+	}
+
+	// fall back to an object median split for degenerate partitions
+	if (middle == first || middle == first + count) middle = first + count / 2;
+
+	GLuint left = buildRecursive(data, first, middle - first, depth + 1);
+	GLuint right = buildRecursive(data, middle, first + count - middle, depth + 1);
+	data.nodes[index].left = left;
+	data.nodes[index].right = right;
+	data.nodes[index].count = 0;
+	return index;
+}
+// BVH::buildRecursive() //////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: collapse()
+// purpose:  Creates a 4-wide node by repeatedly opening the largest interior child of the binary
+//           node, then collapses the remaining interior children recursively.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint BVH::collapse(const vector<BuildNodeT>& nodes, GLuint node, int depth)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint index = GLuint(_Nodes.size());
+	_Nodes.push_back(NodeT());
+	_Depth = max(_Depth, depth);
+
+	GLuint children[4];
+	int count = 0;
+	if (nodes[node].count > 0)
+	{
+		children[count++] = node; // single leaf root
+	}
+	else
+	{
+		children[count++] = nodes[node].left;
+		children[count++] = nodes[node].right;
+	}
+
+	while (count < 4)
+	{
+		int largest = -1;
+		float area = -1.0f;
+		for (int i = 0; i < count; ++i)
+		{
+			const BuildNodeT& c = nodes[children[i]];
+			if (c.count == 0 && halfArea(c.minimum, c.maximum) > area)
+			{
+				area = halfArea(c.minimum, c.maximum);
+				largest = i;
+			}
+		}
+		if (largest < 0) break;
+
+		GLuint opened = children[largest];
+		children[largest] = nodes[opened].left;
+		children[count++] = nodes[opened].right;
+	}
+
+	for (int i = 0; i < 4; ++i)
+	{
+		GLuint code = EMPTY;
+		glm::vec3 minimum(FLT_MAX), maximum(-FLT_MAX);
+		if (i < count)
+		{
+			const BuildNodeT& c = nodes[children[i]];
+			minimum = c.minimum;
+			maximum = c.maximum;
+			code = (c.count > 0) ? (LEAF_BIT | c.first << 3 | c.count) : collapse(nodes, children[i], depth + 1);
+		}
+
+		NodeT& n = _Nodes[index]; // may have moved during recursion
+		for (int k = 0; k < 3; ++k)
+		{
+			n.bounds[k][i] = minimum[k];
+			n.bounds[k + 3][i] = maximum[k];
+		}
+		n.child[i] = code;
+	}
+	return index;
+}
+// BVH::collapse() ////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: intersectLeaf()
+// purpose:  Moeller-Trumbore test of all leaf triangles (same conventions as GLM_GTX_intersect).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool BVH::intersectLeaf(GLuint leaf, const glm::vec3& origin, const glm::vec3& direction, HitT& hit) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const float epsilon = numeric_limits<float>::epsilon();
+	GLuint first = (leaf & ~LEAF_BIT) >> 3;
+	GLuint count = leaf & 7;
+	bool found = false;
+
+	for (GLuint i = first; i < first + count; ++i)
+	{
+		const TriangleT& tri = _Triangles[i];
+		glm::vec3 p = glm::cross(direction, tri.e2);
+		float a = glm::dot(tri.e1, p);
+		if (a < epsilon && a > -epsilon) continue;
+
+		float f = 1.0f / a;
+		glm::vec3 s = origin - tri.v0;
+		float u = f * glm::dot(s, p);
+		if (u < 0.0f || u > 1.0f) continue;
+
+		glm::vec3 q = glm::cross(s, tri.e1);
+		float v = f * glm::dot(direction, q);
+		if (v < 0.0f || u + v > 1.0f) continue;
+
+		float t = f * glm::dot(tri.e2, q);
+		if (t >= 0.0f && t < hit.distance)
+		{
+			hit.distance = t;
+			hit.barycentric = glm::vec2(u, v);
+			hit.triangle = tri.id;
+			found = true;
+		}
+	}
+	return found;
+}
+// BVH::intersectLeaf() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: intersect()
+// purpose:  Returns the closest hit along the ray within [0, maxDistance). The child boxes of a
+//           node are tested at once, hit children are pushed far to near so that the closest
+//           one is visited first and entries behind the current hit are skipped.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool BVH::intersect(const glm::vec3& origin, const glm::vec3& direction, HitT& hit, float maxDistance) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	hit.distance = maxDistance;
+	hit.barycentric = glm::vec2(0.0f);
+	hit.triangle = EMPTY;
+	if (_Nodes.empty()) return false;
+
+	// avoid NaNs in the slab test for axis parallel rays
+	glm::vec3 inverse;
+	int nearBound[3], farBound[3];
+	for (int k = 0; k < 3; ++k)
+	{
+		float d = direction[k];
+		if (fabs(d) < 1.0e-20f) d = (d < 0.0f) ? -1.0e-20f : 1.0e-20f;
+		inverse[k] = 1.0f / d;
+		nearBound[k] = (inverse[k] >= 0.0f) ? k : k + 3;
+		farBound[k] = (inverse[k] >= 0.0f) ? k + 3 : k;
+	}
+
+	struct EntryT { GLuint code; float distance; } stack[STACK_SIZE];
+	int top = 0;
+	stack[top].code = 0;
+	stack[top++].distance = 0.0f;
+	bool found = false;
+
+#ifdef BVH_USE_SSE
+	const __m128 ox = _mm_set1_ps(origin.x), oy = _mm_set1_ps(origin.y), oz = _mm_set1_ps(origin.z);
+	const __m128 ix = _mm_set1_ps(inverse.x), iy = _mm_set1_ps(inverse.y), iz = _mm_set1_ps(inverse.z);
+#endif
+
+	while (top > 0)
+	{
+		EntryT entry = stack[--top];
+		if (entry.distance > hit.distance) continue;
+
+		if (entry.code & LEAF_BIT)
+		{
+			found |= intersectLeaf(entry.code, origin, direction, hit);
+			continue;
+		}
+
+		const NodeT& node = _Nodes[entry.code];
+		float tnear[4];
+		int mask = 0;
+
+#ifdef BVH_USE_SSE
+		__m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.bounds[nearBound[0]]), ox), ix);
+		__m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.bounds[farBound[0]]), ox), ix);
+		__m128 tmin = _mm_max_ps(t0, _mm_setzero_ps());
+		__m128 tmax = _mm_min_ps(t1, _mm_set1_ps(hit.distance));
+
+		t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.bounds[nearBound[1]]), oy), iy);
+		t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.bounds[farBound[1]]), oy), iy);
+		tmin = _mm_max_ps(tmin, t0);
+		tmax = _mm_min_ps(tmax, t1);
+
+		t0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.bounds[nearBound[2]]), oz), iz);
+		t1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(node.bounds[farBound[2]]), oz), iz);
+		tmin = _mm_max_ps(tmin, t0);
+		tmax = _mm_min_ps(tmax, t1);
+
+		mask = _mm_movemask_ps(_mm_cmple_ps(tmin, tmax));
+		_mm_storeu_ps(tnear, tmin);
+#else
+		for (int i = 0; i < 4; ++i)
+		{
+			float tmin = 0.0f, tmax = hit.distance;
+			for (int k = 0; k < 3; ++k)
+			{
+				tmin = max(tmin, (node.bounds[nearBound[k]][i] - origin[k]) * inverse[k]);
+				tmax = min(tmax, (node.bounds[farBound[k]][i] - origin[k]) * inverse[k]);
+			}
+			tnear[i] = tmin;
+			if (tmin <= tmax) mask |= 1 << i;
+		}
+#endif
+
+		// sort the hit children by entry distance (far first) and push them
+		EntryT hits[4];
+		int count = 0;
+		for (int i = 0; i < 4; ++i)
+		{
+			if (!(mask & (1 << i))) continue;
+			EntryT e = { node.child[i], tnear[i] };
+			int j = count++;
+			while (j > 0 && hits[j - 1].distance < e.distance) { hits[j] = hits[j - 1]; --j; }
+			hits[j] = e;
+		}
+		assert(top + count <= STACK_SIZE); // guaranteed by the MAX_DEPTH of the build
+		for (int i = 0; i < count; ++i) stack[top++] = hits[i];
+	}
+
+	return found;
+}
+// BVH::intersect() ///////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: intersectBruteForce()
+// purpose:  Reference implementation testing every triangle with glm::intersectRayTriangle().
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool BVH::intersectBruteForce(const Mesh& mesh, const glm::vec3& origin, const glm::vec3& direction,
+	HitT& hit, float maxDistance)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	hit.distance = maxDistance;
+	hit.barycentric = glm::vec2(0.0f);
+	hit.triangle = EMPTY;
+	bool found = false;
+
+	for (GLsizei t = 0; t < mesh.getTriangleCount(); ++t)
+	{
+		glm::vec3 bary;
+		if (glm::intersectRayTriangle(origin, direction, mesh.positions[mesh.indices[3 * t + 0]],
+			mesh.positions[mesh.indices[3 * t + 1]], mesh.positions[mesh.indices[3 * t + 2]], bary)
+			&& bary.z < hit.distance)
+		{
+			hit.distance = bary.z;
+			hit.barycentric = glm::vec2(bary);
+			hit.triangle = GLuint(t);
+			found = true;
+		}
+	}
+	return found;
+}
+// BVH::intersectBruteForce() /////////////////////////////////////////////////////////////////////
@@ -0,0 +1,384 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   BatchTransform.cpp
+//
+//  \brief      Batched matrix transforms of vector and matrix streams with SSE2, AVX2 and
+//              AVX-512 kernels selected at runtime.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <cstddef>
+
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/BatchTransform.h"
+
+
+
+// kernels work on plain float arrays (column major matrices) //////////////////////////////////////
+namespace
+{
+	struct KernelsT
+	{
+		void (*transform)(const float* m, const float* in, float* out, size_t count);
+		void (*multiply)(const float* a, const float* b, float* out, size_t count);
+		void (*transformSoA)(const float* m, const BatchTransform::StreamT& in,
+			const BatchTransform::StreamT& out, size_t count);
+	};
+
+	const float ONE = 1.0f;
+
+
+	// scalar reference kernels ///////////////////////////////////////////////////////////////////
+	void transformScalar(const float* m, const float* in, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i, in += 4, out += 4)
+		{
+			float x = in[0], y = in[1], z = in[2], w = in[3];
+			for (int r = 0; r < 4; ++r) out[r] = m[r] * x + m[4 + r] * y + m[8 + r] * z + m[12 + r] * w;
+		}
+	}
+
+	void multiplyScalar(const float* a, const float* b, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i, a += 16, b += 16, out += 16)
+		{
+			float column[16];
+			for (int c = 0; c < 4; ++c)
+			{
+				transformScalar(a, b + 4 * c, column + 4 * c, 1);
+			}
+			for (int k = 0; k < 16; ++k) out[k] = column[k];
+		}
+	}
+
+	void transformSoAScalar(const float* m, const BatchTransform::StreamT& in,
+		const BatchTransform::StreamT& out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			float x = in.x[i], y = in.y[i], z = in.z[i], w = in.w ? in.w[i] : ONE;
+			out.x[i] = m[0] * x + m[4] * y + m[8] * z + m[12] * w;
+			out.y[i] = m[1] * x + m[5] * y + m[9] * z + m[13] * w;
+			out.z[i] = m[2] * x + m[6] * y + m[10] * z + m[14] * w;
+			if (out.w) out.w[i] = m[3] * x + m[7] * y + m[11] * z + m[15] * w;
+		}
+	}
+
+#if CG_SIMD_X86
+
+	// SSE2 kernels: one vector (or matrix column) per register ///////////////////////////////////
+	inline __m128 mulVec4SSE2(const __m128 c[4], __m128 v)
+	{
+		__m128 r = _mm_mul_ps(c[0], _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0)));
+		r = _mm_add_ps(r, _mm_mul_ps(c[1], _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))));
+		r = _mm_add_ps(r, _mm_mul_ps(c[2], _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))));
+		return _mm_add_ps(r, _mm_mul_ps(c[3], _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))));
+	}
+
+	void transformSSE2(const float* m, const float* in, float* out, size_t count)
+	{
+		__m128 c[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+		for (size_t i = 0; i < count; ++i)
+		{
+			_mm_storeu_ps(out + 4 * i, mulVec4SSE2(c, _mm_loadu_ps(in + 4 * i)));
+		}
+	}
+
+	void multiplySSE2(const float* a, const float* b, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i, a += 16, b += 16, out += 16)
+		{
+			__m128 c[4] = { _mm_loadu_ps(a), _mm_loadu_ps(a + 4), _mm_loadu_ps(a + 8), _mm_loadu_ps(a + 12) };
+			__m128 r0 = mulVec4SSE2(c, _mm_loadu_ps(b));
+			__m128 r1 = mulVec4SSE2(c, _mm_loadu_ps(b + 4));
+			__m128 r2 = mulVec4SSE2(c, _mm_loadu_ps(b + 8));
+			__m128 r3 = mulVec4SSE2(c, _mm_loadu_ps(b + 12));
+			_mm_storeu_ps(out, r0);
+			_mm_storeu_ps(out + 4, r1);
+			_mm_storeu_ps(out + 8, r2);
+			_mm_storeu_ps(out + 12, r3);
+		}
+	}
+
+	void transformSoASSE2(const float* m, const BatchTransform::StreamT& in,
+		const BatchTransform::StreamT& out, size_t count)
+	{
+		__m128 e[16];
+		for (int k = 0; k < 16; ++k) e[k] = _mm_set1_ps(m[k]);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 x = _mm_loadu_ps(in.x + i), y = _mm_loadu_ps(in.y + i), z = _mm_loadu_ps(in.z + i);
+			__m128 w = in.w ? _mm_loadu_ps(in.w + i) : _mm_set1_ps(1.0f);
+			__m128 r[4];
+			for (int row = 0; row < 4; ++row)
+			{
+				r[row] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e[row], x), _mm_mul_ps(e[4 + row], y)),
+					_mm_add_ps(_mm_mul_ps(e[8 + row], z), _mm_mul_ps(e[12 + row], w)));
+			}
+			_mm_storeu_ps(out.x + i, r[0]);
+			_mm_storeu_ps(out.y + i, r[1]);
+			_mm_storeu_ps(out.z + i, r[2]);
+			if (out.w) _mm_storeu_ps(out.w + i, r[3]);
+		}
+
+		BatchTransform::StreamT tailIn = { in.x + i, in.y + i, in.z + i, in.w ? in.w + i : NULL };
+		BatchTransform::StreamT tailOut = { out.x + i, out.y + i, out.z + i, out.w ? out.w + i : NULL };
+		transformSoAScalar(m, tailIn, tailOut, count - i);
+	}
+
+
+	// AVX2 kernels: two vectors (or matrix columns) per register with FMA ////////////////////////
+	CG_TARGET_AVX2 inline __m256 mulVec4AVX2(const __m256 c[4], __m256 v)
+	{
+		__m256 r = _mm256_mul_ps(c[0], _mm256_permute_ps(v, 0x00));
+		r = _mm256_fmadd_ps(c[1], _mm256_permute_ps(v, 0x55), r);
+		r = _mm256_fmadd_ps(c[2], _mm256_permute_ps(v, 0xaa), r);
+		return _mm256_fmadd_ps(c[3], _mm256_permute_ps(v, 0xff), r);
+	}
+
+	CG_TARGET_AVX2 void transformAVX2(const float* m, const float* in, float* out, size_t count)
+	{
+		__m256 c[4] = { _mm256_broadcast_ps((const __m128*) m), _mm256_broadcast_ps((const __m128*) (m + 4)),
+			_mm256_broadcast_ps((const __m128*) (m + 8)), _mm256_broadcast_ps((const __m128*) (m + 12)) };
+
+		size_t i = 0;
+		for (; i + 2 <= count; i += 2)
+		{
+			_mm256_storeu_ps(out + 4 * i, mulVec4AVX2(c, _mm256_loadu_ps(in + 4 * i)));
+		}
+		if (i < count)
+		{
+			__m256 v = _mm256_castps128_ps256(_mm_loadu_ps(in + 4 * i));
+			_mm_storeu_ps(out + 4 * i, _mm256_castps256_ps128(mulVec4AVX2(c, v)));
+		}
+	}
+
+	CG_TARGET_AVX2 void multiplyAVX2(const float* a, const float* b, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i, a += 16, b += 16, out += 16)
+		{
+			__m256 c[4] = { _mm256_broadcast_ps((const __m128*) a), _mm256_broadcast_ps((const __m128*) (a + 4)),
+				_mm256_broadcast_ps((const __m128*) (a + 8)), _mm256_broadcast_ps((const __m128*) (a + 12)) };
+			__m256 r01 = mulVec4AVX2(c, _mm256_loadu_ps(b));
+			__m256 r23 = mulVec4AVX2(c, _mm256_loadu_ps(b + 8));
+			_mm256_storeu_ps(out, r01);
+			_mm256_storeu_ps(out + 8, r23);
+		}
+	}
+
+	CG_TARGET_AVX2 void transformSoAAVX2(const float* m, const BatchTransform::StreamT& in,
+		const BatchTransform::StreamT& out, size_t count)
+	{
+		__m256 e[16];
+		for (int k = 0; k < 16; ++k) e[k] = _mm256_set1_ps(m[k]);
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 x = _mm256_loadu_ps(in.x + i), y = _mm256_loadu_ps(in.y + i), z = _mm256_loadu_ps(in.z + i);
+			__m256 w = in.w ? _mm256_loadu_ps(in.w + i) : _mm256_set1_ps(1.0f);
+			__m256 r[4];
+			for (int row = 0; row < 4; ++row)
+			{
+				r[row] = _mm256_fmadd_ps(e[row], x, _mm256_fmadd_ps(e[4 + row], y,
+					_mm256_fmadd_ps(e[8 + row], z, _mm256_mul_ps(e[12 + row], w))));
+			}
+			_mm256_storeu_ps(out.x + i, r[0]);
+			_mm256_storeu_ps(out.y + i, r[1]);
+			_mm256_storeu_ps(out.z + i, r[2]);
+			if (out.w) _mm256_storeu_ps(out.w + i, r[3]);
+		}
+
+		BatchTransform::StreamT tailIn = { in.x + i, in.y + i, in.z + i, in.w ? in.w + i : NULL };
+		BatchTransform::StreamT tailOut = { out.x + i, out.y + i, out.z + i, out.w ? out.w + i : NULL };
+		transformSoASSE2(m, tailIn, tailOut, count - i);
+	}
+
+
+	// AVX-512 kernels: four vectors (or a whole matrix) per register, masked tails ///////////////
+	CG_TARGET_AVX512 inline __m512 mulVec4AVX512(const __m512 c[4], __m512 v)
+	{
+		__m512 r = _mm512_mul_ps(c[0], _mm512_permute_ps(v, 0x00));
+		r = _mm512_fmadd_ps(c[1], _mm512_permute_ps(v, 0x55), r);
+		r = _mm512_fmadd_ps(c[2], _mm512_permute_ps(v, 0xaa), r);
+		return _mm512_fmadd_ps(c[3], _mm512_permute_ps(v, 0xff), r);
+	}
+
+	CG_TARGET_AVX512 void transformAVX512(const float* m, const float* in, float* out, size_t count)
+	{
+		__m512 c[4] = { _mm512_broadcast_f32x4(_mm_loadu_ps(m)), _mm512_broadcast_f32x4(_mm_loadu_ps(m + 4)),
+			_mm512_broadcast_f32x4(_mm_loadu_ps(m + 8)), _mm512_broadcast_f32x4(_mm_loadu_ps(m + 12)) };
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm512_storeu_ps(out + 4 * i, mulVec4AVX512(c, _mm512_loadu_ps(in + 4 * i)));
+		}
+		if (i < count)
+		{
+			__mmask16 mask = __mmask16((1u << (4 * (count - i))) - 1);
+			__m512 v = _mm512_maskz_loadu_ps(mask, in + 4 * i);
+			_mm512_mask_storeu_ps(out + 4 * i, mask, mulVec4AVX512(c, v));
+		}
+	}
+
+	CG_TARGET_AVX512 void multiplyAVX512(const float* a, const float* b, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i, a += 16, b += 16, out += 16)
+		{
+			__m512 c[4] = { _mm512_broadcast_f32x4(_mm_loadu_ps(a)), _mm512_broadcast_f32x4(_mm_loadu_ps(a + 4)),
+				_mm512_broadcast_f32x4(_mm_loadu_ps(a + 8)), _mm512_broadcast_f32x4(_mm_loadu_ps(a + 12)) };
+			_mm512_storeu_ps(out, mulVec4AVX512(c, _mm512_loadu_ps(b)));
+		}
+	}
+
+	CG_TARGET_AVX512 void transformSoAAVX512(const float* m, const BatchTransform::StreamT& in,
+		const BatchTransform::StreamT& out, size_t count)
+	{
+		__m512 e[16];
+		for (int k = 0; k < 16; ++k) e[k] = _mm512_set1_ps(m[k]);
+
+		for (size_t i = 0; i < count; i += 16)
+		{
+			__mmask16 mask = (count - i >= 16) ? __mmask16(0xffff) : __mmask16((1u << (count - i)) - 1);
+			__m512 x = _mm512_maskz_loadu_ps(mask, in.x + i);
+			__m512 y = _mm512_maskz_loadu_ps(mask, in.y + i);
+			__m512 z = _mm512_maskz_loadu_ps(mask, in.z + i);
+			__m512 w = in.w ? _mm512_maskz_loadu_ps(mask, in.w + i) : _mm512_set1_ps(1.0f);
+			__m512 r[4];
+			for (int row = 0; row < 4; ++row)
+			{
+				r[row] = _mm512_fmadd_ps(e[row], x, _mm512_fmadd_ps(e[4 + row], y,
+					_mm512_fmadd_ps(e[8 + row], z, _mm512_mul_ps(e[12 + row], w))));
+			}
+			_mm512_mask_storeu_ps(out.x + i, mask, r[0]);
+			_mm512_mask_storeu_ps(out.y + i, mask, r[1]);
+			_mm512_mask_storeu_ps(out.z + i, mask, r[2]);
+			if (out.w) _mm512_mask_storeu_ps(out.w + i, mask, r[3]);
+		}
+	}
+
+#endif // CG_SIMD_X86
+
+
+	// kernel sets indexed by CpuInfo::SimdLevelT /////////////////////////////////////////////////
+	const KernelsT KERNELS[] =
+	{
+		{ transformScalar, multiplyScalar, transformSoAScalar },
+#if CG_SIMD_X86
+		{ transformSSE2, multiplySSE2, transformSoASSE2 },
+		{ transformAVX2, multiplyAVX2, transformSoAAVX2 },
+		{ transformAVX512, multiplyAVX512, transformSoAAVX512 },
+#endif
+	};
+
+	inline const KernelsT& getKernels(void)
+	{
+		int level = BatchTransform::getLevel();
+		return KERNELS[level < int(sizeof(KERNELS) / sizeof(KERNELS[0])) ? level : 0];
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: transform()
+// purpose:  out[i] = matrix * in[i] for count vectors.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void BatchTransform::transform(const glm::mat4& matrix, const glm::vec4* in, glm::vec4* out,
+	size_t count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	getKernels().transform(glm::value_ptr(matrix), (const float*) in, (float*) out, count);
+}
+// BatchTransform::transform() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: multiply()
+// purpose:  out[i] = a[i] * b[i] for count matrices (e.g. parent * local transforms).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void BatchTransform::multiply(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	getKernels().multiply((const float*) a, (const float*) b, (float*) out, count);
+}
+// BatchTransform::multiply() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: transformSoA()
+// purpose:  Transforms count vectors of a transposed stream. If in.w is NULL the vectors are
+//           points (w = 1), if out.w is NULL the transformed w is not stored.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void BatchTransform::transformSoA(const glm::mat4& matrix, const StreamT& in, const StreamT& out,
+	size_t count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	getKernels().transformSoA(glm::value_ptr(matrix), in, out, count);
+}
+// BatchTransform::transformSoA() /////////////////////////////////////////////////////////////////
+
+
+
+void* BatchTransform::allocate(size_t bytes)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+#if defined(_MSC_VER)
+	return _aligned_malloc(bytes, 64);
+#else
+	void* memory = NULL;
+	return (posix_memalign(&memory, 64, bytes) == 0) ? memory : NULL;
+#endif
+}
+// BatchTransform::allocate() /////////////////////////////////////////////////////////////////////
+
+
+
+void BatchTransform::release(void* memory)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+#if defined(_MSC_VER)
+	_aligned_free(memory);
+#else
+	free(memory);
+#endif
+}
+// BatchTransform::release() //////////////////////////////////////////////////////////////////////
+
+
+
+CpuInfo::SimdLevelT BatchTransform::getLevel(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return CpuInfo::getLevel();
+}
+// BatchTransform::getLevel() /////////////////////////////////////////////////////////////////////
@@ -0,0 +1,671 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ClusteredLighting.cpp
+//
+//  \brief      Clustered light assignment: bins point and spot lights into a 3D grid of view
+//              frustum cells (froxels) and provides the per-cluster light index lists in
+//              shader storage buffers for forward shading.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+using namespace std;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#endif
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/ClusteredLighting.h"
+#include "../inc/BatchTransform.h"
+#include "../inc/StateTracker.h"
+#include "../inc/ErrorCheck.h"
+#include "../inc/CpuInfo.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const int    ClusteredLighting::MAX_CLUSTER_LIGHTS;
+const GLuint ClusteredLighting::PARAMETER_BINDING;
+const GLuint ClusteredLighting::LIGHT_BINDING;
+const GLuint ClusteredLighting::BOUNDS_BINDING;
+const GLuint ClusteredLighting::GRID_BINDING;
+const GLuint ClusteredLighting::INDEX_BINDING;
+
+
+
+// sphere against box tests of one tile row (boxes as structure of arrays) ///////////////////////
+namespace
+{
+	struct BoxArrayT
+	{
+		const float* minX;
+		const float* minY;
+		const float* minZ;
+		const float* maxX;
+		const float* maxY;
+		const float* maxZ;
+	};
+
+	// writes the indices of the boxes in [begin, end) that the sphere (center, radius) overlaps
+	// and returns their number; end - begin is a multiple of 4
+	typedef int (*OverlapT)(const BoxArrayT& boxes, int begin, int end, const glm::vec4& sphere,
+		int* hits);
+
+	const int GROUP_SIZE = 64;   // local size of the assignment compute shader
+
+
+	// squared distance from the center to the box, the same arithmetic as the compute shader
+	int overlapScalar(const BoxArrayT& boxes, int begin, int end, const glm::vec4& sphere,
+		int* hits)
+	{
+		float radius2 = sphere.w * sphere.w;
+		int count = 0;
+		for (int i = begin; i < end; ++i)
+		{
+			float dx = max(boxes.minX[i] - sphere.x, 0.0f) + max(sphere.x - boxes.maxX[i], 0.0f);
+			float dy = max(boxes.minY[i] - sphere.y, 0.0f) + max(sphere.y - boxes.maxY[i], 0.0f);
+			float dz = max(boxes.minZ[i] - sphere.z, 0.0f) + max(sphere.z - boxes.maxZ[i], 0.0f);
+			float distance2 = dx * dx + dy * dy;
+			distance2 = distance2 + dz * dz;
+			hits[count] = i;
+			count += (distance2 <= radius2);
+		}
+		return count;
+	}
+
+#if CG_SIMD_X86
+	// 4 boxes per iteration
+	int overlapSSE2(const BoxArrayT& boxes, int begin, int end, const glm::vec4& sphere,
+		int* hits)
+	{
+		__m128 x = _mm_set1_ps(sphere.x), y = _mm_set1_ps(sphere.y), z = _mm_set1_ps(sphere.z);
+		__m128 radius2 = _mm_set1_ps(sphere.w * sphere.w), zero = _mm_setzero_ps();
+		int count = 0;
+		for (int i = begin; i < end; i += 4)
+		{
+			__m128 dx = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(boxes.minX + i), x), zero),
+				_mm_max_ps(_mm_sub_ps(x, _mm_loadu_ps(boxes.maxX + i)), zero));
+			__m128 dy = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(boxes.minY + i), y), zero),
+				_mm_max_ps(_mm_sub_ps(y, _mm_loadu_ps(boxes.maxY + i)), zero));
+			__m128 dz = _mm_add_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(boxes.minZ + i), z), zero),
+				_mm_max_ps(_mm_sub_ps(z, _mm_loadu_ps(boxes.maxZ + i)), zero));
+			__m128 distance2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+			distance2 = _mm_add_ps(distance2, _mm_mul_ps(dz, dz));
+
+			int mask = _mm_movemask_ps(_mm_cmple_ps(distance2, radius2));
+			for (int k = 0; mask; ++k, mask >>= 1)
+			{
+				hits[count] = i + k;
+				count += (mask & 1);
+			}
+		}
+		return count;
+	}
+#endif // CG_SIMD_X86
+}
+
+
+
+ClusteredLighting::ClusteredLighting(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _TilesX(0), _TilesY(0), _Slices(0), _RowStride(0), _IndexCapacity(0), _Program(0),
+  _Mode(MODE_CPU), _QueryPending(false), _Milliseconds(0.0), _Projection(0.0f)
+{
+	for (int i = 0; i < BUFFER_COUNT; ++i) _Buffers[i] = 0;
+	_Queries[0] = _Queries[1] = 0;
+	_Parameters = ParametersT();
+}
+// ClusteredLighting::ClusteredLighting() /////////////////////////////////////////////////////////
+
+
+
+ClusteredLighting::~ClusteredLighting(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// ClusteredLighting::~ClusteredLighting() ////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  Creates the buffers of a tilesX x tilesY x slices grid with room for indexCapacity
+//           light indices in all lists together. program is the assignment compute shader
+//           (glsl/helloglsl_clusters.comp of the demo, owned by the caller), without it only
+//           MODE_CPU is available.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ClusteredLighting::init(int tilesX, int tilesY, int slices, size_t indexCapacity,
+	GLuint program)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+	if (tilesX < 1 || tilesY < 1 || slices < 1 || !indexCapacity)
+	{
+		cout << "Error: invalid cluster grid " << tilesX << "x" << tilesY << "x" << slices << endl;
+		return false;
+	}
+
+	_TilesX = tilesX;
+	_TilesY = tilesY;
+	_Slices = slices;
+	_RowStride = (tilesX + 3) & ~3;
+	_IndexCapacity = indexCapacity;
+	_Program = program;
+	_Mode = program ? MODE_GPU : MODE_CPU;
+	_Projection = glm::mat4(0.0f);   // bounds are built by the first update()
+
+	int clusters = getClusterCount();
+	size_t boxes = size_t(slices) * tilesY * _RowStride;
+	_MinX.assign(boxes, FLT_MAX); _MinY.assign(boxes, FLT_MAX); _MinZ.assign(boxes, FLT_MAX);
+	_MaxX.assign(boxes, -FLT_MAX); _MaxY.assign(boxes, -FLT_MAX); _MaxZ.assign(boxes, -FLT_MAX);
+	_ColumnMin.resize(size_t(slices) * tilesX); _ColumnMax.resize(size_t(slices) * tilesX);
+	_RowMin.resize(size_t(slices) * tilesY); _RowMax.resize(size_t(slices) * tilesY);
+	_SliceDepths.resize(slices + 1);
+	_Counts.resize(clusters);
+	_Slots.resize(size_t(clusters) * MAX_CLUSTER_LIGHTS);
+	_Grid.resize(2 * size_t(clusters));
+	_Indices.resize(2 + indexCapacity);
+
+	_Parameters = ParametersT();
+	_Parameters.grid[0] = tilesX;
+	_Parameters.grid[1] = tilesY;
+	_Parameters.grid[2] = slices;
+	_Parameters.limits[0] = GLuint(indexCapacity);
+	_Parameters.limits[1] = MAX_CLUSTER_LIGHTS;
+
+	glGenBuffers(BUFFER_COUNT, _Buffers);
+	StateTracker::bindBuffer(GL_UNIFORM_BUFFER, _Buffers[BUFFER_PARAMETERS]);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(ParametersT), &_Parameters, GL_DYNAMIC_DRAW);
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_LIGHTS]);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(ShaderLightT), NULL, GL_STREAM_DRAW);
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_BOUNDS]);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, 2 * clusters * sizeof(glm::vec4), NULL, GL_STATIC_DRAW);
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_GRID]);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, _Grid.size() * sizeof(GLuint), &_Grid[0],
+		GL_DYNAMIC_DRAW);
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_INDICES]);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, _Indices.size() * sizeof(GLuint), &_Indices[0],
+		GL_DYNAMIC_DRAW);
+	if (program) glGenQueries(2, _Queries);
+
+	CG_GL_CHECK("ClusteredLighting::init");
+	return true;
+}
+// ClusteredLighting::init() //////////////////////////////////////////////////////////////////////
+
+
+
+void ClusteredLighting::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Buffers[0]) StateTracker::deleteBuffers(BUFFER_COUNT, _Buffers);
+	if (_Queries[0]) glDeleteQueries(2, _Queries);
+	for (int i = 0; i < BUFFER_COUNT; ++i) _Buffers[i] = 0;
+	_Queries[0] = _Queries[1] = 0;
+	_QueryPending = false;
+	_Program = 0;
+	_Lights.clear();
+	_Slots.clear();
+}
+// ClusteredLighting::release() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: update()
+// purpose:  Assigns the lights (model coordinates) to the clusters of the view given by the
+//           projection, the model view matrix and the viewport size. MODE_GPU leaves the
+//           assignment program current.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ClusteredLighting::update(const glm::mat4& projection, const glm::mat4& modelView,
+	GLsizei width, GLsizei height, const vector<LightT>& lights)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Buffers[0]) return false;
+	if ((projection != _Projection) && !buildClusters(projection)) return false;
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	transformLights(modelView, lights);
+
+	_Parameters.grid[3] = GLuint(lights.size());
+	_Parameters.slicing[2] = GLfloat(max(1, width));
+	_Parameters.slicing[3] = GLfloat(max(1, height));
+	StateTracker::bindBuffer(GL_UNIFORM_BUFFER, _Buffers[BUFFER_PARAMETERS]);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(ParametersT), &_Parameters);
+
+	// new storage every frame, the previous frame may still read the old lights
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_LIGHTS]);
+	glBufferData(GL_SHADER_STORAGE_BUFFER, max(size_t(1), _Lights.size()) * sizeof(ShaderLightT),
+		_Lights.empty() ? NULL : &_Lights[0], GL_STREAM_DRAW);
+
+	if (_Mode == MODE_GPU) assignGPU();
+	else
+	{
+		assignCPU();
+		chrono::steady_clock::duration elapsed = chrono::steady_clock::now() - start;
+		_Milliseconds = chrono::duration<double, milli>(elapsed).count();
+	}
+
+	CG_GL_CHECK("ClusteredLighting::update");
+	return true;
+}
+// ClusteredLighting::update() ////////////////////////////////////////////////////////////////////
+
+
+
+void ClusteredLighting::bind(void) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const GLenum uniform = GL_UNIFORM_BUFFER, storage = GL_SHADER_STORAGE_BUFFER;
+	StateTracker::bindBufferBase(uniform, PARAMETER_BINDING, _Buffers[BUFFER_PARAMETERS]);
+	StateTracker::bindBufferBase(storage, LIGHT_BINDING, _Buffers[BUFFER_LIGHTS]);
+	StateTracker::bindBufferBase(storage, BOUNDS_BINDING, _Buffers[BUFFER_BOUNDS]);
+	StateTracker::bindBufferBase(storage, GRID_BINDING, _Buffers[BUFFER_GRID]);
+	StateTracker::bindBufferBase(storage, INDEX_BINDING, _Buffers[BUFFER_INDICES]);
+}
+// ClusteredLighting::bind() //////////////////////////////////////////////////////////////////////
+
+
+
+int ClusteredLighting::getClusterIndex(int tileX, int tileY, int slice) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return (slice * _TilesY + tileY) * _TilesX + tileX;
+}
+// ClusteredLighting::getClusterIndex() ///////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: readClusters()
+// purpose:  Reads the lists back from the buffers (waits for the GPU), one list of light
+//           indices per cluster.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ClusteredLighting::readClusters(vector<vector<GLuint> >& clusters) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<GLuint> grid(_Grid.size()), indices(_Indices.size());
+	clusters.assign(getClusterCount(), vector<GLuint>());
+	if (!_Buffers[0]) return;
+
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_GRID]);
+	glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, grid.size() * sizeof(GLuint), &grid[0]);
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_INDICES]);
+	glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, indices.size() * sizeof(GLuint), &indices[0]);
+
+	for (size_t c = 0; c < clusters.size(); ++c)
+	{
+		const GLuint* first = &indices[2] + grid[2 * c];
+		clusters[c].assign(first, first + grid[2 * c + 1]);
+	}
+}
+// ClusteredLighting::readClusters() //////////////////////////////////////////////////////////////
+
+
+
+ClusteredLighting::StatisticsT ClusteredLighting::getStatistics(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT statistics = StatisticsT();
+	statistics.lights = _Parameters.grid[3];
+	statistics.clusters = getClusterCount();
+	if (!_Buffers[0]) return statistics;
+
+	// the CPU assignment keeps its results, the GPU lists are read back
+	if (_Mode == MODE_GPU)
+	{
+		readTimer(true);
+		StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_GRID]);
+		glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, _Grid.size() * sizeof(GLuint), &_Grid[0]);
+		StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_INDICES]);
+		glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, 2 * sizeof(GLuint), &_Indices[0]);
+	}
+
+	for (int c = 0; c < statistics.clusters; ++c)
+	{
+		int count = int(_Grid[2 * c + 1]);
+		if (count) ++statistics.activeClusters;
+		statistics.maxClusterLights = max(statistics.maxClusterLights, count);
+	}
+	statistics.indices = _Indices[0];
+	statistics.overflow = _Indices[1] || (_Indices[0] > _IndexCapacity);
+	statistics.milliseconds = _Milliseconds;
+	return statistics;
+}
+// ClusteredLighting::getStatistics() /////////////////////////////////////////////////////////////
+
+
+
+void ClusteredLighting::report(ostream& out)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT s = getStatistics();
+	out << "Clustered lighting (" << ((_Mode == MODE_GPU) ? "GPU" :
+		((CpuInfo::getLevel() >= CpuInfo::SL_SSE2) ? "CPU SSE2" : "CPU scalar")) << "): "
+		<< s.lights << " lights, " << _TilesX << "x" << _TilesY << "x" << _Slices << " clusters ("
+		<< s.activeClusters << " lit), " << s.indices << " indices, "
+		<< fixed << setprecision(1)
+		<< (s.activeClusters ? double(s.indices) / s.activeClusters : 0.0)
+		<< " lights per lit cluster (max " << s.maxClusterLights << "), "
+		<< setprecision(3) << s.milliseconds << " ms" << endl;
+	if (s.overflow)
+	{
+		out << "   overflow: lists are limited to " << MAX_CLUSTER_LIGHTS << " lights and "
+			<< _IndexCapacity << " indices in total, some lights are missing" << endl;
+	}
+}
+// ClusteredLighting::report() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: buildClusters()
+// purpose:  Cluster bounds in view coordinates: the tile corners are unprojected to view rays
+//           and cut at the depths of the exponential slices, every cluster gets the box of
+//           its 8 corner points. Near and far plane come from the projection matrix.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ClusteredLighting::buildClusters(const glm::mat4& projection)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	float zNear = projection[3][2] / (projection[2][2] - 1.0f);
+	float zFar = projection[3][2] / (projection[2][2] + 1.0f);
+	if ((projection[2][3] != -1.0f) || (projection[3][3] != 0.0f) || !(zNear > 0.0f)
+		|| !(zFar > zNear) || (zFar > FLT_MAX))
+	{
+		cout << "Error: clustered lighting requires a perspective projection with a finite far "
+			<< "plane" << endl;
+		return false;
+	}
+
+	// slice = log(depth) * scale + bias maps the near plane to 0 and the far plane to slices
+	float logRatio = log(zFar / zNear);
+	_Parameters.slicing[0] = _Slices / logRatio;
+	_Parameters.slicing[1] = -_Slices * log(zNear) / logRatio;
+	for (int k = 0; k <= _Slices; ++k)
+	{
+		_SliceDepths[k] = zNear * pow(zFar / zNear, float(k) / _Slices);
+	}
+
+	// view rays through the tile corners, scaled to depth 1
+	glm::mat4 inverse = glm::inverse(projection);
+	vector<glm::vec3> rays((_TilesX + 1) * (_TilesY + 1));
+	for (int y = 0; y <= _TilesY; ++y)
+	{
+		for (int x = 0; x <= _TilesX; ++x)
+		{
+			glm::vec4 p = inverse * glm::vec4(-1.0f + 2.0f * x / _TilesX,
+				-1.0f + 2.0f * y / _TilesY, -1.0f, 1.0f);
+			rays[y * (_TilesX + 1) + x] = glm::vec3(p) / -p.z;
+		}
+	}
+
+	vector<glm::vec4> bounds(2 * size_t(getClusterCount()));
+	fill(_ColumnMin.begin(), _ColumnMin.end(), FLT_MAX);
+	fill(_ColumnMax.begin(), _ColumnMax.end(), -FLT_MAX);
+	fill(_RowMin.begin(), _RowMin.end(), FLT_MAX);
+	fill(_RowMax.begin(), _RowMax.end(), -FLT_MAX);
+	for (int k = 0; k < _Slices; ++k)
+	{
+		for (int y = 0; y < _TilesY; ++y)
+		{
+			for (int x = 0; x < _TilesX; ++x)
+			{
+				glm::vec3 minimum(FLT_MAX), maximum(-FLT_MAX);
+				for (int corner = 0; corner < 8; ++corner)
+				{
+					int cornerX = x + (corner & 1), cornerY = y + ((corner >> 1) & 1);
+					const glm::vec3& ray = rays[cornerY * (_TilesX + 1) + cornerX];
+					glm::vec3 p = ray * _SliceDepths[k + (corner >> 2)];
+					minimum = glm::min(minimum, p);
+					maximum = glm::max(maximum, p);
+				}
+
+				int cluster = getClusterIndex(x, y, k);
+				bounds[2 * cluster] = glm::vec4(minimum, 0.0f);
+				bounds[2 * cluster + 1] = glm::vec4(maximum, 0.0f);
+
+				size_t box = (size_t(k) * _TilesY + y) * _RowStride + x;
+				_MinX[box] = minimum.x; _MinY[box] = minimum.y; _MinZ[box] = minimum.z;
+				_MaxX[box] = maximum.x; _MaxY[box] = maximum.y; _MaxZ[box] = maximum.z;
+
+				int column = k * _TilesX + x, row = k * _TilesY + y;
+				_ColumnMin[column] = min(_ColumnMin[column], minimum.x);
+				_ColumnMax[column] = max(_ColumnMax[column], maximum.x);
+				_RowMin[row] = min(_RowMin[row], minimum.y);
+				_RowMax[row] = max(_RowMax[row], maximum.y);
+			}
+		}
+	}
+
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_BOUNDS]);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, bounds.size() * sizeof(glm::vec4), &bounds[0]);
+	_Projection = projection;
+	return true;
+}
+// ClusteredLighting::buildClusters() /////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: transformLights()
+// purpose:  Transforms positions and spot directions to view coordinates (batched SIMD
+//           transform) and computes the bounding spheres. A spot cone of angle a and range r
+//           fits into the sphere through its apex and rim (radius r / (2 cos a)) for a < 45
+//           degrees and into the sphere around its rim circle (radius r sin a) otherwise.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ClusteredLighting::transformLights(const glm::mat4& modelView, const vector<LightT>& lights)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t count = lights.size();
+	_Lights.resize(count);
+	_Positions.resize(count);
+	_Directions.resize(count);
+	if (!count) return;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		_Positions[i] = glm::vec4(glm::vec3(lights[i].position), 1.0f);
+		_Directions[i] = glm::vec4(glm::vec3(lights[i].direction), 0.0f);
+	}
+	BatchTransform::transform(modelView, &_Positions[0], &_Positions[0], count);
+	BatchTransform::transform(modelView, &_Directions[0], &_Directions[0], count);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		ShaderLightT& light = _Lights[i];
+		glm::vec3 position(_Positions[i]), axis(_Directions[i]);
+		float range = lights[i].position.w, cosine = lights[i].color.w;
+		float length = glm::length(axis);
+		axis = (length > 0.0f) ? axis / length : glm::vec3(0.0f, 0.0f, -1.0f);
+
+		light.position = glm::vec4(position, range);
+		light.color = lights[i].color;
+		light.direction = glm::vec4(axis, 0.0f);
+		if (cosine <= 0.0f)
+		{
+			light.bounds = glm::vec4(position, range);
+		}
+		else if (cosine > 0.70710678f)
+		{
+			float radius = 0.5f * range / cosine;
+			light.bounds = glm::vec4(position + axis * radius, radius);
+		}
+		else
+		{
+			light.bounds = glm::vec4(position + axis * (range * cosine),
+				range * sqrt(1.0f - cosine * cosine));
+		}
+	}
+}
+// ClusteredLighting::transformLights() ///////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: assignCPU()
+// purpose:  Every light tests the clusters of the slices its depth range touches, restricted
+//           to the tile columns and rows whose bounds overlap its box, 4 clusters at a time.
+//           The lights are visited in ascending order, so the lists are sorted like the ones
+//           of the compute shader. The fixed size lists are then compacted in cluster order.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ClusteredLighting::assignCPU(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	OverlapT overlap = overlapScalar;
+#if CG_SIMD_X86
+	if (CpuInfo::getLevel() >= CpuInfo::SL_SSE2) overlap = overlapSSE2;
+#endif
+
+	BoxArrayT boxes = { &_MinX[0], &_MinY[0], &_MinZ[0], &_MaxX[0], &_MaxY[0], &_MaxZ[0] };
+	vector<int> hits(_RowStride);
+	fill(_Counts.begin(), _Counts.end(), 0u);
+	bool overflow = false;
+
+	for (size_t l = 0; l < _Lights.size(); ++l)
+	{
+		const glm::vec4& sphere = _Lights[l].bounds;
+		float zMin = -sphere.z - sphere.w, zMax = -sphere.z + sphere.w;
+		if ((zMax < _SliceDepths[0]) || (zMin > _SliceDepths[_Slices])) continue;
+
+		// one slice more on both sides, the box test decides
+		int firstSlice = max(0, getSlice(zMin) - 1);
+		int lastSlice = min(_Slices - 1, getSlice(zMax) + 1);
+		for (int k = firstSlice; k <= lastSlice; ++k)
+		{
+			int x0 = 0, x1 = _TilesX - 1, y0 = 0, y1 = _TilesY - 1;
+			const float* columnMin = &_ColumnMin[k * _TilesX];
+			const float* columnMax = &_ColumnMax[k * _TilesX];
+			const float* rowMin = &_RowMin[k * _TilesY];
+			const float* rowMax = &_RowMax[k * _TilesY];
+			while ((x0 <= x1) && (columnMax[x0] < sphere.x - sphere.w)) ++x0;
+			while ((x1 >= x0) && (columnMin[x1] > sphere.x + sphere.w)) --x1;
+			while ((y0 <= y1) && (rowMax[y0] < sphere.y - sphere.w)) ++y0;
+			while ((y1 >= y0) && (rowMin[y1] > sphere.y + sphere.w)) --y1;
+			if ((x0 > x1) || (y0 > y1)) continue;
+
+			int begin = x0 & ~3, end = (x1 + 4) & ~3;
+			for (int y = y0; y <= y1; ++y)
+			{
+				int row = k * _TilesY + y, base = row * _RowStride;
+				int count = overlap(boxes, base + begin, base + end, sphere, &hits[0]);
+				for (int h = 0; h < count; ++h)
+				{
+					GLuint cluster = GLuint(row * _TilesX + hits[h] - base);
+					GLuint& n = _Counts[cluster];
+					if (n < GLuint(MAX_CLUSTER_LIGHTS))
+					{
+						_Slots[cluster * MAX_CLUSTER_LIGHTS + n++] = GLuint(l);
+					}
+					else overflow = true;
+				}
+			}
+		}
+	}
+
+	// compact like the compute shader: a list gets what is left of the index capacity
+	size_t offset = 0;
+	for (size_t c = 0; c < _Counts.size(); ++c)
+	{
+		size_t count = _Counts[c];
+		size_t stored = min(count, _IndexCapacity - min(offset, _IndexCapacity));
+		copy(&_Slots[c * MAX_CLUSTER_LIGHTS], &_Slots[c * MAX_CLUSTER_LIGHTS] + stored,
+			&_Indices[2 + offset]);
+		_Grid[2 * c] = count ? GLuint(offset) : 0;
+		_Grid[2 * c + 1] = GLuint(stored);
+		overflow = overflow || (stored < count);
+		offset += count;
+	}
+	_Indices[0] = GLuint(offset);
+	_Indices[1] = overflow;
+
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_GRID]);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, _Grid.size() * sizeof(GLuint), &_Grid[0]);
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_INDICES]);
+	size_t used = 2 + min(offset, _IndexCapacity);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, used * sizeof(GLuint), &_Indices[0]);
+}
+// ClusteredLighting::assignCPU() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: assignGPU()
+// purpose:  One compute shader invocation per cluster, the lists are appended to the index
+//           buffer with an atomic counter. GPU time is measured with timestamp queries whose
+//           results are collected without waiting in later frames.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ClusteredLighting::assignGPU(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	readTimer(false);
+	bool timing = !_QueryPending;
+
+	GLuint header[2] = { 0, 0 };
+	StateTracker::bindBuffer(GL_SHADER_STORAGE_BUFFER, _Buffers[BUFFER_INDICES]);
+	glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(header), header);
+
+	StateTracker::useProgram(_Program);
+	bind();
+	if (timing) glQueryCounter(_Queries[0], GL_TIMESTAMP);
+	glDispatchCompute((getClusterCount() + GROUP_SIZE - 1) / GROUP_SIZE, 1, 1);
+	if (timing) glQueryCounter(_Queries[1], GL_TIMESTAMP);
+	_QueryPending = _QueryPending || timing;
+
+	// the shading pass reads the lists from its fragment shader
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+}
+// ClusteredLighting::assignGPU() /////////////////////////////////////////////////////////////////
+
+
+
+void ClusteredLighting::readTimer(bool wait)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_QueryPending) return;
+
+	GLint available = 1;
+	if (!wait) glGetQueryObjectiv(_Queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+	if (!available) return;
+
+	GLuint64 start = 0, end = 0;
+	glGetQueryObjectui64v(_Queries[0], GL_QUERY_RESULT, &start);
+	glGetQueryObjectui64v(_Queries[1], GL_QUERY_RESULT, &end);
+	_Milliseconds = (end - start) * 1.0e-6;
+	_QueryPending = false;
+}
+// ClusteredLighting::readTimer() /////////////////////////////////////////////////////////////////
+
+
+
+int ClusteredLighting::getSlice(float depth) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	float slice = log(max(depth, _SliceDepths[0])) * _Parameters.slicing[0]
+		+ _Parameters.slicing[1];
+	return int(min(float(_Slices - 1), max(0.0f, slice)));
+}
+// ClusteredLighting::getSlice() //////////////////////////////////////////////////////////////////
@@ -0,0 +1,149 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   CompressedTexture.cpp
+//
+//  \brief      Loads block compressed textures (BC1/BC3/BC5/BC7 containers of the CG-BCN tool)
+//              straight from a memory mapping.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Bindings through the StateTracker
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <algorithm>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/CompressedTexture.h"
+#include "../inc/TextureCompressor.h"
+#include "../inc/ResourceBundle.h"
+#include "../inc/MappedFile.h"
+#include "../inc/StateTracker.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+CompressedTexture::StatisticsT CompressedTexture::_Statistics = { 0, 0, 0 };
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: load()
+// purpose:  Creates a texture with all mipmap levels of the container. Returns 0 if the file
+//           is missing or invalid or the driver does not support its format.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint CompressedTexture::load(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// the mounted bundle is mapped already, otherwise map the single file
+	MappedFile file;
+	ResourceBundle::ViewT view;
+	if (!ResourceBundle::findMounted(filename, view))
+	{
+		if (!file.open(filename))
+		{
+			cout << "Error: unable to open compressed texture " << filename << endl;
+			return 0;
+		}
+		view.data = file.getData();
+		view.size = file.getSize();
+	}
+
+	TextureCompressor::ContainerT container;
+	if (!TextureCompressor::parse(view.data, view.size, container))
+	{
+		cout << "Error: invalid compressed texture " << filename << endl;
+		return 0;
+	}
+	if (!isSupported(container.format))
+	{
+		cout << "Error: " << TextureCompressor::getFormatName(container.format)
+			<< " textures are not supported (" << filename << ")" << endl;
+		return 0;
+	}
+
+	GLenum format = getInternalFormat(container.format);
+	GLuint texture = 0;
+	glGenTextures(1, &texture);
+	StateTracker::bindTexture(GL_TEXTURE_2D, texture);
+	glTexStorage2D(GL_TEXTURE_2D, container.levels, format, container.width, container.height);
+
+	size_t rgbaBytes = 0, compressedBytes = 0;
+	for (int level = 0; level < container.levels; ++level)
+	{
+		GLsizei width = max(1, container.width >> level);
+		GLsizei height = max(1, container.height >> level);
+		glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format,
+			GLsizei(container.size[level]), container.data[level]);
+		compressedBytes += container.size[level];
+		rgbaBytes += size_t(width) * height * 4;
+	}
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+		(container.levels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	_Statistics.textures++;
+	_Statistics.compressedBytes += compressedBytes;
+	_Statistics.rgbaBytes += rgbaBytes;
+
+	cout << "Compressed texture: " << filename << " ("
+		<< TextureCompressor::getFormatName(container.format) << ", " << container.width << "x"
+		<< container.height << ", " << container.levels << " levels): " << (compressedBytes >> 10)
+		<< " KB VRAM, " << ((rgbaBytes - compressedBytes) >> 10) << " KB less than RGBA8" << endl;
+	return texture;
+}
+// CompressedTexture::load() //////////////////////////////////////////////////////////////////////
+
+
+
+GLenum CompressedTexture::getInternalFormat(TextureCompressor::FormatT format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (format)
+	{
+		case TextureCompressor::FORMAT_BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+		case TextureCompressor::FORMAT_BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		case TextureCompressor::FORMAT_BC5: return GL_COMPRESSED_RG_RGTC2;
+		case TextureCompressor::FORMAT_BC7: return GL_COMPRESSED_RGBA_BPTC_UNORM;
+	}
+	return GL_NONE;
+}
+// CompressedTexture::getInternalFormat() /////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: isSupported()
+// purpose:  BC1 and BC3 need EXT_texture_compression_s3tc, BC5 (RGTC) is core since GL 3.0
+//           and BC7 (BPTC) since GL 4.2.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool CompressedTexture::isSupported(TextureCompressor::FormatT format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (format)
+	{
+		case TextureCompressor::FORMAT_BC1:
+		case TextureCompressor::FORMAT_BC3:
+			return GLEW_EXT_texture_compression_s3tc != GL_FALSE;
+		case TextureCompressor::FORMAT_BC5:
+			return GLEW_VERSION_3_0 || GLEW_ARB_texture_compression_rgtc;
+		case TextureCompressor::FORMAT_BC7:
+			return GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc;
+	}
+	return false;
+}
+// CompressedTexture::isSupported() ///////////////////////////////////////////////////////////////
@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   CpuInfo.cpp
+//
+//  \brief      Runtime detection of the SIMD instruction sets supported by CPU and OS.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/CpuInfo.h"
+
+
+
+// static member variables ////////////////////////////////////////////////////////////////////////
+CpuInfo::SimdLevelT CpuInfo::_MaxLevel = CpuInfo::SL_AVX512;
+
+
+
+namespace
+{
+	void cpuid(int leaf, int subleaf, unsigned int regs[4])
+	{
+		regs[0] = regs[1] = regs[2] = regs[3] = 0;
+#if defined(_MSC_VER) && CG_SIMD_X86
+		__cpuidex((int*) regs, leaf, subleaf);
+#elif defined(__GNUC__) && CG_SIMD_X86
+		__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#else
+		(void) leaf; (void) subleaf;
+#endif
+	}
+
+	unsigned long long xgetbv(void)
+	{
+#if defined(_MSC_VER) && CG_SIMD_X86
+		return _xgetbv(0);
+#elif defined(__GNUC__) && CG_SIMD_X86
+		unsigned int eax, edx;
+		__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return ((unsigned long long) edx << 32) | eax;
+#else
+		return 0;
+#endif
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getLevel()
+// purpose:  Returns the detected level limited by setMaxLevel(). The detection runs once.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+CpuInfo::SimdLevelT CpuInfo::getLevel(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	SimdLevelT level = getDetectedLevel();
+	return (level < _MaxLevel) ? level : _MaxLevel;
+}
+// CpuInfo::getLevel() ////////////////////////////////////////////////////////////////////////////
+
+
+
+CpuInfo::SimdLevelT CpuInfo::getDetectedLevel(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const SimdLevelT level = detect();
+	return level;
+}
+// CpuInfo::getDetectedLevel() ////////////////////////////////////////////////////////////////////
+
+
+
+void CpuInfo::setMaxLevel(SimdLevelT level)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_MaxLevel = level;
+}
+// CpuInfo::setMaxLevel() /////////////////////////////////////////////////////////////////////////
+
+
+
+const char* CpuInfo::getLevelName(SimdLevelT level)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const char* names[] = { "scalar", "sse2", "avx2", "avx512" };
+	return names[level];
+}
+// CpuInfo::getLevelName() ////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: detect()
+// purpose:  Checks the cpuid feature flags and whether the OS saves the wider registers on
+//           context switches (XCR0 bits for SSE/AVX state and the AVX-512 opmask/ZMM state).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+CpuInfo::SimdLevelT CpuInfo::detect(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	SimdLevelT level = SL_SCALAR;
+
+	unsigned int regs[4];
+	cpuid(0, 0, regs);
+	unsigned int maxLeaf = regs[0];
+
+	if (maxLeaf >= 1)
+	{
+		cpuid(1, 0, regs);
+		bool sse2 = (regs[3] & (1u << 26)) != 0;
+		bool fma = (regs[2] & (1u << 12)) != 0;
+		bool osxsave = (regs[2] & (1u << 27)) != 0;
+		bool avx = (regs[2] & (1u << 28)) != 0;
+
+		if (sse2) level = SL_SSE2;
+
+		unsigned long long xcr0 = osxsave ? xgetbv() : 0;
+		if (maxLeaf >= 7 && avx && fma && (xcr0 & 0x6) == 0x6)
+		{
+			cpuid(7, 0, regs);
+			if (regs[1] & (1u << 5)) level = SL_AVX2;
+			if ((regs[1] & (1u << 16)) && (level == SL_AVX2) && (xcr0 & 0xe6) == 0xe6) level = SL_AVX512;
+		}
+	}
+
+	// optional limit from the environment
+	const char* limit = getenv("CG_SIMD_LEVEL");
+	if (limit != NULL)
+	{
+		for (int l = SL_SCALAR; l < level; ++l)
+		{
+			if (strcmp(limit, getLevelName(SimdLevelT(l))) == 0) level = SimdLevelT(l);
+		}
+	}
+	return level;
+}
+// CpuInfo::detect() //////////////////////////////////////////////////////////////////////////////
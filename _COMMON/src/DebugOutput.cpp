@@ -0,0 +1,456 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   DebugOutput.cpp
+//
+//  \brief      OpenGL debug output (KHR_debug) with filters, rate limiting of repeated
+//              messages and an asynchronous background logger.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#include <cstdlib>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/DebugOutput.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const DebugOutput::ModeT DebugOutput::DEFAULT_MODE;
+const size_t DebugOutput::QUEUE_SIZE;
+const size_t DebugOutput::MESSAGE_LENGTH;
+const size_t DebugOutput::RATE_SLOTS;
+
+DebugOutput::ModeT DebugOutput::_Mode = DebugOutput::MODE_SYNCHRONOUS;
+bool DebugOutput::_Initialized = false;
+thread* DebugOutput::_Logger = NULL;
+atomic<bool> DebugOutput::_Running(false);
+
+DebugOutput::QueueSlotT DebugOutput::_Queue[DebugOutput::QUEUE_SIZE];
+atomic<size_t> DebugOutput::_QueueTail(0);
+size_t DebugOutput::_QueueHead = 0;
+
+DebugOutput::RateSlotT DebugOutput::_Rates[DebugOutput::RATE_SLOTS];
+atomic<GLint64> DebugOutput::_IntervalStart(0);
+unsigned DebugOutput::_MaxMessages = 10;
+unsigned DebugOutput::_Interval = 1000;
+
+atomic<size_t> DebugOutput::_Received(0);
+atomic<size_t> DebugOutput::_Logged(0);
+atomic<size_t> DebugOutput::_Repeated(0);
+atomic<size_t> DebugOutput::_Dropped(0);
+
+
+
+namespace
+{
+	GLint64 getMilliseconds(void)
+	{
+		return chrono::duration_cast<chrono::milliseconds>(
+			chrono::steady_clock::now().time_since_epoch()).count();
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  Registers the debug message callback with all messages except notifications
+//           enabled and, in asynchronous mode, starts the logger thread. Returns false if
+//           the context does not support debug output.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool DebugOutput::init(ModeT mode)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!glDebugMessageCallback)
+	{
+		cout << "OpenGL glDebugMessageCallback function not available" << endl << endl;
+		return false;
+	}
+
+	if (!_Initialized)
+	{
+		for (size_t i = 0; i < QUEUE_SIZE; ++i) _Queue[i].sequence.store(i);
+		_IntervalStart.store(getMilliseconds());
+		atexit(shutdown);
+		_Initialized = true;
+	}
+
+	_Mode = mode;
+	if (_Mode == MODE_ASYNCHRONOUS && _Logger == NULL)
+	{
+		_Running.store(true);
+		_Logger = new thread(runLogger);
+	}
+
+	glEnable(GL_DEBUG_OUTPUT);
+	if (_Mode == MODE_SYNCHRONOUS) glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	else glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	glDebugMessageCallback(callback, NULL);
+	glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);
+	setMinSeverity(GL_DEBUG_SEVERITY_LOW);
+
+	cout << "OpenGL debug message callback successfully registerd ("
+		<< (_Mode == MODE_SYNCHRONOUS ? "synchronous" : "asynchronous") << ")." << endl << endl;
+	return true;
+}
+// DebugOutput::init() ////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: shutdown()
+// purpose:  Reports pending repetitions, drains the queue and stops the logger thread. Makes
+//           no GL calls, so it is safe after the context is gone (e.g. in atexit()).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DebugOutput::shutdown(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Initialized) return;
+
+	_IntervalStart.store(getMilliseconds() - _Interval);
+	endInterval(getMilliseconds());
+
+	if (_Logger != NULL)
+	{
+		_Running.store(false);
+		_Logger->join();
+		delete _Logger;
+		_Logger = NULL;
+	}
+	_Mode = MODE_SYNCHRONOUS;   // late callbacks are printed directly
+
+	StatisticsT statistics = getStatistics();
+	cout << "OpenGL debug output: " << statistics.received << " messages, " << statistics.logged
+		<< " logged, " << statistics.repeated << " repetitions suppressed, " << statistics.dropped
+		<< " dropped" << endl;
+}
+// DebugOutput::shutdown() ////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: setMinSeverity()
+// purpose:  Enables the messages of the given and all higher severities, disables the others.
+//           (Like all filters it is applied by the driver and overrides earlier filters for
+//           the messages it matches.)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DebugOutput::setMinSeverity(GLenum severity)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const GLenum severities[] = { GL_DEBUG_SEVERITY_NOTIFICATION, GL_DEBUG_SEVERITY_LOW,
+		GL_DEBUG_SEVERITY_MEDIUM, GL_DEBUG_SEVERITY_HIGH };
+
+	GLboolean enabled = GL_FALSE;
+	for (int i = 0; i < 4; ++i)
+	{
+		if (severities[i] == severity) enabled = GL_TRUE;
+		glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, severities[i], 0, NULL, enabled);
+	}
+}
+// DebugOutput::setMinSeverity() //////////////////////////////////////////////////////////////////
+
+
+
+void DebugOutput::setSourceEnabled(GLenum source, bool enabled)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glDebugMessageControl(source, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, enabled);
+}
+// DebugOutput::setSourceEnabled() ////////////////////////////////////////////////////////////////
+
+
+
+void DebugOutput::setTypeEnabled(GLenum type, bool enabled)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glDebugMessageControl(GL_DONT_CARE, type, GL_DONT_CARE, 0, NULL, enabled);
+}
+// DebugOutput::setTypeEnabled() //////////////////////////////////////////////////////////////////
+
+
+
+void DebugOutput::setIdEnabled(GLenum source, GLenum type, GLuint id, bool enabled)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glDebugMessageControl(source, type, GL_DONT_CARE, 1, &id, enabled);
+}
+// DebugOutput::setIdEnabled() ////////////////////////////////////////////////////////////////////
+
+
+
+void DebugOutput::setRateLimit(unsigned maxMessages, unsigned intervalMilliseconds)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_MaxMessages = maxMessages;
+	_Interval = intervalMilliseconds;
+}
+// DebugOutput::setRateLimit() ////////////////////////////////////////////////////////////////////
+
+
+
+DebugOutput::StatisticsT DebugOutput::getStatistics(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT statistics = { _Received.load(), _Logged.load(), _Repeated.load(), _Dropped.load() };
+	return statistics;
+}
+// DebugOutput::getStatistics() ///////////////////////////////////////////////////////////////////
+
+
+
+const char* DebugOutput::getSourceName(GLenum source)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (source)
+	{
+		case GL_DEBUG_SOURCE_API: return "API";
+		case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "WINDOW_SYSTEM";
+		case GL_DEBUG_SOURCE_SHADER_COMPILER: return "SHADER_COMPILER";
+		case GL_DEBUG_SOURCE_THIRD_PARTY: return "THIRD_PARTY";
+		case GL_DEBUG_SOURCE_APPLICATION: return "APPLICATION";
+		case GL_DEBUG_SOURCE_OTHER: return "OTHER";
+	}
+	return "UNKNOWN";
+}
+// DebugOutput::getSourceName() ///////////////////////////////////////////////////////////////////
+
+
+
+const char* DebugOutput::getTypeName(GLenum type)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (type)
+	{
+		case GL_DEBUG_TYPE_ERROR: return "ERROR";
+		case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "DEPRECATED_BEHAVIOR";
+		case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "UNDEFINED_BEHAVIOR";
+		case GL_DEBUG_TYPE_PORTABILITY: return "PORTABILITY";
+		case GL_DEBUG_TYPE_PERFORMANCE: return "PERFORMANCE";
+		case GL_DEBUG_TYPE_MARKER: return "MARKER";
+		case GL_DEBUG_TYPE_PUSH_GROUP: return "PUSH_GROUP";
+		case GL_DEBUG_TYPE_POP_GROUP: return "POP_GROUP";
+		case GL_DEBUG_TYPE_OTHER: return "OTHER";
+	}
+	return "UNKNOWN";
+}
+// DebugOutput::getTypeName() /////////////////////////////////////////////////////////////////////
+
+
+
+const char* DebugOutput::getSeverityName(GLenum severity)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (severity)
+	{
+		case GL_DEBUG_SEVERITY_NOTIFICATION: return "NOTIFICATION";
+		case GL_DEBUG_SEVERITY_LOW: return "LOW";
+		case GL_DEBUG_SEVERITY_MEDIUM: return "MEDIUM";
+		case GL_DEBUG_SEVERITY_HIGH: return "HIGH";
+	}
+	return "UNKNOWN";
+}
+// DebugOutput::getSeverityName() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: callback()
+// purpose:  The glDebugMessageCallback() function. Counts the message against the rate limit
+//           of its id and passes it on. No locks and no allocations, in asynchronous mode it
+//           may run on several driver threads at once.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void GLAPIENTRY DebugOutput::callback(GLenum source, GLenum type, GLuint id, GLenum severity,
+	GLsizei length, const GLchar* message, const void* /*userParam*/)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Received++;
+
+	GLint64 now = getMilliseconds();
+	if (now - _IntervalStart.load() >= GLint64(_Interval)) endInterval(now);
+
+	GLuint64 key = (GLuint64(source & 0xFFFF) << 48) | (GLuint64(type & 0xFFFF) << 32) | id;
+	RateSlotT& slot = _Rates[(key * 0x9E3779B97F4A7C15ULL) >> 56 & (RATE_SLOTS - 1)];
+	unsigned count = slot.count.fetch_add(1);
+	if (count == 0) slot.key.store(key);
+	if (count >= _MaxMessages)
+	{
+		_Repeated++;
+		return;
+	}
+
+	MessageT entry;
+	entry.source = source;
+	entry.type = type;
+	entry.severity = severity;
+	entry.id = id;
+	entry.repeated = 0;
+	size_t size = (length >= 0) ? size_t(length) : strlen(message);
+	if (size > MESSAGE_LENGTH - 1) size = MESSAGE_LENGTH - 1;
+	memcpy(entry.text, message, size);
+	entry.text[size] = '\0';
+	dispatch(entry);
+}
+// DebugOutput::callback() ////////////////////////////////////////////////////////////////////////
+
+
+
+void DebugOutput::dispatch(const MessageT& message)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Mode == MODE_SYNCHRONOUS) print(message);
+	else if (!enqueue(message)) _Dropped++;
+}
+// DebugOutput::dispatch() ////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: enqueue()
+// purpose:  Bounded multi producer queue (sequence number per slot): a producer claims the
+//           tail position with a compare and swap and publishes the slot by advancing its
+//           sequence. Returns false if the queue is full.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool DebugOutput::enqueue(const MessageT& message)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t position = _QueueTail.load(memory_order_relaxed);
+	for (;;)
+	{
+		QueueSlotT& slot = _Queue[position & (QUEUE_SIZE - 1)];
+		size_t sequence = slot.sequence.load(memory_order_acquire);
+		ptrdiff_t difference = ptrdiff_t(sequence) - ptrdiff_t(position);
+		if (difference == 0)
+		{
+			if (_QueueTail.compare_exchange_weak(position, position + 1, memory_order_relaxed))
+			{
+				slot.message = message;
+				slot.sequence.store(position + 1, memory_order_release);
+				return true;
+			}
+		}
+		else if (difference < 0)
+		{
+			return false;
+		}
+		else
+		{
+			position = _QueueTail.load(memory_order_relaxed);
+		}
+	}
+}
+// DebugOutput::enqueue() /////////////////////////////////////////////////////////////////////////
+
+
+
+bool DebugOutput::dequeue(MessageT& message)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// single consumer (the logger thread)
+	QueueSlotT& slot = _Queue[_QueueHead & (QUEUE_SIZE - 1)];
+	if (slot.sequence.load(memory_order_acquire) != _QueueHead + 1) return false;
+
+	message = slot.message;
+	slot.sequence.store(_QueueHead + QUEUE_SIZE, memory_order_release);
+	_QueueHead++;
+	return true;
+}
+// DebugOutput::dequeue() /////////////////////////////////////////////////////////////////////////
+
+
+
+void DebugOutput::print(const MessageT& message)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// one write per message, so lines of concurrent writers do not interleave
+	ostringstream line;
+	if (message.repeated > 0)
+	{
+		line << "OpenGL Debug Callback: ID " << message.id << " (Source: "
+			<< getSourceName(message.source) << ", Type: " << getTypeName(message.type)
+			<< ") repeated " << message.repeated << " more times" << endl;
+	}
+	else
+	{
+		line << "OpenGL Debug Callback: " << message.text << endl << "(Source: "
+			<< getSourceName(message.source) << ", Type: " << getTypeName(message.type)
+			<< ", Severity: " << getSeverityName(message.severity) << ", ID: " << message.id
+			<< ")" << endl << endl;
+		_Logged++;
+	}
+	cout << line.str() << flush;
+}
+// DebugOutput::print() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: endInterval()
+// purpose:  Starts the next rate limit interval once the current one is over (only one
+//           caller wins the exchange) and reports the ids that exceeded the limit.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DebugOutput::endInterval(GLint64 now)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLint64 start = _IntervalStart.load();
+	if (now - start < GLint64(_Interval)) return;
+	if (!_IntervalStart.compare_exchange_strong(start, now)) return;
+
+	for (size_t i = 0; i < RATE_SLOTS; ++i)
+	{
+		unsigned count = _Rates[i].count.exchange(0);
+		if (count <= _MaxMessages) continue;
+
+		GLuint64 key = _Rates[i].key.load();
+		MessageT summary;
+		summary.source = GLenum((key >> 48) & 0xFFFF);
+		summary.type = GLenum((key >> 32) & 0xFFFF);
+		summary.severity = GL_DONT_CARE;
+		summary.id = GLuint(key);
+		summary.repeated = count - _MaxMessages;
+		summary.text[0] = '\0';
+		dispatch(summary);
+	}
+}
+// DebugOutput::endInterval() /////////////////////////////////////////////////////////////////////
+
+
+
+void DebugOutput::runLogger(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	MessageT message;
+	for (;;)
+	{
+		if (dequeue(message))
+		{
+			print(message);
+			continue;
+		}
+		if (!_Running.load()) break;
+
+		endInterval(getMilliseconds());
+		this_thread::sleep_for(chrono::milliseconds(2));
+	}
+}
+// DebugOutput::runLogger() ///////////////////////////////////////////////////////////////////////
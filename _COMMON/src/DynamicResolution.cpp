@@ -0,0 +1,356 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   DynamicResolution.cpp
+//
+//  \brief      Dynamic resolution scaling: the scene is rendered into an offscreen target
+//              whose resolution follows the measured GPU time of the scene and is upscaled to
+//              the window with a sharpening pass.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/DynamicResolution.h"
+#include "../inc/StateTracker.h"
+#include "../inc/ErrorCheck.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const float DynamicResolution::DEAD_BAND = 0.05f;
+const float DynamicResolution::SCALE_STEP = 0.05f;
+const int   DynamicResolution::QUERY_COUNT;
+
+
+
+// controller gains (per measurement, velocity form) //////////////////////////////////////////////
+namespace
+{
+	const float PROPORTIONAL_GAIN = 0.03f;
+	const float INTEGRAL_GAIN = 0.1f;
+	const float DERIVATIVE_GAIN = 0.01f;
+}
+
+
+
+DynamicResolution::DynamicResolution(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Program(0), _Framebuffer(0), _ColorTexture(0), _DepthBuffer(0), _VertexArray(0),
+  _WindowFramebuffer(0), _TargetWidth(0), _TargetHeight(0), _MinScale(0.5f), _MaxScale(1.0f),
+  _Sharpness(0.5f), _ScaleLocation(-1), _TexelLocation(-1), _SharpnessLocation(-1),
+  _GPUTiming(false), _NextQuery(0), _Timing(false), _FrameStarted(false)
+{
+	_Errors[0] = _Errors[1] = 0.0f;
+	for (int q = 0; q < QUERY_COUNT; ++q)
+	{
+		_Queries[q] = 0;
+		_QueryScales[q] = 0.0f;
+	}
+	_Statistics = StatisticsT();
+	_Statistics.scale = _Statistics.targetScale = 1.0f;
+	_Statistics.budget = 16.0;
+}
+// DynamicResolution::DynamicResolution() /////////////////////////////////////////////////////////
+
+
+
+DynamicResolution::~DynamicResolution(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// DynamicResolution::~DynamicResolution() ////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  program upscales the color target (sampler texScene on unit 0, uniforms texScale
+//           for the rendered part of the target, texelSize and sharpness). The render target
+//           is allocated by the first begin().
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool DynamicResolution::init(GLuint program)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+	if (!program)
+	{
+		cout << "Error: dynamic resolution needs an upscale program" << endl;
+		return false;
+	}
+
+	_Program = program;
+	_ScaleLocation = glGetUniformLocation(program, "texScale");
+	_TexelLocation = glGetUniformLocation(program, "texelSize");
+	_SharpnessLocation = glGetUniformLocation(program, "sharpness");
+	glProgramUniform1i(program, glGetUniformLocation(program, "texScene"), 0);
+
+	glGenFramebuffers(1, &_Framebuffer);
+	glGenVertexArrays(1, &_VertexArray);
+	_GPUTiming = GLEW_ARB_timer_query || GLEW_VERSION_3_3;
+	if (_GPUTiming) glGenQueries(QUERY_COUNT, _Queries);
+
+	_Statistics.scale = _Statistics.targetScale = _MaxScale;
+	_Statistics.gpuTiming = _GPUTiming;
+
+	CG_GL_CHECK("DynamicResolution::init");
+	return true;
+}
+// DynamicResolution::init() //////////////////////////////////////////////////////////////////////
+
+
+
+void DynamicResolution::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Framebuffer) glDeleteFramebuffers(1, &_Framebuffer);
+	if (_ColorTexture) StateTracker::deleteTextures(1, &_ColorTexture);
+	if (_DepthBuffer) glDeleteRenderbuffers(1, &_DepthBuffer);
+	if (_VertexArray) StateTracker::deleteVertexArrays(1, &_VertexArray);
+	if (_Queries[0]) glDeleteQueries(QUERY_COUNT, _Queries);
+
+	for (int q = 0; q < QUERY_COUNT; ++q)
+	{
+		_Queries[q] = 0;
+		_QueryScales[q] = 0.0f;
+	}
+	_Framebuffer = _ColorTexture = _DepthBuffer = _VertexArray = 0;
+	_TargetWidth = _TargetHeight = 0;
+	_Program = 0;
+	_NextQuery = 0;
+	_Timing = _FrameStarted = false;
+	_Errors[0] = _Errors[1] = 0.0f;
+	_Statistics.changes = 0;
+}
+// DynamicResolution::release() ///////////////////////////////////////////////////////////////////
+
+
+
+void DynamicResolution::setScaleRange(float minimum, float maximum)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_MinScale = min(max(minimum, 0.1f), 1.0f);
+	_MaxScale = min(max(maximum, _MinScale), 1.0f);
+	_Statistics.targetScale = min(max(_Statistics.targetScale, _MinScale), _MaxScale);
+	_Statistics.scale = min(max(_Statistics.scale, _MinScale), _MaxScale);
+}
+// DynamicResolution::setScaleRange() /////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: begin()
+// purpose:  Feeds the finished measurements to the controller, binds the target of the
+//           window size width x height and sets the viewport of the scaled size.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DynamicResolution::begin(GLsizei width, GLsizei height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Framebuffer) return;
+
+	if (_GPUTiming)
+	{
+		readQueries();
+	}
+	else
+	{
+		ClockT::time_point now = ClockT::now();
+		if (_FrameStarted)
+		{
+			control(chrono::duration<double, milli>(now - _FrameStart).count());
+		}
+		_FrameStart = now;
+		_FrameStarted = true;
+	}
+
+	GLint framebuffer = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+	_WindowFramebuffer = GLuint(framebuffer);
+
+	if ((width != _TargetWidth || height != _TargetHeight) && !resize(width, height)) return;
+
+	float scale = _Statistics.scale;
+	_Statistics.width = max(GLsizei(1), GLsizei(width * scale + 0.5f));
+	_Statistics.height = max(GLsizei(1), GLsizei(height * scale + 0.5f));
+	glBindFramebuffer(GL_FRAMEBUFFER, _Framebuffer);
+	glViewport(0, 0, _Statistics.width, _Statistics.height);
+
+	_Timing = _GPUTiming && (_QueryScales[_NextQuery] == 0.0f);
+	if (_Timing)
+	{
+		glBeginQuery(GL_TIME_ELAPSED, _Queries[_NextQuery]);
+		_QueryScales[_NextQuery] = scale;
+	}
+}
+// DynamicResolution::begin() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: end()
+// purpose:  Upscales the rendered part of the target to the window with one fullscreen
+//           triangle. Sharpening only applies when the scene was rendered below window size.
+//           Leaves the upscale program bound.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DynamicResolution::end(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_ColorTexture) return;
+	if (_Timing)
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		_NextQuery = (_NextQuery + 1) % QUERY_COUNT;
+		_Timing = false;
+	}
+
+	CG_GL_SCOPE("DynamicResolution::end");
+	glBindFramebuffer(GL_FRAMEBUFFER, _WindowFramebuffer);
+	glViewport(0, 0, _TargetWidth, _TargetHeight);
+	StateTracker::disable(GL_DEPTH_TEST);
+	StateTracker::useProgram(_Program);
+	glUniform2f(_ScaleLocation, float(_Statistics.width) / _TargetWidth,
+		float(_Statistics.height) / _TargetHeight);
+	glUniform2f(_TexelLocation, 1.0f / _TargetWidth, 1.0f / _TargetHeight);
+	glUniform1f(_SharpnessLocation, (_Statistics.width < _TargetWidth) ? _Sharpness : 0.0f);
+	StateTracker::activeTexture(GL_TEXTURE0);
+	StateTracker::bindTexture(GL_TEXTURE_2D, _ColorTexture);
+	StateTracker::bindVertexArray(_VertexArray);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+// DynamicResolution::end() ///////////////////////////////////////////////////////////////////////
+
+
+
+void DynamicResolution::report(ostream& out) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const StatisticsT& s = _Statistics;
+	out << "Dynamic resolution: scale " << fixed << setprecision(2) << s.scale << " (target "
+		<< s.targetScale << "), " << s.width << "x" << s.height << " of " << _TargetWidth << "x"
+		<< _TargetHeight << ", " << (s.gpuTiming ? "GPU scene " : "CPU frame ")
+		<< setprecision(3) << s.milliseconds << " ms of " << s.budget << " ms budget, "
+		<< s.changes << " changes" << endl;
+}
+// DynamicResolution::report() ////////////////////////////////////////////////////////////////////
+
+
+
+bool DynamicResolution::resize(GLsizei width, GLsizei height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (width < 1 || height < 1) return false;
+	if (_ColorTexture) StateTracker::deleteTextures(1, &_ColorTexture);
+	if (_DepthBuffer) glDeleteRenderbuffers(1, &_DepthBuffer);
+
+	glGenTextures(1, &_ColorTexture);
+	StateTracker::bindTexture(GL_TEXTURE_2D, _ColorTexture);
+	glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, width, height);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glGenRenderbuffers(1, &_DepthBuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, _DepthBuffer);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, _Framebuffer);
+	glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, _ColorTexture, 0);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, _DepthBuffer);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, _WindowFramebuffer);
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		cout << "Error: dynamic resolution framebuffer incomplete (0x" << hex << status << dec
+			<< ")" << endl;
+		return false;
+	}
+
+	_TargetWidth = width;
+	_TargetHeight = height;
+	return true;
+}
+// DynamicResolution::resize() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: readQueries()
+// purpose:  Collects the finished scene times in submission order without waiting. Only times
+//           of the currently applied scale reach the controller.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DynamicResolution::readQueries(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < QUERY_COUNT; ++i)
+	{
+		int slot = (_NextQuery + i) % QUERY_COUNT;
+		if (_QueryScales[slot] == 0.0f) continue;
+
+		GLint available = 0;
+		glGetQueryObjectiv(_Queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) break;
+
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64v(_Queries[slot], GL_QUERY_RESULT, &elapsed);
+		if (_QueryScales[slot] == _Statistics.scale) control(elapsed * 1.0e-6);
+		_QueryScales[slot] = 0.0f;
+	}
+}
+// DynamicResolution::readQueries() ///////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: control()
+// purpose:  One PID step in velocity form: the target scale changes by the proportional
+//           term of the error change, the integral term of the error and the derivative term
+//           of the error curvature. The error is limited to [-1, 1], so a single very slow
+//           frame cannot drop the scale to the minimum at once.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void DynamicResolution::control(double milliseconds)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT& s = _Statistics;
+	s.milliseconds = milliseconds;
+	if (s.budget <= 0.0) return;
+
+	float error = float((s.budget - milliseconds) / s.budget);
+	error = min(max(error, -1.0f), 1.0f);
+	if (fabs(error) < DEAD_BAND) error = 0.0f;
+
+	float delta = PROPORTIONAL_GAIN * (error - _Errors[0]) + INTEGRAL_GAIN * error
+		+ DERIVATIVE_GAIN * (error - 2.0f * _Errors[0] + _Errors[1]);
+	_Errors[1] = _Errors[0];
+	_Errors[0] = error;
+	s.targetScale = min(max(s.targetScale + delta, _MinScale), _MaxScale);
+
+	// hysteresis: small corrections accumulate in the target until they are worth a change,
+	// the limits of the range are always reached
+	bool limit = (s.targetScale == _MinScale) || (s.targetScale == _MaxScale);
+	if ((fabs(s.targetScale - s.scale) >= SCALE_STEP) || (limit && s.targetScale != s.scale))
+	{
+		s.scale = s.targetScale;
+		++s.changes;
+	}
+}
+// DynamicResolution::control() ///////////////////////////////////////////////////////////////////
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ErrorCheck.cpp
+//
+//  \brief      OpenGL error checking with selectable cost: none, sampled every Nth frame,
+//              per scope (debug groups) or after every check point.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstring>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/ErrorCheck.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const ErrorCheck::LevelT ErrorCheck::DEFAULT_LEVEL;
+
+ErrorCheck::LevelT ErrorCheck::_Level = ErrorCheck::DEFAULT_LEVEL;
+unsigned ErrorCheck::_SampleInterval = 60;
+size_t   ErrorCheck::_Frame = 0;
+// frame 0 (setup before the first beginFrame()) is a sampled frame
+bool     ErrorCheck::_PointsActive = (ErrorCheck::DEFAULT_LEVEL == ErrorCheck::LEVEL_FULL) ||
+	(ErrorCheck::DEFAULT_LEVEL == ErrorCheck::LEVEL_SAMPLED);
+bool     ErrorCheck::_ScopesActive = (ErrorCheck::DEFAULT_LEVEL != ErrorCheck::LEVEL_NONE);
+size_t   ErrorCheck::_Checks = 0;
+size_t   ErrorCheck::_Errors = 0;
+
+
+
+namespace
+{
+	const char* getErrorName(GLenum error)
+	{
+		switch (error)
+		{
+			case GL_INVALID_ENUM: return "GL_INVALID_ENUM";
+			case GL_INVALID_VALUE: return "GL_INVALID_VALUE";
+			case GL_INVALID_OPERATION: return "GL_INVALID_OPERATION";
+			case GL_INVALID_FRAMEBUFFER_OPERATION: return "GL_INVALID_FRAMEBUFFER_OPERATION";
+			case GL_OUT_OF_MEMORY: return "GL_OUT_OF_MEMORY";
+			case GL_STACK_UNDERFLOW: return "GL_STACK_UNDERFLOW";
+			case GL_STACK_OVERFLOW: return "GL_STACK_OVERFLOW";
+		}
+		return "unknown error";
+	}
+}
+
+
+
+ErrorCheck::ScopeT::ScopeT(const char* label, const char* file, int line)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+	: _Label(label), _File(file), _Line(line), _Active(_ScopesActive), _Group(false)
+{
+	// debug groups name the scope in debug output messages (GL 4.3 / KHR_debug)
+	if (_Active && _Level >= LEVEL_SCOPED && glPushDebugGroup)
+	{
+		glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, label);
+		_Group = true;
+	}
+}
+// ErrorCheck::ScopeT::ScopeT() ///////////////////////////////////////////////////////////////////
+
+
+
+ErrorCheck::ScopeT::~ScopeT(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Group) glPopDebugGroup();
+	if (_Active) check(_Label, _File, _Line);
+}
+// ErrorCheck::ScopeT::~ScopeT() //////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: setLevel()
+// purpose:  Selects the check level, sampleInterval is the frame distance of LEVEL_SAMPLED.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ErrorCheck::setLevel(LevelT level, unsigned sampleInterval)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Level = level;
+	_SampleInterval = (sampleInterval > 0) ? sampleInterval : 1;
+	update();
+}
+// ErrorCheck::setLevel() /////////////////////////////////////////////////////////////////////////
+
+
+
+bool ErrorCheck::parseLevel(const char* name, LevelT& level)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const char* names[] = { "none", "sampled", "scoped", "full" };
+	for (int i = 0; i < 4; ++i)
+	{
+		if (strcmp(name, names[i]) == 0)
+		{
+			level = LevelT(i);
+			return true;
+		}
+	}
+	return false;
+}
+// ErrorCheck::parseLevel() ///////////////////////////////////////////////////////////////////////
+
+
+
+void ErrorCheck::beginFrame(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	++_Frame;
+	update();
+}
+// ErrorCheck::beginFrame() ///////////////////////////////////////////////////////////////////////
+
+
+
+void ErrorCheck::update(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	bool sampled = (_Level == LEVEL_SAMPLED) && (_Frame % _SampleInterval == 0);
+	_PointsActive = (_Level == LEVEL_FULL) || sampled;
+	_ScopesActive = (_Level >= LEVEL_SCOPED) || sampled;
+}
+// ErrorCheck::update() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: check()
+// purpose:  Reads all pending error flags with glGetError() and reports them with the label
+//           and source position of the check point. Returns true if there was no error.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ErrorCheck::check(const char* label, const char* file, int line)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Checks++;
+
+	bool successful = true;
+	for (int i = 0; i < 8; ++i)   // one flag per error type and at most a few of them
+	{
+		GLenum error = glGetError();
+		if (error == GL_NO_ERROR) break;
+
+		cout << "OpenGL Error: " << getErrorName(error) << " in " << label << " (" << file
+			<< ":" << line << ", frame " << _Frame << ")" << endl;
+		_Errors++;
+		successful = false;
+	}
+	return successful;
+}
+// ErrorCheck::check() ////////////////////////////////////////////////////////////////////////////
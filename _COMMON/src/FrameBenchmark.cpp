@@ -0,0 +1,415 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   FrameBenchmark.cpp
+//
+//  \brief      End-to-end frame benchmark: scripted scene and camera path, warmup, frame time
+//              statistics with CPU/GPU split and draw call counts.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Scenes served from the mounted ResourceBundle
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/FrameBenchmark.h"
+#include "../inc/ResourceBundle.h"
+
+
+
+FrameBenchmark::FrameBenchmark(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Frame(0), _GPUTiming(false), _DrawCalls(0), _Triangles(0)
+{
+	_Scene.objectCount = 1;
+	_Scene.triangleCount = 2;
+	_Scene.warmupFrames = 60;
+	_Scene.frameCount = 600;
+	for (int i = 0; i < QUERY_COUNT; ++i)
+	{
+		_Queries[i] = 0;
+		_QueryFrames[i] = -1;
+	}
+}
+// FrameBenchmark::FrameBenchmark() ///////////////////////////////////////////////////////////////
+
+
+
+FrameBenchmark::~FrameBenchmark(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// FrameBenchmark::~FrameBenchmark() //////////////////////////////////////////////////////////////
+
+
+
+void FrameBenchmark::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Queries[0] != 0) glDeleteQueries(QUERY_COUNT, _Queries);
+	for (int i = 0; i < QUERY_COUNT; ++i)
+	{
+		_Queries[i] = 0;
+		_QueryFrames[i] = -1;
+	}
+}
+// FrameBenchmark::release() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: loadScene()
+// purpose:  Reads the scene description and camera path (format see header) and resets all
+//           measurements. Returns false if the file cannot be read or contains errors.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool FrameBenchmark::loadScene(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// scene text from the mounted bundle, else from the file system
+	ResourceBundle::ViewT resource;
+	bool bundled = ResourceBundle::findMounted(filename, resource);
+	istringstream text(bundled ? string(resource.data, resource.size) : string());
+	ifstream file;
+	if (!bundled) file.open(filename.c_str());
+	istream& input = bundled ? static_cast<istream&>(text) : file;
+	if (!input)
+	{
+		cout << "Error: unable to open benchmark scene " << filename << endl;
+		return false;
+	}
+
+	string line;
+	int lineNumber = 0;
+	_Scene.path.clear();
+	while (getline(input, line))
+	{
+		++lineNumber;
+		line = line.substr(0, line.find('#'));
+
+		istringstream stream(line);
+		string keyword;
+		if (!(stream >> keyword)) continue;
+
+		bool valid = false;
+		if (keyword == "objects") valid = bool(stream >> _Scene.objectCount) && (_Scene.objectCount > 0);
+		else if (keyword == "triangles") valid = bool(stream >> _Scene.triangleCount) && (_Scene.triangleCount > 0);
+		else if (keyword == "warmup") valid = bool(stream >> _Scene.warmupFrames) && (_Scene.warmupFrames >= 0);
+		else if (keyword == "frames") valid = bool(stream >> _Scene.frameCount) && (_Scene.frameCount > 0);
+		else if (keyword == "camera")
+		{
+			KeyFrameT key;
+			valid = bool(stream >> key.frame >> key.yaw >> key.pitch >> key.zoom) &&
+				(_Scene.path.empty() || key.frame > _Scene.path.back().frame);
+			if (valid) _Scene.path.push_back(key);
+		}
+
+		if (!valid)
+		{
+			cout << "Error: " << filename << "(" << lineNumber << "): invalid line '" << line << "'" << endl;
+			return false;
+		}
+	}
+
+	// reset the measurements
+	_Frame = 0;
+	_FrameTimes.assign(_Scene.frameCount, 0.0);
+	_CPUTimes.assign(_Scene.frameCount, 0.0);
+	_GPUTimes.assign(_Scene.frameCount, -1.0);
+	_FrameDrawCalls.assign(_Scene.frameCount, 0);
+	_FrameTriangles.assign(_Scene.frameCount, 0);
+
+	release();
+	_GPUTiming = (GLEW_ARB_timer_query != GL_FALSE) || (GLEW_VERSION_3_3 != GL_FALSE);
+	if (_GPUTiming) glGenQueries(QUERY_COUNT, _Queries);
+
+	cout << "Benchmark scene " << filename << ": " << _Scene.objectCount << " objects, "
+		<< _Scene.triangleCount << " triangles per object, " << _Scene.path.size()
+		<< " camera key frames" << endl;
+	return true;
+}
+// FrameBenchmark::loadScene() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: beginFrame()
+// purpose:  Completes the measurement of the previous frame and starts the next one. Returns
+//           false when all frames are measured (the GPU results are then read back).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool FrameBenchmark::beginFrame(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ClockT::time_point now = ClockT::now();
+
+	int previous = _Frame - 1 - _Scene.warmupFrames;
+	if (previous >= 0 && previous < _Scene.frameCount)
+	{
+		_FrameTimes[previous] = chrono::duration<double, milli>(now - _FrameStart).count();
+	}
+
+	if (_Frame >= _Scene.warmupFrames + _Scene.frameCount)
+	{
+		readQueries(true);
+		return false;
+	}
+
+	_FrameStart = now;
+	_DrawCalls = 0;
+	_Triangles = 0;
+
+	if (_GPUTiming)
+	{
+		// reuse the oldest query (QUERY_COUNT frames ago, its result is normally available)
+		int slot = _Frame % QUERY_COUNT;
+		if (_QueryFrames[slot] >= 0) readQueries(true);
+		glBeginQuery(GL_TIME_ELAPSED, _Queries[slot]);
+		_QueryFrames[slot] = _Frame;
+	}
+	return true;
+}
+// FrameBenchmark::beginFrame() ///////////////////////////////////////////////////////////////////
+
+
+
+void FrameBenchmark::addDrawCalls(GLsizei drawCalls, GLsizei triangles)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_DrawCalls += drawCalls;
+	_Triangles += triangles;
+}
+// FrameBenchmark::addDrawCalls() /////////////////////////////////////////////////////////////////
+
+
+
+void FrameBenchmark::endFrame(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_GPUTiming) glEndQuery(GL_TIME_ELAPSED);
+
+	int measured = _Frame - _Scene.warmupFrames;
+	if (measured >= 0)
+	{
+		_CPUTimes[measured] = chrono::duration<double, milli>(ClockT::now() - _FrameStart).count();
+		_FrameDrawCalls[measured] = _DrawCalls;
+		_FrameTriangles[measured] = _Triangles;
+	}
+
+	if (measured == -1) cout << "Benchmark warmup done, measuring " << _Scene.frameCount << " frames" << endl;
+	++_Frame;
+
+	// collect finished queries without waiting
+	if (_GPUTiming) readQueries(false);
+}
+// FrameBenchmark::endFrame() /////////////////////////////////////////////////////////////////////
+
+
+
+void FrameBenchmark::readQueries(bool wait)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < QUERY_COUNT; ++i)
+	{
+		int frame = _QueryFrames[i];
+		if (frame < 0 || frame >= _Frame) continue;   // free or still recording
+
+		GLint available = GL_TRUE;
+		if (!wait) glGetQueryObjectiv(_Queries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) continue;
+
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64v(_Queries[i], GL_QUERY_RESULT, &elapsed);
+		int measured = frame - _Scene.warmupFrames;
+		if (measured >= 0) _GPUTimes[measured] = elapsed * 1.0e-6;
+		_QueryFrames[i] = -1;
+	}
+}
+// FrameBenchmark::readQueries() //////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getCameraTransformation()
+// purpose:  Returns the view transformation of the current frame, interpolated between the
+//           camera key frames. The path repeats after its last key frame.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+glm::mat4 FrameBenchmark::getCameraTransformation(void) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const vector<KeyFrameT>& path = _Scene.path;
+	if (path.empty()) return glm::mat4(1.0f);
+
+	KeyFrameT key = path[0];
+	float period = path.back().frame;
+	if (path.size() > 1 && period > 0.0f)
+	{
+		float t = fmod(float(_Frame), period);
+		size_t i = 1;
+		while (i + 1 < path.size() && path[i].frame <= t) ++i;
+
+		const KeyFrameT& a = path[i - 1];
+		const KeyFrameT& b = path[i];
+		float s = glm::clamp((t - a.frame) / (b.frame - a.frame), 0.0f, 1.0f);
+		key.yaw = glm::mix(a.yaw, b.yaw, s);
+		key.pitch = glm::mix(a.pitch, b.pitch, s);
+		key.zoom = glm::mix(a.zoom, b.zoom, s);
+	}
+
+	glm::mat4 view = glm::scale(glm::mat4(1.0f), glm::vec3(key.zoom));
+	view = glm::rotate(view, glm::radians(key.pitch), glm::vec3(1.0f, 0.0f, 0.0f));
+	return glm::rotate(view, glm::radians(key.yaw), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+// FrameBenchmark::getCameraTransformation() //////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: computeStatistics()
+// purpose:  Mean, median, nearest rank percentiles and range of the samples. Negative
+//           samples (missing GPU results) are ignored.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+FrameBenchmark::StatisticsT FrameBenchmark::computeStatistics(vector<double> samples)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT statistics = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+	size_t valid = 0;
+	for (size_t i = 0; i < samples.size(); ++i)
+	{
+		if (samples[i] >= 0.0) samples[valid++] = samples[i];
+	}
+	samples.resize(valid);
+	if (samples.empty()) return statistics;
+
+	sort(samples.begin(), samples.end());
+	size_t n = samples.size();
+	for (size_t i = 0; i < n; ++i) statistics.mean += samples[i];
+	statistics.mean /= n;
+	statistics.median = (n % 2) ? samples[n / 2] : 0.5 * (samples[n / 2 - 1] + samples[n / 2]);
+	statistics.p95 = samples[size_t(ceil(0.95 * n)) - 1];
+	statistics.p99 = samples[size_t(ceil(0.99 * n)) - 1];
+	statistics.minimum = samples.front();
+	statistics.maximum = samples.back();
+	return statistics;
+}
+// FrameBenchmark::computeStatistics() ////////////////////////////////////////////////////////////
+
+
+
+void FrameBenchmark::report(ostream& out) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const char* names[] = { "frame", "CPU", "GPU" };
+	const vector<double>* samples[] = { &_FrameTimes, &_CPUTimes, &_GPUTimes };
+
+	out << "Frame benchmark: " << _Scene.objectCount << " objects x " << _Scene.triangleCount
+		<< " triangles, " << _Scene.frameCount << " frames after " << _Scene.warmupFrames
+		<< " warmup frames" << endl;
+	out << "  [ms]  " << setw(10) << "mean" << setw(10) << "median" << setw(10) << "p95"
+		<< setw(10) << "p99" << setw(10) << "min" << setw(10) << "max" << endl;
+	for (int i = 0; i < (_GPUTiming ? 3 : 2); ++i)
+	{
+		StatisticsT s = computeStatistics(*samples[i]);
+		out << "  " << left << setw(6) << names[i] << right << fixed << setprecision(3)
+			<< setw(10) << s.mean << setw(10) << s.median << setw(10) << s.p95 << setw(10) << s.p99
+			<< setw(10) << s.minimum << setw(10) << s.maximum << endl;
+	}
+
+	double drawCalls = 0.0, triangles = 0.0;
+	for (int i = 0; i < _Scene.frameCount; ++i)
+	{
+		drawCalls += _FrameDrawCalls[i];
+		triangles += _FrameTriangles[i];
+	}
+	StatisticsT frame = computeStatistics(_FrameTimes);
+	out << "  " << setprecision(1) << drawCalls / _Scene.frameCount << " draw calls, "
+		<< setprecision(0) << triangles / _Scene.frameCount << " triangles per frame, "
+		<< setprecision(1) << (frame.mean > 0.0 ? 1000.0 / frame.mean : 0.0) << " fps" << endl;
+}
+// FrameBenchmark::report() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: writeJSON()
+// purpose:  Writes the statistics in the CG-BENCH result format (one value per line), so
+//           runs on different machines or revisions can be diffed and compared.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool FrameBenchmark::writeJSON(const string& filename) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ofstream file(filename.c_str());
+	if (!file)
+	{
+		cout << "Error: unable to write " << filename << endl;
+		return false;
+	}
+
+	const char* names[] = { "frame", "cpu", "gpu" };
+	const vector<double>* samples[] = { &_FrameTimes, &_CPUTimes, &_GPUTimes };
+	const char* renderer = (const char*) glGetString(GL_RENDERER);
+	time_t now = time(NULL);
+	char date[32];
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&now));
+
+	string rendererName = renderer ? renderer : "unknown";
+	replace(rendererName.begin(), rendererName.end(), '"', '\'');
+
+	file << "{" << endl;
+	file << "  \"context\": { \"date\": \"" << date << "\", \"renderer\": \"" << rendererName
+		<< "\", \"objects\": " << _Scene.objectCount << ", \"triangles\": " << _Scene.triangleCount
+		<< ", \"frames\": " << _Scene.frameCount << " }," << endl;
+	file << "  \"benchmarks\": [" << endl << setprecision(6) << fixed;
+	for (int i = 0; i < (_GPUTiming ? 3 : 2); ++i)
+	{
+		StatisticsT s = computeStatistics(*samples[i]);
+		double values[] = { s.mean, s.median, s.p95, s.p99 };
+		const char* statistics[] = { "mean", "median", "p95", "p99" };
+		for (int k = 0; k < 4; ++k)
+		{
+			file << "    { \"name\": \"frame_benchmark/" << names[i] << "_" << statistics[k]
+				<< "\", \"value\": " << values[k] << ", \"unit\": \"ms\" }," << endl;
+		}
+	}
+
+	double drawCalls = 0.0, triangles = 0.0;
+	for (int i = 0; i < _Scene.frameCount; ++i)
+	{
+		drawCalls += _FrameDrawCalls[i];
+		triangles += _FrameTriangles[i];
+	}
+	file << "    { \"name\": \"frame_benchmark/draw_calls\", \"value\": " << drawCalls / _Scene.frameCount
+		<< ", \"unit\": \"calls\" }," << endl;
+	file << "    { \"name\": \"frame_benchmark/triangles\", \"value\": " << triangles / _Scene.frameCount
+		<< ", \"unit\": \"triangles\" }" << endl;
+	file << "  ]" << endl << "}" << endl;
+
+	cout << "Benchmark results written to " << filename << endl;
+	return true;
+}
+// FrameBenchmark::writeJSON() ////////////////////////////////////////////////////////////////////
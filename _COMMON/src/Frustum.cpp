@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   Frustum.cpp
+//
+//  \brief      View frustum planes extracted from a combined projection and model view matrix
+//              with bounding sphere and axis aligned box tests.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/Frustum.h"
+
+
+
+Frustum::Frustum(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	set(glm::mat4(1.0f));
+}
+// Frustum::Frustum() /////////////////////////////////////////////////////////////////////////////
+
+
+
+Frustum::Frustum(const glm::mat4& viewProjection)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	set(viewProjection);
+}
+// Frustum::Frustum() /////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: set()
+// purpose:  Extracts the clip planes -w <= x,y,z <= w of the given matrix. The rows of the
+//           matrix are the columns of the transposed glm (column major) matrix.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void Frustum::set(const glm::mat4& viewProjection)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::mat4 rows = glm::transpose(viewProjection);
+
+	_Planes[FP_LEFT]   = rows[3] + rows[0];
+	_Planes[FP_RIGHT]  = rows[3] - rows[0];
+	_Planes[FP_BOTTOM] = rows[3] + rows[1];
+	_Planes[FP_TOP]    = rows[3] - rows[1];
+	_Planes[FP_NEAR]   = rows[3] + rows[2];
+	_Planes[FP_FAR]    = rows[3] - rows[2];
+
+	for (int i = 0; i < FP_COUNT; ++i)
+	{
+		float length = glm::length(glm::vec3(_Planes[i]));
+		if (length > 0.0f) _Planes[i] /= length;
+	}
+}
+// Frustum::set() /////////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: testSphere()
+// purpose:  Returns false if the sphere lies completely outside of the frustum (conservative,
+//           spheres near frustum corners may be reported as visible).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool Frustum::testSphere(const glm::vec3& center, float radius) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < FP_COUNT; ++i)
+	{
+		if (glm::dot(glm::vec3(_Planes[i]), center) + _Planes[i].w < -radius) return false;
+	}
+	return true;
+}
+// Frustum::testSphere() //////////////////////////////////////////////////////////////////////////
+
+
+
+Frustum::IntersectionT Frustum::classifySphere(const glm::vec3& center, float radius) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	IntersectionT result = FI_INSIDE;
+	for (int i = 0; i < FP_COUNT; ++i)
+	{
+		float distance = glm::dot(glm::vec3(_Planes[i]), center) + _Planes[i].w;
+		if (distance < -radius) return FI_OUTSIDE;
+		if (distance < radius) result = FI_INTERSECT;
+	}
+	return result;
+}
+// Frustum::classifySphere() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: classifyBox()
+// purpose:  Classifies an axis aligned box by the distance of its center to each plane compared
+//           with the box extent projected onto the plane normal.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+Frustum::IntersectionT Frustum::classifyBox(const glm::vec3& minimum, const glm::vec3& maximum) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::vec3 center = 0.5f * (maximum + minimum);
+	glm::vec3 extent = 0.5f * (maximum - minimum);
+
+	IntersectionT result = FI_INSIDE;
+	for (int i = 0; i < FP_COUNT; ++i)
+	{
+		glm::vec3 normal(_Planes[i]);
+		float distance = glm::dot(normal, center) + _Planes[i].w;
+		float radius = glm::dot(glm::abs(normal), extent);
+		if (distance < -radius) return FI_OUTSIDE;
+		if (distance < radius) result = FI_INTERSECT;
+	}
+	return result;
+}
+// Frustum::classifyBox() /////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,430 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   FrustumCuller.cpp
+//
+//  \brief      Frustum culling kernels over bounding volumes stored as structure of arrays.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cmath>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/CpuInfo.h"
+#include "../inc/FrustumCuller.h"
+
+
+
+// kernels test the volumes in lane blocks and compact the visible indices ////////////////////////
+// Every lane stores its index and the output position advances by the lane's mask bit, so the
+// compaction needs no branches. The volumes after the last full block take the scalar loops.
+namespace
+{
+	struct KernelsT
+	{
+		GLsizei (*cullSpheres)(const Frustum& frustum, const FrustumCuller::SphereArrayT& spheres,
+			GLuint* visible);
+		GLsizei (*cullBoxes)(const Frustum& frustum, const FrustumCuller::BoxArrayT& boxes,
+			GLuint* visible);
+	};
+
+
+	// scalar kernels, from the volume first on with n visible volumes found //////////////////////
+	GLsizei spheresFrom(const Frustum& frustum, const FrustumCuller::SphereArrayT& spheres,
+		GLsizei first, GLsizei n, GLuint* visible)
+	{
+		for (GLsizei i = first; i < spheres.size(); ++i)
+		{
+			bool inside = true;
+			for (int p = 0; p < Frustum::FP_COUNT; ++p)
+			{
+				const glm::vec4& plane = frustum.getPlane(p);
+				inside &= (plane.x * spheres.x[i] + plane.y * spheres.y[i] + plane.z * spheres.z[i]
+					+ plane.w >= -spheres.radius[i]);
+			}
+			visible[n] = GLuint(i);
+			n += inside ? 1 : 0;
+		}
+		return n;
+	}
+
+	GLsizei boxesFrom(const Frustum& frustum, const FrustumCuller::BoxArrayT& boxes,
+		GLsizei first, GLsizei n, GLuint* visible)
+	{
+		for (GLsizei i = first; i < boxes.size(); ++i)
+		{
+			bool inside = true;
+			for (int p = 0; p < Frustum::FP_COUNT; ++p)
+			{
+				const glm::vec4& plane = frustum.getPlane(p);
+				glm::vec4 absolute = glm::abs(plane);
+				float d = plane.x * boxes.centerX[i] + plane.y * boxes.centerY[i]
+					+ plane.z * boxes.centerZ[i] + plane.w + absolute.x * boxes.extentX[i]
+					+ absolute.y * boxes.extentY[i] + absolute.z * boxes.extentZ[i];
+				inside &= (d >= 0.0f);
+			}
+			visible[n] = GLuint(i);
+			n += inside ? 1 : 0;
+		}
+		return n;
+	}
+
+	GLsizei spheresScalar(const Frustum& frustum, const FrustumCuller::SphereArrayT& spheres,
+		GLuint* visible)
+	{
+		return spheresFrom(frustum, spheres, 0, 0, visible);
+	}
+
+	GLsizei boxesScalar(const Frustum& frustum, const FrustumCuller::BoxArrayT& boxes,
+		GLuint* visible)
+	{
+		return boxesFrom(frustum, boxes, 0, 0, visible);
+	}
+
+#if CG_SIMD_X86
+
+	// SSE2 kernels: 4 volumes per register ///////////////////////////////////////////////////////
+	GLsizei spheresSSE2(const Frustum& frustum, const FrustumCuller::SphereArrayT& spheres,
+		GLuint* visible)
+	{
+		GLsizei count = spheres.size(), n = 0, i = 0;
+		__m128 planes[Frustum::FP_COUNT][4];
+		for (int p = 0; p < Frustum::FP_COUNT; ++p)
+		{
+			for (int c = 0; c < 4; ++c) planes[p][c] = _mm_set1_ps(frustum.getPlane(p)[c]);
+		}
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 px = _mm_loadu_ps(&spheres.x[i]), py = _mm_loadu_ps(&spheres.y[i]);
+			__m128 pz = _mm_loadu_ps(&spheres.z[i]);
+			__m128 nr = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(&spheres.radius[i]));
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (int p = 0; p < Frustum::FP_COUNT; ++p)
+			{
+				__m128 d = _mm_add_ps(_mm_mul_ps(planes[p][0], px), planes[p][3]);
+				d = _mm_add_ps(_mm_mul_ps(planes[p][1], py), d);
+				d = _mm_add_ps(_mm_mul_ps(planes[p][2], pz), d);
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(d, nr));
+			}
+
+			int mask = _mm_movemask_ps(inside);
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				visible[n] = GLuint(i + lane);
+				n += (mask >> lane) & 1;
+			}
+		}
+		return spheresFrom(frustum, spheres, i, n, visible);
+	}
+
+	GLsizei boxesSSE2(const Frustum& frustum, const FrustumCuller::BoxArrayT& boxes,
+		GLuint* visible)
+	{
+		GLsizei count = boxes.size(), n = 0, i = 0;
+
+		// plane normals and their absolute values for the projected extent
+		__m128 planes[Frustum::FP_COUNT][4], absolute[Frustum::FP_COUNT][3];
+		for (int p = 0; p < Frustum::FP_COUNT; ++p)
+		{
+			const glm::vec4& plane = frustum.getPlane(p);
+			for (int c = 0; c < 4; ++c) planes[p][c] = _mm_set1_ps(plane[c]);
+			for (int c = 0; c < 3; ++c) absolute[p][c] = _mm_set1_ps(fabs(plane[c]));
+		}
+
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 px = _mm_loadu_ps(&boxes.centerX[i]), py = _mm_loadu_ps(&boxes.centerY[i]);
+			__m128 pz = _mm_loadu_ps(&boxes.centerZ[i]);
+			__m128 qx = _mm_loadu_ps(&boxes.extentX[i]), qy = _mm_loadu_ps(&boxes.extentY[i]);
+			__m128 qz = _mm_loadu_ps(&boxes.extentZ[i]);
+			__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+			for (int p = 0; p < Frustum::FP_COUNT; ++p)
+			{
+				__m128 d = _mm_add_ps(_mm_mul_ps(planes[p][0], px), planes[p][3]);
+				d = _mm_add_ps(_mm_mul_ps(planes[p][1], py), d);
+				d = _mm_add_ps(_mm_mul_ps(planes[p][2], pz), d);
+				d = _mm_add_ps(_mm_mul_ps(absolute[p][0], qx), d);
+				d = _mm_add_ps(_mm_mul_ps(absolute[p][1], qy), d);
+				d = _mm_add_ps(_mm_mul_ps(absolute[p][2], qz), d);
+				inside = _mm_and_ps(inside, _mm_cmpge_ps(d, _mm_setzero_ps()));
+			}
+
+			int mask = _mm_movemask_ps(inside);
+			for (int lane = 0; lane < 4; ++lane)
+			{
+				visible[n] = GLuint(i + lane);
+				n += (mask >> lane) & 1;
+			}
+		}
+		return boxesFrom(frustum, boxes, i, n, visible);
+	}
+
+
+	// AVX2 kernels: 8 volumes per register with FMA //////////////////////////////////////////////
+	CG_TARGET_AVX2 GLsizei spheresAVX2(const Frustum& frustum,
+		const FrustumCuller::SphereArrayT& spheres, GLuint* visible)
+	{
+		GLsizei count = spheres.size(), n = 0, i = 0;
+		__m256 planes[Frustum::FP_COUNT][4];
+		for (int p = 0; p < Frustum::FP_COUNT; ++p)
+		{
+			for (int c = 0; c < 4; ++c) planes[p][c] = _mm256_set1_ps(frustum.getPlane(p)[c]);
+		}
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 px = _mm256_loadu_ps(&spheres.x[i]), py = _mm256_loadu_ps(&spheres.y[i]);
+			__m256 pz = _mm256_loadu_ps(&spheres.z[i]);
+			__m256 nr = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(&spheres.radius[i]));
+			__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			for (int p = 0; p < Frustum::FP_COUNT; ++p)
+			{
+				__m256 d = _mm256_fmadd_ps(planes[p][0], px, planes[p][3]);
+				d = _mm256_fmadd_ps(planes[p][1], py, d);
+				d = _mm256_fmadd_ps(planes[p][2], pz, d);
+				inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, nr, _CMP_GE_OQ));
+			}
+
+			int mask = _mm256_movemask_ps(inside);
+			for (int lane = 0; lane < 8; ++lane)
+			{
+				visible[n] = GLuint(i + lane);
+				n += (mask >> lane) & 1;
+			}
+		}
+		return spheresFrom(frustum, spheres, i, n, visible);
+	}
+
+	CG_TARGET_AVX2 GLsizei boxesAVX2(const Frustum& frustum, const FrustumCuller::BoxArrayT& boxes,
+		GLuint* visible)
+	{
+		GLsizei count = boxes.size(), n = 0, i = 0;
+		__m256 planes[Frustum::FP_COUNT][4], absolute[Frustum::FP_COUNT][3];
+		for (int p = 0; p < Frustum::FP_COUNT; ++p)
+		{
+			const glm::vec4& plane = frustum.getPlane(p);
+			for (int c = 0; c < 4; ++c) planes[p][c] = _mm256_set1_ps(plane[c]);
+			for (int c = 0; c < 3; ++c) absolute[p][c] = _mm256_set1_ps(fabs(plane[c]));
+		}
+
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 px = _mm256_loadu_ps(&boxes.centerX[i]), py = _mm256_loadu_ps(&boxes.centerY[i]);
+			__m256 pz = _mm256_loadu_ps(&boxes.centerZ[i]);
+			__m256 qx = _mm256_loadu_ps(&boxes.extentX[i]), qy = _mm256_loadu_ps(&boxes.extentY[i]);
+			__m256 qz = _mm256_loadu_ps(&boxes.extentZ[i]);
+			__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+			for (int p = 0; p < Frustum::FP_COUNT; ++p)
+			{
+				__m256 d = _mm256_fmadd_ps(planes[p][0], px, planes[p][3]);
+				d = _mm256_fmadd_ps(planes[p][1], py, d);
+				d = _mm256_fmadd_ps(planes[p][2], pz, d);
+				d = _mm256_fmadd_ps(absolute[p][0], qx, d);
+				d = _mm256_fmadd_ps(absolute[p][1], qy, d);
+				d = _mm256_fmadd_ps(absolute[p][2], qz, d);
+				inside = _mm256_and_ps(inside, _mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_GE_OQ));
+			}
+
+			int mask = _mm256_movemask_ps(inside);
+			for (int lane = 0; lane < 8; ++lane)
+			{
+				visible[n] = GLuint(i + lane);
+				n += (mask >> lane) & 1;
+			}
+		}
+		return boxesFrom(frustum, boxes, i, n, visible);
+	}
+
+#endif // CG_SIMD_X86
+
+
+	// kernel sets indexed by CpuInfo::SimdLevelT, AVX-512 uses the AVX2 kernels //////////////////
+	const KernelsT KERNELS[] =
+	{
+		{ spheresScalar, boxesScalar },
+#if CG_SIMD_X86
+		{ spheresSSE2, boxesSSE2 },
+		{ spheresAVX2, boxesAVX2 },
+		{ spheresAVX2, boxesAVX2 },
+#endif
+	};
+
+	const int LANES[] = { 1, 4, 8, 8 };
+	const char* const INSTRUCTION_SETS[] = { "scalar", "SSE2", "AVX2", "AVX2" };
+
+	inline int getKernelIndex(void)
+	{
+		int level = CpuInfo::getLevel();
+		return level < int(sizeof(KERNELS) / sizeof(KERNELS[0])) ? level : 0;
+	}
+}
+
+
+
+void FrustumCuller::SphereArrayT::add(const glm::vec3& center, float r)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	x.push_back(center.x);
+	y.push_back(center.y);
+	z.push_back(center.z);
+	radius.push_back(r);
+}
+// FrustumCuller::SphereArrayT::add() /////////////////////////////////////////////////////////////
+
+
+
+void FrustumCuller::SphereArrayT::set(GLsizei index, const glm::vec3& center, float r)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	x[index] = center.x;
+	y[index] = center.y;
+	z[index] = center.z;
+	radius[index] = r;
+}
+// FrustumCuller::SphereArrayT::set() /////////////////////////////////////////////////////////////
+
+
+
+void FrustumCuller::SphereArrayT::clear(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	x.clear(); y.clear(); z.clear(); radius.clear();
+}
+// FrustumCuller::SphereArrayT::clear() ///////////////////////////////////////////////////////////
+
+
+
+void FrustumCuller::BoxArrayT::add(const glm::vec3& minimum, const glm::vec3& maximum)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	centerX.push_back(0.0f); centerY.push_back(0.0f); centerZ.push_back(0.0f);
+	extentX.push_back(0.0f); extentY.push_back(0.0f); extentZ.push_back(0.0f);
+	set(size() - 1, minimum, maximum);
+}
+// FrustumCuller::BoxArrayT::add() ////////////////////////////////////////////////////////////////
+
+
+
+void FrustumCuller::BoxArrayT::set(GLsizei index, const glm::vec3& minimum, const glm::vec3& maximum)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::vec3 center = 0.5f * (maximum + minimum);
+	glm::vec3 extent = 0.5f * (maximum - minimum);
+	centerX[index] = center.x; centerY[index] = center.y; centerZ[index] = center.z;
+	extentX[index] = extent.x; extentY[index] = extent.y; extentZ[index] = extent.z;
+}
+// FrustumCuller::BoxArrayT::set() ////////////////////////////////////////////////////////////////
+
+
+
+void FrustumCuller::BoxArrayT::clear(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	centerX.clear(); centerY.clear(); centerZ.clear();
+	extentX.clear(); extentY.clear(); extentZ.clear();
+}
+// FrustumCuller::BoxArrayT::clear() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: cullSpheres()
+// purpose:  A sphere is visible unless its center lies more than its radius behind any plane.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLsizei FrustumCuller::cullSpheres(const Frustum& frustum, const SphereArrayT& spheres,
+	GLuint* visible)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return KERNELS[getKernelIndex()].cullSpheres(frustum, spheres, visible);
+}
+// FrustumCuller::cullSpheres() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: cullBoxes()
+// purpose:  A box is visible unless its center lies further behind any plane than the box
+//           extent projected onto the plane normal.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLsizei FrustumCuller::cullBoxes(const Frustum& frustum, const BoxArrayT& boxes, GLuint* visible)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return KERNELS[getKernelIndex()].cullBoxes(frustum, boxes, visible);
+}
+// FrustumCuller::cullBoxes() /////////////////////////////////////////////////////////////////////
+
+
+
+GLsizei FrustumCuller::cullSpheresScalar(const Frustum& frustum, const SphereArrayT& spheres,
+	GLuint* visible)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLsizei n = 0;
+	for (GLsizei i = 0; i < spheres.size(); ++i)
+	{
+		glm::vec3 center(spheres.x[i], spheres.y[i], spheres.z[i]);
+		if (frustum.testSphere(center, spheres.radius[i])) visible[n++] = GLuint(i);
+	}
+	return n;
+}
+// FrustumCuller::cullSpheresScalar() /////////////////////////////////////////////////////////////
+
+
+
+GLsizei FrustumCuller::cullBoxesScalar(const Frustum& frustum, const BoxArrayT& boxes,
+	GLuint* visible)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLsizei n = 0;
+	for (GLsizei i = 0; i < boxes.size(); ++i)
+	{
+		glm::vec3 center(boxes.centerX[i], boxes.centerY[i], boxes.centerZ[i]);
+		glm::vec3 extent(boxes.extentX[i], boxes.extentY[i], boxes.extentZ[i]);
+		if (frustum.classifyBox(center - extent, center + extent) != Frustum::FI_OUTSIDE)
+		{
+			visible[n++] = GLuint(i);
+		}
+	}
+	return n;
+}
+// FrustumCuller::cullBoxesScalar() ///////////////////////////////////////////////////////////////
+
+
+
+int FrustumCuller::getLaneCount(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return LANES[getKernelIndex()];
+}
+// FrustumCuller::getLaneCount() //////////////////////////////////////////////////////////////////
+
+
+
+const char* FrustumCuller::getInstructionSet(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return INSTRUCTION_SETS[getKernelIndex()];
+}
+// FrustumCuller::getInstructionSet() /////////////////////////////////////////////////////////////
@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ImageDecoder.cpp
+//
+//  \brief      Decoding of PNG and JPEG image files to RGBA8 pixels and mipmap generation with
+//              a SIMD 2x2 box filter, independent of OpenGL.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+using namespace std;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+
+// FLTK image decoders ////////////////////////////////////////////////////////////////////////////
+#include <FL/Fl_PNG_Image.H>
+#include <FL/Fl_JPEG_Image.H>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/ImageDecoder.h"
+#include "../inc/ResourceBundle.h"
+#include "../inc/CpuInfo.h"
+
+
+
+// 2x2 box filter kernels for RGBA8 images ////////////////////////////////////////////////////////
+namespace
+{
+	// averages the dst pixels [x, width) of one row, src rows r0 and r1 have srcWidth pixels
+	void downsampleRowScalar(const unsigned char* r0, const unsigned char* r1, int srcWidth,
+		unsigned char* dst, int x, int width)
+	{
+		for (; x < width; ++x)
+		{
+			int x0 = 2 * x, x1 = min(2 * x + 1, srcWidth - 1);
+			for (int c = 0; c < 4; ++c)
+			{
+				int sum = r0[4 * x0 + c] + r0[4 * x1 + c] + r1[4 * x0 + c] + r1[4 * x1 + c];
+				dst[4 * x + c] = (unsigned char) ((sum + 2) >> 2);
+			}
+		}
+	}
+
+#if CG_SIMD_X86
+	// 4 dst pixels from 2 x 8 src pixels per iteration, sums in 16 bit lanes (needs srcWidth >= 2)
+	int downsampleRowSSE2(const unsigned char* r0, const unsigned char* r1, unsigned char* dst,
+		int width)
+	{
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i round = _mm_set1_epi16(2);
+
+		int x = 0;
+		for (; x + 4 <= width; x += 4)
+		{
+			__m128i a0 = _mm_loadu_si128((const __m128i*) (r0 + 8 * x));
+			__m128i a1 = _mm_loadu_si128((const __m128i*) (r0 + 8 * x + 16));
+			__m128i b0 = _mm_loadu_si128((const __m128i*) (r1 + 8 * x));
+			__m128i b1 = _mm_loadu_si128((const __m128i*) (r1 + 8 * x + 16));
+
+			// vertical sums of src pixels 0|1, 2|3, 4|5 and 6|7
+			__m128i p01 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+			__m128i p23 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+			__m128i p45 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+			__m128i p67 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+			// horizontal sums: dst pixels 0|1 and 2|3
+			__m128i d01 = _mm_add_epi16(_mm_unpacklo_epi64(p01, p23), _mm_unpackhi_epi64(p01, p23));
+			__m128i d23 = _mm_add_epi16(_mm_unpacklo_epi64(p45, p67), _mm_unpackhi_epi64(p45, p67));
+			d01 = _mm_srli_epi16(_mm_add_epi16(d01, round), 2);
+			d23 = _mm_srli_epi16(_mm_add_epi16(d23, round), 2);
+
+			_mm_storeu_si128((__m128i*) (dst + 4 * x), _mm_packus_epi16(d01, d23));
+		}
+		return x;
+	}
+#endif // CG_SIMD_X86
+
+
+	bool hasExtension(const string& filename, const char* extension)
+	{
+		size_t length = strlen(extension);
+		if (filename.size() < length) return false;
+		for (size_t i = 0; i < length; ++i)
+		{
+			if (tolower(filename[filename.size() - length + i]) != extension[i]) return false;
+		}
+		return true;
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: decode()
+// purpose:  Decodes the image file into RGBA8 rows, bottom row first. Returns false if the
+//           file cannot be read or has an unsupported format.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ImageDecoder::decode(const string& filename, int& width, int& height,
+	vector<unsigned char>& pixels)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	Fl_RGB_Image* decoder = NULL;
+	if (hasExtension(filename, ".png"))
+	{
+		decoder = new Fl_PNG_Image(filename.c_str());
+	}
+	else if (hasExtension(filename, ".jpg") || hasExtension(filename, ".jpeg"))
+	{
+		ResourceBundle::ViewT view;
+		if (ResourceBundle::findMounted(filename, view))
+		{
+			decoder = new Fl_JPEG_Image(filename.c_str(), (const unsigned char*) view.data);
+		}
+		else decoder = new Fl_JPEG_Image(filename.c_str());
+	}
+
+	if (!decoder || decoder->fail() || decoder->w() <= 0 || decoder->h() <= 0 ||
+		decoder->d() < 1 || decoder->d() > 4 || !decoder->data())
+	{
+		delete decoder;
+		return false;
+	}
+
+	width = decoder->w();
+	height = decoder->h();
+	pixels.resize(size_t(width) * height * 4);
+
+	// expand gray, gray alpha and RGB to RGBA, the first row becomes the bottom row (t = 0)
+	int depth = decoder->d();
+	int stride = decoder->ld() ? decoder->ld() : width * depth;
+	const unsigned char* data = (const unsigned char*) decoder->data()[0];
+	for (int y = 0; y < height; ++y)
+	{
+		const unsigned char* src = data + size_t(height - 1 - y) * stride;
+		unsigned char* dst = &pixels[size_t(y) * width * 4];
+		for (int x = 0; x < width; ++x, src += depth, dst += 4)
+		{
+			switch (depth)
+			{
+				case 1: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = 255; break;
+				case 2: dst[0] = dst[1] = dst[2] = src[0]; dst[3] = src[1]; break;
+				case 3: dst[0] = src[0]; dst[1] = src[1]; dst[2] = src[2]; dst[3] = 255; break;
+				case 4: memcpy(dst, src, 4); break;
+			}
+		}
+	}
+	delete decoder;
+	return true;
+}
+// ImageDecoder::decode() /////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getLevelCount()
+// purpose:  Returns the number of levels of a complete mipmap chain.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int ImageDecoder::getLevelCount(int width, int height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int levels = 1;
+	for (int size = max(width, height); size > 1; size >>= 1) levels++;
+	return levels;
+}
+// ImageDecoder::getLevelCount() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: downsample()
+// purpose:  Builds the next mipmap level (max(1, width / 2) x max(1, height / 2)) of an RGBA8
+//           image with a rounded 2x2 box filter, the last row or column of odd sizes is
+//           dropped. Uses SSE2 if CpuInfo reports it.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ImageDecoder::downsample(const unsigned char* src, int width, int height, unsigned char* dst)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int dstWidth = max(1, width / 2);
+	int dstHeight = max(1, height / 2);
+	bool simd = CG_SIMD_X86 && (width >= 2) && (CpuInfo::getLevel() >= CpuInfo::SL_SSE2);
+
+	for (int y = 0; y < dstHeight; ++y)
+	{
+		const unsigned char* r0 = src + size_t(2 * y) * width * 4;
+		const unsigned char* r1 = src + size_t(min(2 * y + 1, height - 1)) * width * 4;
+		unsigned char* row = dst + size_t(y) * dstWidth * 4;
+
+		int x = 0;
+#if CG_SIMD_X86
+		if (simd) x = downsampleRowSSE2(r0, r1, row, dstWidth);
+#endif
+		downsampleRowScalar(r0, r1, width, row, x, dstWidth);
+	}
+}
+// ImageDecoder::downsample() ////////////////////////////////////////////////////////////////////
@@ -0,0 +1,371 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   InstanceBuffer.cpp
+//
+//  \brief      Per-instance attribute stream for hardware instanced rendering with
+//              glDrawArraysInstanced() and glVertexAttribDivisor().
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Bindings through the StateTracker
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/InstanceBuffer.h"
+#include "../inc/StateTracker.h"
+
+
+#define BUFFER_OFFSET( offset )   ((GLvoid*) (offset))
+
+
+
+InstanceBuffer::InstanceBuffer(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _VAO(0), _VBO(0), _Location(0), _MaxInstances(0), _InstanceCount(0), _Segment(0), _Format(IF_MAT4)
+{
+	for (int i = 0; i < RING_SEGMENTS; ++i) _Fences[i] = 0;
+}
+// InstanceBuffer::InstanceBuffer() ///////////////////////////////////////////////////////////////
+
+
+
+InstanceBuffer::~InstanceBuffer(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// InstanceBuffer::~InstanceBuffer() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getAttributeCount()
+// purpose:  Returns the number of consecutive vec4 attribute locations used by a format.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLsizei InstanceBuffer::getAttributeCount(InstanceFormatT format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (format)
+	{
+		case IF_MAT4:     return 4;
+		case IF_MAT3X4:   return 3;
+		case IF_QUAT_TRS: return 2;
+	}
+	return 0;
+}
+// InstanceBuffer::getAttributeCount() ////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getInstanceSize()
+// purpose:  Returns the size of one instance record in bytes.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLsizei InstanceBuffer::getInstanceSize(InstanceFormatT format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return getAttributeCount(format) * GLsizei(sizeof(glm::vec4));
+}
+// InstanceBuffer::getInstanceSize() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  Creates the streaming buffer for maxInstances instances and sets up the instanced
+//           attributes (divisor 1) of the given vertex array object starting at location.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void InstanceBuffer::init(GLuint vao, GLuint location, GLsizei maxInstances, InstanceFormatT format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+
+	_VAO = vao;
+	_Location = location;
+	_MaxInstances = maxInstances;
+	_Format = format;
+
+	// allocate all ring segments in one buffer object
+	GLsizeiptr size = GLsizeiptr(getInstanceSize(_Format)) * _MaxInstances * RING_SEGMENTS;
+	glGenBuffers(1, &_VBO);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, _VBO);
+	glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
+
+	StateTracker::bindVertexArray(_VAO);
+	for (GLsizei i = 0; i < getAttributeCount(_Format); ++i)
+	{
+		glEnableVertexAttribArray(_Location + i);
+		glVertexAttribDivisor(_Location + i, 1);
+	}
+
+	cout << "Instance Buffer: " << _MaxInstances << " instances, "
+		<< getInstanceSize(_Format) << " bytes per instance" << endl;
+}
+// InstanceBuffer::init() /////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: release()
+// purpose:  Deletes the buffer object and all pending fence objects.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void InstanceBuffer::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < RING_SEGMENTS; ++i)
+	{
+		if (_Fences[i]) glDeleteSync(_Fences[i]);
+		_Fences[i] = 0;
+	}
+
+	if (_VAO && _VBO)
+	{
+		StateTracker::bindVertexArray(_VAO);
+		for (GLsizei i = 0; i < getAttributeCount(_Format); ++i)
+		{
+			glVertexAttribDivisor(_Location + i, 0);
+			glDisableVertexAttribArray(_Location + i);
+		}
+	}
+
+	if (_VBO) StateTracker::deleteBuffers(1, &_VBO);
+	_VBO = 0;
+	_InstanceCount = 0;
+	_Segment = 0;
+}
+// InstanceBuffer::release() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: mapSegment()
+// purpose:  Advances to the next ring segment, waits until the GPU has finished reading it and
+//           maps it unsynchronized for writing. If the wait times out or fails, the segment is
+//           mapped synchronized and the driver waits instead.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void* InstanceBuffer::mapSegment(GLsizei count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Segment = (_Segment + 1) % RING_SEGMENTS;
+	GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+
+	// the segment was last used RING_SEGMENTS frames ago, so this normally does not block
+	if (_Fences[_Segment])
+	{
+		GLenum status = glClientWaitSync(_Fences[_Segment], GL_SYNC_FLUSH_COMMANDS_BIT,
+			GLuint64(1000000000));
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+		{
+			access &= ~GL_MAP_UNSYNCHRONIZED_BIT;
+		}
+		glDeleteSync(_Fences[_Segment]);
+		_Fences[_Segment] = 0;
+	}
+
+	GLsizeiptr stride = getInstanceSize(_Format);
+	GLintptr offset = stride * _MaxInstances * _Segment;
+
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, _VBO);
+	return glMapBufferRange(GL_ARRAY_BUFFER, offset, stride * count, access);
+}
+// InstanceBuffer::mapSegment() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: unmapSegment()
+// purpose:  Unmaps the current ring segment and points the instanced attributes at it.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void InstanceBuffer::unmapSegment(GLsizei count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, _VBO);
+	glUnmapBuffer(GL_ARRAY_BUFFER);
+
+	GLsizei stride = getInstanceSize(_Format);
+	GLintptr offset = GLintptr(stride) * _MaxInstances * _Segment;
+
+	StateTracker::bindVertexArray(_VAO);
+	for (GLsizei i = 0; i < getAttributeCount(_Format); ++i)
+	{
+		glVertexAttribPointer(_Location + i, 4, GL_FLOAT, GL_FALSE, stride,
+			BUFFER_OFFSET(offset + i * sizeof(glm::vec4)));
+	}
+
+	_InstanceCount = count;
+}
+// InstanceBuffer::unmapSegment() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: update()
+// purpose:  Streams count instance transforms into the buffer, converting them into the
+//           compact format if required. For IF_QUAT_TRS the matrices are decomposed, so prefer
+//           the quaternion overload for that format.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLsizei InstanceBuffer::update(const glm::mat4* transforms, GLsizei count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (count > _MaxInstances) count = _MaxInstances;
+	if (count <= 0)
+	{
+		// nothing visible: an empty range can not be mapped
+		_InstanceCount = 0;
+		return 0;
+	}
+
+	glm::vec4* dst = (glm::vec4*) mapSegment(count);
+	if (dst == NULL)
+	{
+		// draw nothing rather than the instances of an older segment
+		cout << "Error: unable to map instance buffer" << endl;
+		_InstanceCount = 0;
+		return 0;
+	}
+
+	switch (_Format)
+	{
+		case IF_MAT4:
+		{
+			for (GLsizei i = 0; i < count; ++i, dst += 4)
+			{
+				const glm::mat4& m = transforms[i];
+				dst[0] = m[0]; dst[1] = m[1]; dst[2] = m[2]; dst[3] = m[3];
+			}
+			break;
+		}
+		case IF_MAT3X4:
+		{
+			// store the first three rows, the last row of an affine transform is (0,0,0,1)
+			for (GLsizei i = 0; i < count; ++i, dst += 3)
+			{
+				const glm::mat4& m = transforms[i];
+				dst[0] = glm::vec4(m[0][0], m[1][0], m[2][0], m[3][0]);
+				dst[1] = glm::vec4(m[0][1], m[1][1], m[2][1], m[3][1]);
+				dst[2] = glm::vec4(m[0][2], m[1][2], m[2][2], m[3][2]);
+			}
+			break;
+		}
+		case IF_QUAT_TRS:
+		{
+			for (GLsizei i = 0; i < count; ++i, dst += 2)
+			{
+				const glm::mat4& m = transforms[i];
+				float scale = glm::length(glm::vec3(m[0]));
+				glm::quat q = glm::quat_cast(glm::mat3(m) / scale);
+				dst[0] = glm::vec4(q.x, q.y, q.z, q.w);
+				dst[1] = glm::vec4(glm::vec3(m[3]), scale);
+			}
+			break;
+		}
+	}
+
+	unmapSegment(count);
+	return count;
+}
+// InstanceBuffer::update() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: update()
+// purpose:  Streams count instances given as rotation quaternion and translation (xyz) with
+//           uniform scale (w). Matrix formats are expanded from these components.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLsizei InstanceBuffer::update(const glm::quat* rotations, const glm::vec4* translationScale,
+	GLsizei count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (count > _MaxInstances) count = _MaxInstances;
+	if (count <= 0)
+	{
+		// nothing visible: an empty range can not be mapped
+		_InstanceCount = 0;
+		return 0;
+	}
+
+	glm::vec4* dst = (glm::vec4*) mapSegment(count);
+	if (dst == NULL)
+	{
+		// draw nothing rather than the instances of an older segment
+		cout << "Error: unable to map instance buffer" << endl;
+		_InstanceCount = 0;
+		return 0;
+	}
+
+	if (_Format == IF_QUAT_TRS)
+	{
+		for (GLsizei i = 0; i < count; ++i, dst += 2)
+		{
+			const glm::quat& q = rotations[i];
+			dst[0] = glm::vec4(q.x, q.y, q.z, q.w);
+			dst[1] = translationScale[i];
+		}
+	}
+	else
+	{
+		GLsizei attributes = getAttributeCount(_Format);
+		for (GLsizei i = 0; i < count; ++i, dst += attributes)
+		{
+			glm::mat3 r = glm::mat3_cast(rotations[i]) * translationScale[i].w;
+			glm::vec3 t = glm::vec3(translationScale[i]);
+
+			if (_Format == IF_MAT4)
+			{
+				dst[0] = glm::vec4(r[0], 0.0f);
+				dst[1] = glm::vec4(r[1], 0.0f);
+				dst[2] = glm::vec4(r[2], 0.0f);
+				dst[3] = glm::vec4(t, 1.0f);
+			}
+			else
+			{
+				dst[0] = glm::vec4(r[0][0], r[1][0], r[2][0], t.x);
+				dst[1] = glm::vec4(r[0][1], r[1][1], r[2][1], t.y);
+				dst[2] = glm::vec4(r[0][2], r[1][2], r[2][2], t.z);
+			}
+		}
+	}
+
+	unmapSegment(count);
+	return count;
+}
+// InstanceBuffer::update() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: drawArrays()
+// purpose:  Draws the vertex range of the bound vertex array once for every streamed instance
+//           and fences the current ring segment.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void InstanceBuffer::drawArrays(GLenum mode, GLint first, GLsizei vertexCount)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_InstanceCount == 0) return;
+
+	StateTracker::bindVertexArray(_VAO);
+	glDrawArraysInstanced(mode, first, vertexCount, _InstanceCount);
+
+	if (_Fences[_Segment]) glDeleteSync(_Fences[_Segment]);
+	_Fences[_Segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+// InstanceBuffer::drawArrays() ///////////////////////////////////////////////////////////////////
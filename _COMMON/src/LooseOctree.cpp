@@ -0,0 +1,385 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   LooseOctree.cpp
+//
+//  \brief      Loose octree scene index over bounding spheres for frustum culling and proximity
+//              queries of large dynamic scenes.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cmath>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/LooseOctree.h"
+
+
+
+// static class constants /////////////////////////////////////////////////////////////////////////
+const GLuint LooseOctree::INVALID;
+const int    LooseOctree::MAX_DEPTH;
+
+
+
+namespace
+{
+	// query predicates: classify() tests loose node boxes, test() the object spheres
+	struct FrustumTestT
+	{
+		const Frustum& frustum;
+
+		FrustumTestT(const Frustum& f) : frustum(f) {}
+		Frustum::IntersectionT classify(const glm::vec3& minimum, const glm::vec3& maximum) const
+		{
+			return frustum.classifyBox(minimum, maximum);
+		}
+		bool test(const glm::vec4& sphere) const
+		{
+			return frustum.testSphere(glm::vec3(sphere), sphere.w);
+		}
+	};
+
+	struct SphereTestT
+	{
+		glm::vec3 center;
+		float     radius;
+
+		SphereTestT(const glm::vec3& c, float r) : center(c), radius(r) {}
+		Frustum::IntersectionT classify(const glm::vec3& minimum, const glm::vec3& maximum) const
+		{
+			glm::vec3 nearest = glm::clamp(center, minimum, maximum);
+			glm::vec3 farthest = glm::max(glm::abs(center - minimum), glm::abs(maximum - center));
+			if (glm::dot(nearest - center, nearest - center) > radius * radius) return Frustum::FI_OUTSIDE;
+			if (glm::dot(farthest, farthest) <= radius * radius) return Frustum::FI_INSIDE;
+			return Frustum::FI_INTERSECT;
+		}
+		bool test(const glm::vec4& sphere) const
+		{
+			glm::vec3 d = glm::vec3(sphere) - center;
+			float r = radius + sphere.w;
+			return glm::dot(d, d) <= r * r;
+		}
+	};
+}
+
+
+
+LooseOctree::LooseOctree(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _MaxDepth(0)
+{
+	init(glm::vec3(0.0f), 1.0f);
+}
+// LooseOctree::LooseOctree() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  Removes all objects and defines the root cell (center and half size) and the
+//           maximum subdivision depth (at most MAX_DEPTH).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void LooseOctree::init(const glm::vec3& center, float halfSize, int maxDepth)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	NodeT root;
+	root.center = center;
+	root.halfSize = halfSize;
+	root.parent = INVALID;
+	root.firstChild = INVALID;
+	root.firstObject = INVALID;
+	root.objectCount = 0;
+
+	clear();
+	_Nodes.assign(1, root);
+	_MaxDepth = glm::clamp(maxDepth, 0, int(MAX_DEPTH));
+}
+// LooseOctree::init() ////////////////////////////////////////////////////////////////////////////
+
+
+
+void LooseOctree::clear(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Nodes.empty())
+	{
+		_Nodes.resize(1);
+		_Nodes[0].firstChild = INVALID;
+		_Nodes[0].firstObject = INVALID;
+		_Nodes[0].objectCount = 0;
+	}
+	_FreeBlocks.clear();
+	_Bounds.clear();
+	_ObjectNode.clear();
+	_Next.clear();
+	_Previous.clear();
+	_FreeObjects.clear();
+}
+// LooseOctree::clear() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: insert()
+// purpose:  Adds a bounding sphere and returns its handle. Handles of removed objects are
+//           reused, so handles stay dense for indexing per object arrays.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint LooseOctree::insert(const glm::vec3& center, float radius)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint handle;
+	if (!_FreeObjects.empty())
+	{
+		handle = _FreeObjects.back();
+		_FreeObjects.pop_back();
+	}
+	else
+	{
+		handle = GLuint(_Bounds.size());
+		_Bounds.push_back(glm::vec4(0.0f));
+		_ObjectNode.push_back(INVALID);
+		_Next.push_back(INVALID);
+		_Previous.push_back(INVALID);
+	}
+
+	_Bounds[handle] = glm::vec4(center, radius);
+	link(handle, locate(center, radius, true));
+	return handle;
+}
+// LooseOctree::insert() //////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: update()
+// purpose:  Moves an object. If it still belongs to the same cell only its bounds are written,
+//           otherwise it is relinked (and empty subtrees on the old path are recycled).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void LooseOctree::update(GLuint handle, const glm::vec3& center, float radius)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Bounds[handle] = glm::vec4(center, radius);
+	if (locate(center, radius, false) == _ObjectNode[handle]) return;
+
+	unlink(handle);
+	link(handle, locate(center, radius, true));
+}
+// LooseOctree::update() //////////////////////////////////////////////////////////////////////////
+
+
+
+void LooseOctree::remove(GLuint handle)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_ObjectNode[handle] == INVALID) return;
+
+	unlink(handle);
+	_FreeObjects.push_back(handle);
+}
+// LooseOctree::remove() //////////////////////////////////////////////////////////////////////////
+
+
+
+void LooseOctree::queryFrustum(const Frustum& frustum, vector<GLuint>& result) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	query(FrustumTestT(frustum), result);
+}
+// LooseOctree::queryFrustum() ////////////////////////////////////////////////////////////////////
+
+
+
+void LooseOctree::querySphere(const glm::vec3& center, float radius, vector<GLuint>& result) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	query(SphereTestT(center, radius), result);
+}
+// LooseOctree::querySphere() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: locate()
+// purpose:  Returns the deepest cell containing the object center whose loose bounds still
+//           enclose the sphere. Without create, INVALID is returned if that cell does not exist.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint LooseOctree::locate(const glm::vec3& center, float radius, bool create)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint node = 0;
+	glm::vec3 offset = glm::abs(center - _Nodes[0].center);
+	float halfSize = _Nodes[0].halfSize;
+	if (glm::max(offset.x, glm::max(offset.y, offset.z)) > halfSize) return 0;
+
+	for (int depth = 0; depth < _MaxDepth && radius <= 0.5f * halfSize; ++depth)
+	{
+		if (_Nodes[node].firstChild == INVALID)
+		{
+			if (!create) return INVALID;
+			allocateChildren(node);
+		}
+
+		const glm::vec3& c = _Nodes[node].center;
+		GLuint octant = (center.x >= c.x ? 1 : 0) | (center.y >= c.y ? 2 : 0) | (center.z >= c.z ? 4 : 0);
+		node = _Nodes[node].firstChild + octant;
+		halfSize *= 0.5f;
+	}
+	return node;
+}
+// LooseOctree::locate() //////////////////////////////////////////////////////////////////////////
+
+
+
+GLuint LooseOctree::allocateChildren(GLuint node)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint first;
+	if (!_FreeBlocks.empty())
+	{
+		first = _FreeBlocks.back();
+		_FreeBlocks.pop_back();
+	}
+	else
+	{
+		first = GLuint(_Nodes.size());
+		_Nodes.resize(_Nodes.size() + 8);
+	}
+
+	// (may have reallocated the node array)
+	NodeT& parent = _Nodes[node];
+	float halfSize = 0.5f * parent.halfSize;
+	for (GLuint octant = 0; octant < 8; ++octant)
+	{
+		NodeT& child = _Nodes[first + octant];
+		child.center = parent.center + halfSize * glm::vec3(
+			(octant & 1) ? 1.0f : -1.0f, (octant & 2) ? 1.0f : -1.0f, (octant & 4) ? 1.0f : -1.0f);
+		child.halfSize = halfSize;
+		child.parent = node;
+		child.firstChild = INVALID;
+		child.firstObject = INVALID;
+		child.objectCount = 0;
+	}
+	parent.firstChild = first;
+	return first;
+}
+// LooseOctree::allocateChildren() ////////////////////////////////////////////////////////////////
+
+
+
+void LooseOctree::link(GLuint handle, GLuint node)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	NodeT& n = _Nodes[node];
+	_ObjectNode[handle] = node;
+	_Previous[handle] = INVALID;
+	_Next[handle] = n.firstObject;
+	if (n.firstObject != INVALID) _Previous[n.firstObject] = handle;
+	n.firstObject = handle;
+
+	for (GLuint i = node; i != INVALID; i = _Nodes[i].parent) _Nodes[i].objectCount++;
+}
+// LooseOctree::link() ////////////////////////////////////////////////////////////////////////////
+
+
+
+void LooseOctree::unlink(GLuint handle)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint node = _ObjectNode[handle];
+	if (_Previous[handle] != INVALID) _Next[_Previous[handle]] = _Next[handle];
+	else _Nodes[node].firstObject = _Next[handle];
+	if (_Next[handle] != INVALID) _Previous[_Next[handle]] = _Previous[handle];
+	_ObjectNode[handle] = INVALID;
+
+	// update the subtree counts and recycle the children of the topmost empty ancestor
+	GLuint empty = INVALID;
+	for (GLuint i = node; i != INVALID; i = _Nodes[i].parent)
+	{
+		if (--_Nodes[i].objectCount == 0) empty = i;
+	}
+	if (empty != INVALID) releaseChildren(empty);
+}
+// LooseOctree::unlink() //////////////////////////////////////////////////////////////////////////
+
+
+
+void LooseOctree::releaseChildren(GLuint node)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint first = _Nodes[node].firstChild;
+	if (first == INVALID) return;
+
+	for (GLuint octant = 0; octant < 8; ++octant) releaseChildren(first + octant);
+	_Nodes[node].firstChild = INVALID;
+	_FreeBlocks.push_back(first);
+}
+// LooseOctree::releaseChildren() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: query()
+// purpose:  Depth first traversal over non empty subtrees. Subtrees whose loose cell is fully
+//           inside the query volume are appended without testing individual objects.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+template<typename TestT>
+void LooseOctree::query(const TestT& test, vector<GLuint>& result) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// a depth first traversal pushes at most seven siblings per level
+	GLuint stack[8 * MAX_DEPTH + 1];
+	bool inside[8 * MAX_DEPTH + 1];
+	int top = 0;
+
+	stack[top] = 0;
+	inside[top++] = false;
+	while (top > 0)
+	{
+		--top;
+		const NodeT& node = _Nodes[stack[top]];
+		bool contained = inside[top];
+		if (node.objectCount == 0) continue;
+
+		if (!contained)
+		{
+			// the root cell does not bound objects outside of it, so it is never culled
+			glm::vec3 loose(2.0f * node.halfSize);
+			Frustum::IntersectionT intersection = (node.parent == INVALID) ?
+				Frustum::FI_INTERSECT : test.classify(node.center - loose, node.center + loose);
+			if (intersection == Frustum::FI_OUTSIDE) continue;
+			contained = (intersection == Frustum::FI_INSIDE);
+		}
+
+		for (GLuint i = node.firstObject; i != INVALID; i = _Next[i])
+		{
+			if (contained || test.test(_Bounds[i])) result.push_back(i);
+		}
+
+		if (node.firstChild != INVALID)
+		{
+			for (GLuint octant = 0; octant < 8; ++octant)
+			{
+				stack[top] = node.firstChild + octant;
+				inside[top++] = contained;
+			}
+		}
+	}
+}
+// LooseOctree::query() ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   MappedFile.cpp
+//
+//  \brief      Read only memory mapping of a whole file (mmap, file mapping on Windows).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <string>
+using namespace std;
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/MappedFile.h"
+
+
+
+MappedFile::MappedFile(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+	: _Data(NULL), _Size(0), _File(NULL), _Mapping(NULL)
+{
+}
+// MappedFile::MappedFile() ///////////////////////////////////////////////////////////////////////
+
+
+
+MappedFile::~MappedFile(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	close();
+}
+// MappedFile::~MappedFile() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: open()
+// purpose:  Maps the file read only into memory. Returns false (silently) if the file does not
+//           exist, is empty or cannot be mapped.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool MappedFile::open(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return false;
+	LARGE_INTEGER size;
+	HANDLE mapping = NULL;
+	if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+	{
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	}
+	if (mapping == NULL)
+	{
+		CloseHandle(file);
+		return false;
+	}
+	_Data = (const char*) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	_Size = size_t(size.QuadPart);
+	_File = file;
+	_Mapping = mapping;
+#else
+	int file = ::open(filename.c_str(), O_RDONLY);
+	if (file < 0) return false;
+	struct stat status;
+	void* data = MAP_FAILED;
+	if (fstat(file, &status) == 0 && status.st_size > 0)
+	{
+		data = mmap(NULL, size_t(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	}
+	::close(file);   // the mapping keeps the file referenced
+	if (data == MAP_FAILED) return false;
+	_Data = (const char*) data;
+	_Size = size_t(status.st_size);
+#endif
+
+	if (_Data == NULL)
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+// MappedFile::open() /////////////////////////////////////////////////////////////////////////////
+
+
+
+void MappedFile::close(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+#ifdef _WIN32
+	if (_Data != NULL) UnmapViewOfFile(_Data);
+	if (_Mapping != NULL) CloseHandle((HANDLE) _Mapping);
+	if (_File != NULL) CloseHandle((HANDLE) _File);
+#else
+	if (_Data != NULL) munmap((void*) _Data, _Size);
+#endif
+
+	_Data = NULL;
+	_Size = 0;
+	_File = NULL;
+	_Mapping = NULL;
+}
+// MappedFile::close() ////////////////////////////////////////////////////////////////////////////
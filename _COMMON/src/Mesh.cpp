@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   Mesh.cpp
+//
+//  \brief      Simple indexed triangle mesh container with procedural mesh generators.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <cmath>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/Mesh.h"
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getBounds()
+// purpose:  Returns the axis aligned bounding box of all mesh vertices.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void Mesh::getBounds(glm::vec3& minimum, glm::vec3& maximum) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	minimum = maximum = positions.empty() ? glm::vec3(0.0f) : positions[0];
+	for (size_t i = 1; i < positions.size(); ++i)
+	{
+		minimum = glm::min(minimum, positions[i]);
+		maximum = glm::max(maximum, positions[i]);
+	}
+}
+// Mesh::getBounds() //////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: createSphere()
+// purpose:  Creates a closed UV sphere with (2 + slices * (stacks - 1)) vertices and
+//           (2 * slices * (stacks - 1)) triangles. The longitude seam is shared, so the mesh
+//           has no boundary edges.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+Mesh Mesh::createSphere(float radius, int slices, int stacks)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	Mesh mesh;
+	if (slices < 3) slices = 3;
+	if (stacks < 2) stacks = 2;
+
+	// north pole, rings and south pole
+	mesh.positions.reserve(2 + slices * (stacks - 1));
+	mesh.positions.push_back(glm::vec3(0.0f, radius, 0.0f));
+	for (int j = 1; j < stacks; ++j)
+	{
+		float theta = glm::pi<float>() * j / stacks;
+		for (int i = 0; i < slices; ++i)
+		{
+			float phi = 2.0f * glm::pi<float>() * i / slices;
+			mesh.positions.push_back(radius * glm::vec3(sin(theta) * cos(phi), cos(theta),
+				-sin(theta) * sin(phi)));
+		}
+	}
+	mesh.positions.push_back(glm::vec3(0.0f, -radius, 0.0f));
+
+	// counter clockwise triangles seen from outside
+	GLuint south = GLuint(mesh.positions.size() - 1);
+	mesh.indices.reserve(6 * slices * (stacks - 1));
+	for (int i = 0; i < slices; ++i)
+	{
+		GLuint i0 = 1 + i, i1 = 1 + (i + 1) % slices;
+		mesh.indices.push_back(0); mesh.indices.push_back(i0); mesh.indices.push_back(i1);
+	}
+	for (int j = 0; j < stacks - 2; ++j)
+	{
+		for (int i = 0; i < slices; ++i)
+		{
+			GLuint a = 1 + j * slices + i;
+			GLuint b = 1 + j * slices + (i + 1) % slices;
+			GLuint c = a + slices;
+			GLuint d = b + slices;
+			mesh.indices.push_back(a); mesh.indices.push_back(c); mesh.indices.push_back(d);
+			mesh.indices.push_back(a); mesh.indices.push_back(d); mesh.indices.push_back(b);
+		}
+	}
+	for (int i = 0; i < slices; ++i)
+	{
+		GLuint i0 = 1 + (stacks - 2) * slices + i, i1 = 1 + (stacks - 2) * slices + (i + 1) % slices;
+		mesh.indices.push_back(i0); mesh.indices.push_back(south); mesh.indices.push_back(i1);
+	}
+
+	return mesh;
+}
+// Mesh::createSphere() ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,592 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   MeshLOD.cpp
+//
+//  \brief      Level of detail chain built with a quadric error metric (QEM) edge collapse
+//              simplifier and runtime level selection by projected screen-space error.
+//              The simplifier follows Garland and Heckbert, "Surface Simplification Using
+//              Quadric Error Metrics" (SIGGRAPH 1997), restricted to half edge collapses so
+//              that all levels can share the original vertex buffer.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Bindings through the StateTracker
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/MeshLOD.h"
+#include "../inc/StateTracker.h"
+
+
+#define BUFFER_OFFSET( offset )   ((GLvoid*) (offset))
+
+
+
+// local helper types /////////////////////////////////////////////////////////////////////////////
+namespace
+{
+	// symmetric 4x4 error quadric, stored as upper triangle plus accumulated area weight
+	struct QuadricT
+	{
+		double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2, weight;
+
+		QuadricT(void) : a2(0), ab(0), ac(0), ad(0), b2(0), bc(0), bd(0), c2(0), cd(0), d2(0), weight(0) {}
+
+		void addPlane(const glm::dvec3& n, double d, double w)
+		{
+			a2 += w * n.x * n.x; ab += w * n.x * n.y; ac += w * n.x * n.z; ad += w * n.x * d;
+			b2 += w * n.y * n.y; bc += w * n.y * n.z; bd += w * n.y * d;
+			c2 += w * n.z * n.z; cd += w * n.z * d;
+			d2 += w * d * d;
+			weight += w;
+		}
+
+		void add(const QuadricT& q)
+		{
+			a2 += q.a2; ab += q.ab; ac += q.ac; ad += q.ad; b2 += q.b2; bc += q.bc; bd += q.bd;
+			c2 += q.c2; cd += q.cd; d2 += q.d2; weight += q.weight;
+		}
+
+		double evaluate(const glm::dvec3& p) const
+		{
+			double x = p.x, y = p.y, z = p.z;
+			return a2 * x * x + 2.0 * ab * x * y + 2.0 * ac * x * z + 2.0 * ad * x
+			     + b2 * y * y + 2.0 * bc * y * z + 2.0 * bd * y
+			     + c2 * z * z + 2.0 * cd * z + d2;
+		}
+	};
+
+
+	// half edge collapse candidate (from -> to), ordered for a min heap
+	struct CollapseT
+	{
+		float  error;
+		GLuint from, to;
+		unsigned int fromVersion, toVersion;
+
+		bool operator<(const CollapseT& c) const { return error > c.error; }
+	};
+
+
+	// boundary edges are constrained with a perpendicular plane of this relative weight
+	const double BOUNDARY_WEIGHT = 10.0;
+
+	// collapses turning a triangle normal by more than ~75 degrees are rejected
+	const double MIN_NORMAL_COSINE = 0.25;
+
+
+	class Simplifier
+	{
+	public:
+		vector<glm::dvec3>        positions;
+		vector<GLuint>            triangles;
+		vector<char>              triangleAlive;
+		vector<vector<GLuint> >   vertexTriangles;
+		vector<QuadricT>          quadrics;
+		vector<unsigned int>      versions;
+		priority_queue<CollapseT> heap;
+		GLsizei                   liveTriangles;
+
+		void init(const Mesh& mesh);
+		bool collapseNext(float& error);
+		void snapshot(vector<GLuint>& indices) const;
+
+	private:
+		float getError(GLuint from, GLuint to) const;
+		void  pushEdge(GLuint a, GLuint b);
+		void  getNeighbors(GLuint v, vector<GLuint>& neighbors) const;
+		bool  isValid(GLuint from, GLuint to) const;
+	};
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: Simplifier::init()
+// purpose:  Accumulates the area weighted face quadrics and boundary constraints per vertex and
+//           queues all edges as collapse candidates.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void Simplifier::init(const Mesh& mesh)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t vertexCount = mesh.positions.size();
+	size_t triangleCount = mesh.indices.size() / 3;
+
+	positions.resize(vertexCount);
+	for (size_t i = 0; i < vertexCount; ++i) positions[i] = glm::dvec3(mesh.positions[i]);
+
+	triangles = mesh.indices;
+	triangles.resize(triangleCount * 3);
+	triangleAlive.assign(triangleCount, 1);
+	vertexTriangles.assign(vertexCount, vector<GLuint>());
+	quadrics.assign(vertexCount, QuadricT());
+	versions.assign(vertexCount, 0);
+	liveTriangles = GLsizei(triangleCount);
+
+	// face quadrics and edge list (key: vertex pair, value: triangle)
+	vector<pair<unsigned long long, GLuint> > edges;
+	edges.reserve(triangleCount * 3);
+	for (GLuint t = 0; t < triangleCount; ++t)
+	{
+		const GLuint* v = &triangles[3 * t];
+		glm::dvec3 n = glm::cross(positions[v[1]] - positions[v[0]], positions[v[2]] - positions[v[0]]);
+		double length = glm::length(n);
+		if (length > 0.0)
+		{
+			n /= length;
+			QuadricT q;
+			q.addPlane(n, -glm::dot(n, positions[v[0]]), 0.5 * length);
+			for (int k = 0; k < 3; ++k) quadrics[v[k]].add(q);
+		}
+
+		for (int k = 0; k < 3; ++k)
+		{
+			vertexTriangles[v[k]].push_back(t);
+			GLuint a = min(v[k], v[(k + 1) % 3]), b = max(v[k], v[(k + 1) % 3]);
+			edges.push_back(make_pair((unsigned long long)(a) << 32 | b, t));
+		}
+	}
+	sort(edges.begin(), edges.end());
+
+	for (size_t i = 0; i < edges.size(); )
+	{
+		size_t j = i + 1;
+		while (j < edges.size() && edges[j].first == edges[i].first) ++j;
+
+		GLuint a = GLuint(edges[i].first >> 32), b = GLuint(edges[i].first & 0xffffffffu);
+		if (j - i == 1)
+		{
+			// boundary edge: add a plane through the edge perpendicular to its face
+			const GLuint* v = &triangles[3 * edges[i].second];
+			glm::dvec3 e = positions[b] - positions[a];
+			glm::dvec3 n = glm::cross(positions[v[1]] - positions[v[0]], positions[v[2]] - positions[v[0]]);
+			glm::dvec3 p = glm::cross(e, n);
+			double length = glm::length(p);
+			if (length > 0.0)
+			{
+				p /= length;
+				QuadricT q;
+				q.addPlane(p, -glm::dot(p, positions[a]), BOUNDARY_WEIGHT * glm::dot(e, e));
+				quadrics[a].add(q);
+				quadrics[b].add(q);
+			}
+		}
+		if (a != b) pushEdge(a, b);
+		i = j;
+	}
+}
+// Simplifier::init() /////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: Simplifier::getError()
+// purpose:  Returns the root mean square distance of the collapse target to the accumulated
+//           planes of both vertices (in model units).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float Simplifier::getError(GLuint from, GLuint to) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	QuadricT q = quadrics[from];
+	q.add(quadrics[to]);
+	double e = q.evaluate(positions[to]);
+	return float(sqrt(max(e, 0.0) / max(q.weight, 1.0e-30)));
+}
+// Simplifier::getError() /////////////////////////////////////////////////////////////////////////
+
+
+
+void Simplifier::pushEdge(GLuint a, GLuint b)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	CollapseT c;
+	float eab = getError(a, b);
+	float eba = getError(b, a);
+	c.from = (eab <= eba) ? a : b;
+	c.to   = (eab <= eba) ? b : a;
+	c.error = min(eab, eba);
+	c.fromVersion = versions[c.from];
+	c.toVersion = versions[c.to];
+	heap.push(c);
+}
+// Simplifier::pushEdge() /////////////////////////////////////////////////////////////////////////
+
+
+
+void Simplifier::getNeighbors(GLuint v, vector<GLuint>& neighbors) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	neighbors.clear();
+	for (size_t i = 0; i < vertexTriangles[v].size(); ++i)
+	{
+		GLuint t = vertexTriangles[v][i];
+		if (!triangleAlive[t]) continue;
+		for (int k = 0; k < 3; ++k)
+		{
+			GLuint n = triangles[3 * t + k];
+			if (n != v && find(neighbors.begin(), neighbors.end(), n) == neighbors.end())
+				neighbors.push_back(n);
+		}
+	}
+}
+// Simplifier::getNeighbors() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: Simplifier::isValid()
+// purpose:  Checks the link condition (keeps the surface manifold) and rejects collapses that
+//           flip or strongly fold any of the remaining triangles around the removed vertex.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool Simplifier::isValid(GLuint from, GLuint to) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<GLuint> a, b;
+	getNeighbors(from, a);
+	getNeighbors(to, b);
+
+	int shared = 0;
+	for (size_t i = 0; i < a.size(); ++i)
+		if (find(b.begin(), b.end(), a[i]) != b.end()) ++shared;
+	if (shared > 2) return false;
+
+	for (size_t i = 0; i < vertexTriangles[from].size(); ++i)
+	{
+		GLuint t = vertexTriangles[from][i];
+		if (!triangleAlive[t]) continue;
+
+		const GLuint* v = &triangles[3 * t];
+		if (v[0] == to || v[1] == to || v[2] == to) continue; // removed by the collapse
+
+		glm::dvec3 p[3], q[3];
+		for (int k = 0; k < 3; ++k)
+		{
+			p[k] = positions[v[k]];
+			q[k] = (v[k] == from) ? positions[to] : p[k];
+		}
+		glm::dvec3 n0 = glm::cross(p[1] - p[0], p[2] - p[0]);
+		glm::dvec3 n1 = glm::cross(q[1] - q[0], q[2] - q[0]);
+		double l0 = glm::length(n0), l1 = glm::length(n1);
+		if (l1 <= 0.0 || glm::dot(n0, n1) < MIN_NORMAL_COSINE * l0 * l1) return false;
+	}
+	return true;
+}
+// Simplifier::isValid() //////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: Simplifier::collapseNext()
+// purpose:  Performs the cheapest valid half edge collapse. Returns false if no candidate is
+//           left, otherwise error holds the error of the performed collapse.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool Simplifier::collapseNext(float& error)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<GLuint> neighbors;
+
+	while (!heap.empty())
+	{
+		CollapseT c = heap.top();
+		heap.pop();
+
+		// skip candidates whose vertices changed after they were queued
+		if (versions[c.from] != c.fromVersion || versions[c.to] != c.toVersion) continue;
+		if (!isValid(c.from, c.to)) continue;
+
+		quadrics[c.to].add(quadrics[c.from]);
+
+		vector<GLuint>& moved = vertexTriangles[c.from];
+		vector<GLuint>& kept = vertexTriangles[c.to];
+		for (size_t i = 0; i < moved.size(); ++i)
+		{
+			GLuint t = moved[i];
+			if (!triangleAlive[t]) continue;
+
+			GLuint* v = &triangles[3 * t];
+			if (v[0] == c.to || v[1] == c.to || v[2] == c.to)
+			{
+				triangleAlive[t] = 0;
+				--liveTriangles;
+			}
+			else
+			{
+				for (int k = 0; k < 3; ++k) if (v[k] == c.from) v[k] = c.to;
+				kept.push_back(t);
+			}
+		}
+		vector<GLuint>().swap(moved);
+
+		// drop dead triangles and re-queue the edges around the surviving vertex
+		size_t n = 0;
+		for (size_t i = 0; i < kept.size(); ++i) if (triangleAlive[kept[i]]) kept[n++] = kept[i];
+		kept.resize(n);
+
+		versions[c.from]++;
+		versions[c.to]++;
+		getNeighbors(c.to, neighbors);
+		for (size_t i = 0; i < neighbors.size(); ++i) pushEdge(c.to, neighbors[i]);
+
+		error = c.error;
+		return true;
+	}
+	return false;
+}
+// Simplifier::collapseNext() /////////////////////////////////////////////////////////////////////
+
+
+
+void Simplifier::snapshot(vector<GLuint>& indices) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (size_t t = 0; t < triangleAlive.size(); ++t)
+	{
+		if (!triangleAlive[t]) continue;
+		indices.push_back(triangles[3 * t + 0]);
+		indices.push_back(triangles[3 * t + 1]);
+		indices.push_back(triangles[3 * t + 2]);
+	}
+}
+// Simplifier::snapshot() /////////////////////////////////////////////////////////////////////////
+
+
+
+MeshLOD::MeshLOD(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Center(0.0f), _Radius(0.0f), _VAO(0), _VBO(0), _IBO(0)
+{
+}
+// MeshLOD::MeshLOD() /////////////////////////////////////////////////////////////////////////////
+
+
+
+MeshLOD::~MeshLOD(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// MeshLOD::~MeshLOD() ////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: build()
+// purpose:  Builds the LOD chain. A new level is recorded whenever the triangle count dropped
+//           by the reduction factor, until fewer than minTriangles remain, maxLevels levels
+//           exist or no valid collapse is left.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void MeshLOD::build(const Mesh& mesh, float reduction, GLsizei minTriangles, int maxLevels)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Levels.clear();
+	_Indices.clear();
+
+	glm::vec3 minimum, maximum;
+	mesh.getBounds(minimum, maximum);
+	_Center = 0.5f * (minimum + maximum);
+	_Radius = 0.5f * glm::length(maximum - minimum);
+
+	// level 0 is the original mesh
+	LevelT level = { 0, GLsizei(mesh.indices.size() / 3 * 3), 0, 0.0f };
+	_Indices.assign(mesh.indices.begin(), mesh.indices.begin() + level.indexCount);
+	_Levels.push_back(level);
+
+	Simplifier simplifier;
+	simplifier.init(mesh);
+
+	float maxError = 0.0f;
+	double target = reduction * simplifier.liveTriangles;
+	while (int(_Levels.size()) < maxLevels && target >= minTriangles)
+	{
+		float error = 0.0f;
+		bool collapsed = simplifier.collapseNext(error);
+		maxError = max(maxError, error);
+
+		if (simplifier.liveTriangles <= target || !collapsed)
+		{
+			// skip the last snapshot if it hardly differs from the previous level
+			if (collapsed || simplifier.liveTriangles * 3 < 0.9 * _Levels.back().indexCount)
+			{
+				level.firstIndex = GLuint(_Indices.size());
+				simplifier.snapshot(_Indices);
+				level.indexCount = GLsizei(_Indices.size() - level.firstIndex);
+				level.error = maxError;
+				_Levels.push_back(level);
+			}
+			if (!collapsed) break;
+			target = reduction * simplifier.liveTriangles;
+		}
+	}
+
+	// sort vertices by the coarsest level using them, so each level references a vertex prefix
+	vector<int> coarsest(mesh.positions.size(), -1);
+	for (size_t l = 0; l < _Levels.size(); ++l)
+	{
+		for (GLsizei i = 0; i < _Levels[l].indexCount; ++i)
+		{
+			coarsest[_Indices[_Levels[l].firstIndex + i]] = int(l);
+		}
+	}
+
+	vector<GLuint> order(mesh.positions.size());
+	for (size_t i = 0; i < order.size(); ++i) order[i] = GLuint(i);
+	stable_sort(order.begin(), order.end(), [&coarsest](GLuint a, GLuint b) { return coarsest[a] > coarsest[b]; });
+
+	vector<GLuint> remap(order.size());
+	_Positions.resize(order.size());
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		remap[order[i]] = GLuint(i);
+		_Positions[i] = mesh.positions[order[i]];
+	}
+	for (size_t i = 0; i < _Indices.size(); ++i) _Indices[i] = remap[_Indices[i]];
+
+	for (size_t l = 0; l < _Levels.size(); ++l)
+	{
+		GLsizei count = 0;
+		while (count < GLsizei(order.size()) && coarsest[order[count]] >= int(l)) ++count;
+		_Levels[l].vertexCount = count;
+
+		cout << "Mesh LOD " << l << ": " << _Levels[l].indexCount / 3 << " triangles, "
+			<< _Levels[l].vertexCount << " vertices, error " << _Levels[l].error << endl;
+	}
+}
+// MeshLOD::build() ///////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: upload()
+// purpose:  Creates the vertex array, the shared vertex buffer and the packed index buffer.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void MeshLOD::upload(GLuint positionLocation)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+
+	glGenVertexArrays(1, &_VAO);
+	StateTracker::bindVertexArray(_VAO);
+
+	glGenBuffers(1, &_VBO);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, _VBO);
+	glBufferData(GL_ARRAY_BUFFER, _Positions.size() * sizeof(glm::vec3), &_Positions[0], GL_STATIC_DRAW);
+	glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glEnableVertexAttribArray(positionLocation);
+
+	glGenBuffers(1, &_IBO);
+	StateTracker::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _IBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, _Indices.size() * sizeof(GLuint), &_Indices[0], GL_STATIC_DRAW);
+}
+// MeshLOD::upload() //////////////////////////////////////////////////////////////////////////////
+
+
+
+void MeshLOD::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_IBO) StateTracker::deleteBuffers(1, &_IBO);
+	if (_VBO) StateTracker::deleteBuffers(1, &_VBO);
+	if (_VAO) StateTracker::deleteVertexArrays(1, &_VAO);
+	_IBO = _VBO = _VAO = 0;
+}
+// MeshLOD::release() /////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getPixelsPerUnit()
+// purpose:  Returns the number of pixels covered by one model unit at the point of the bounding
+//           sphere closest to the viewer (zero if the viewer is inside the bounding sphere).
+//           scale returns the largest scale factor of the model view matrix.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float MeshLOD::getPixelsPerUnit(const glm::mat4& modelView, const glm::mat4& projection,
+	float viewportHeight, float& scale) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	scale = max(glm::length(glm::vec3(modelView[0])),
+		max(glm::length(glm::vec3(modelView[1])), glm::length(glm::vec3(modelView[2]))));
+
+	// clip space w of the closest point (w = 1 for orthographic, w = -z for perspective projection)
+	glm::vec4 center = modelView * glm::vec4(_Center, 1.0f);
+	float z = center.z + _Radius * scale;
+	float w = projection[2][3] * z + projection[3][3];
+	if (w <= 1.0e-6f) return 0.0f;
+
+	return 0.5f * viewportHeight * projection[1][1] / w;
+}
+// MeshLOD::getPixelsPerUnit() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getProjectedError()
+// purpose:  Returns the screen-space error of a level in pixels.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float MeshLOD::getProjectedError(int level, const glm::mat4& modelView, const glm::mat4& projection,
+	float viewportHeight) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	float scale;
+	float pixelsPerUnit = getPixelsPerUnit(modelView, projection, viewportHeight, scale);
+	if (pixelsPerUnit <= 0.0f) return level > 0 ? FLT_MAX : 0.0f;
+
+	return _Levels[level].error * scale * pixelsPerUnit;
+}
+// MeshLOD::getProjectedError() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: selectLevel()
+// purpose:  Returns the coarsest level whose projected error does not exceed pixelError.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+int MeshLOD::selectLevel(const glm::mat4& modelView, const glm::mat4& projection,
+	float viewportHeight, float pixelError) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	float scale;
+	float pixelsPerUnit = getPixelsPerUnit(modelView, projection, viewportHeight, scale);
+	if (pixelsPerUnit <= 0.0f) return 0;
+
+	for (int level = int(_Levels.size()) - 1; level > 0; --level)
+	{
+		if (_Levels[level].error * scale * pixelsPerUnit <= pixelError) return level;
+	}
+	return 0;
+}
+// MeshLOD::selectLevel() /////////////////////////////////////////////////////////////////////////
+
+
+
+void MeshLOD::draw(int level) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const LevelT& l = _Levels[level];
+
+	StateTracker::bindVertexArray(_VAO);
+	glDrawRangeElements(GL_TRIANGLES, 0, l.vertexCount - 1, l.indexCount, GL_UNSIGNED_INT,
+		BUFFER_OFFSET(l.firstIndex * sizeof(GLuint)));
+}
+// MeshLOD::draw() ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,833 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   NoiseField.cpp
+//
+//  \brief      Batched Perlin and simplex noise with fBm and ridged octaves, SSE2, AVX2 and
+//              AVX-512 kernels selected at runtime and rows generated by worker threads.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <cmath>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+#include <glm/gtc/noise.hpp>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/NoiseField.h"
+
+
+
+// kernels evaluate the octave sum for count positions (structure of arrays) //////////////////////
+// The SIMD noise functions repeat glm::perlin() and glm::simplex() (glm/gtc/noise.inl) lane by
+// lane: one sample per lane, the vec4 components of GLM (cube or simplex corners) unrolled.
+namespace
+{
+	typedef void (*KernelT)(const NoiseField::ParametersT& p, const float* x, const float* y,
+		const float* z, float* out, size_t count);
+
+	// constants of glm::perlin() and glm::simplex()
+	const float SEVENTH = float(1.0 / 7.0);
+	const float C_X = float(1.0 / 6.0);
+	const float C_Y = float(1.0 / 3.0);
+	const float N_ = 0.142857142857f;
+	const float NS_X = N_ * 2.0f - 0.0f;
+	const float NS_Y = N_ * 0.5f - 1.0f;
+	const float NS_Z = N_ * 1.0f - 0.0f;
+	const float INV_SQRT_A = 1.79284291400159f;   // taylorInvSqrt(r) = a - b * r
+	const float INV_SQRT_B = 0.85373472095314f;
+
+
+	// scalar reference kernel ////////////////////////////////////////////////////////////////////
+	void fractalScalar(const NoiseField::ParametersT& p, const float* x, const float* y,
+		const float* z, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			out[i] = NoiseField::sample(p, glm::vec3(x[i], y[i], z[i]));
+		}
+	}
+
+#if CG_SIMD_X86
+
+	// SSE2 kernel: 4 samples per register ////////////////////////////////////////////////////////
+	inline __m128 floorSSE2(__m128 x)
+	{
+		// truncation rounds negative fractions up, valid for |x| < 2^31
+		__m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+		return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, x), _mm_set1_ps(1.0f)));
+	}
+
+	inline __m128 absSSE2(__m128 x)
+	{
+		return _mm_and_ps(x, _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff)));
+	}
+
+	// step(edge, x) = x < edge ? 0 : 1
+	inline __m128 stepSSE2(__m128 edge, __m128 x)
+	{
+		return _mm_andnot_ps(_mm_cmplt_ps(x, edge), _mm_set1_ps(1.0f));
+	}
+
+	inline __m128 mod289SSE2(__m128 x)
+	{
+		const __m128 k = _mm_set1_ps(289.0f);
+		return _mm_sub_ps(x, _mm_mul_ps(floorSSE2(_mm_div_ps(x, k)), k));
+	}
+
+	inline __m128 permuteSSE2(__m128 x)
+	{
+		__m128 t = _mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(34.0f)), _mm_set1_ps(1.0f));
+		return mod289SSE2(_mm_mul_ps(t, x));
+	}
+
+	inline __m128 dotSSE2(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+	}
+
+	inline __m128 invSqrtSSE2(__m128 r)
+	{
+		return _mm_sub_ps(_mm_set1_ps(INV_SQRT_A), _mm_mul_ps(_mm_set1_ps(INV_SQRT_B), r));
+	}
+
+	inline __m128 fadeSSE2(__m128 t)
+	{
+		__m128 s = _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f));
+		s = _mm_add_ps(_mm_mul_ps(t, s), _mm_set1_ps(10.0f));
+		return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), s);
+	}
+
+	inline __m128 mixSSE2(__m128 a, __m128 b, __m128 t)
+	{
+		return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+	}
+
+	// gradient of the cube corner hash h dotted with the offset f from that corner
+	inline __m128 perlinCornerSSE2(__m128 h, __m128 fx, __m128 fy, __m128 fz)
+	{
+		const __m128 zero = _mm_setzero_ps(), half = _mm_set1_ps(0.5f);
+		__m128 gx = _mm_mul_ps(h, _mm_set1_ps(SEVENTH));
+		__m128 gy = floorSSE2(gx);
+		gy = _mm_mul_ps(gy, _mm_set1_ps(SEVENTH));
+		gy = _mm_sub_ps(_mm_sub_ps(gy, floorSSE2(gy)), half);
+		gx = _mm_sub_ps(gx, floorSSE2(gx));
+		__m128 gz = _mm_sub_ps(_mm_sub_ps(half, absSSE2(gx)), absSSE2(gy));
+		__m128 sz = stepSSE2(gz, zero);
+		gx = _mm_sub_ps(gx, _mm_mul_ps(sz, _mm_sub_ps(stepSSE2(zero, gx), half)));
+		gy = _mm_sub_ps(gy, _mm_mul_ps(sz, _mm_sub_ps(stepSSE2(zero, gy), half)));
+		__m128 norm = invSqrtSSE2(dotSSE2(gx, gy, gz, gx, gy, gz));
+		gx = _mm_mul_ps(gx, norm);
+		gy = _mm_mul_ps(gy, norm);
+		gz = _mm_mul_ps(gz, norm);
+		return dotSSE2(gx, gy, gz, fx, fy, fz);
+	}
+
+	inline __m128 perlinSSE2(__m128 x, __m128 y, __m128 z)
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+		__m128 ix0 = floorSSE2(x), iy0 = floorSSE2(y), iz0 = floorSSE2(z);
+		__m128 fx0 = _mm_sub_ps(x, ix0), fy0 = _mm_sub_ps(y, iy0), fz0 = _mm_sub_ps(z, iz0);
+		__m128 fx1 = _mm_sub_ps(fx0, one), fy1 = _mm_sub_ps(fy0, one), fz1 = _mm_sub_ps(fz0, one);
+		__m128 ix1 = mod289SSE2(_mm_add_ps(ix0, one)), iy1 = mod289SSE2(_mm_add_ps(iy0, one));
+		__m128 iz1 = mod289SSE2(_mm_add_ps(iz0, one));
+		ix0 = mod289SSE2(ix0);
+		iy0 = mod289SSE2(iy0);
+		iz0 = mod289SSE2(iz0);
+
+		// hashes of the cube edges along z, then of the 8 corners
+		__m128 px0 = permuteSSE2(ix0), px1 = permuteSSE2(ix1);
+		__m128 h00 = permuteSSE2(_mm_add_ps(px0, iy0)), h10 = permuteSSE2(_mm_add_ps(px1, iy0));
+		__m128 h01 = permuteSSE2(_mm_add_ps(px0, iy1)), h11 = permuteSSE2(_mm_add_ps(px1, iy1));
+		__m128 n000 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h00, iz0)), fx0, fy0, fz0);
+		__m128 n100 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h10, iz0)), fx1, fy0, fz0);
+		__m128 n010 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h01, iz0)), fx0, fy1, fz0);
+		__m128 n110 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h11, iz0)), fx1, fy1, fz0);
+		__m128 n001 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h00, iz1)), fx0, fy0, fz1);
+		__m128 n101 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h10, iz1)), fx1, fy0, fz1);
+		__m128 n011 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h01, iz1)), fx0, fy1, fz1);
+		__m128 n111 = perlinCornerSSE2(permuteSSE2(_mm_add_ps(h11, iz1)), fx1, fy1, fz1);
+
+		__m128 wx = fadeSSE2(fx0), wy = fadeSSE2(fy0), wz = fadeSSE2(fz0);
+		__m128 n00 = mixSSE2(n000, n001, wz), n10 = mixSSE2(n100, n101, wz);
+		__m128 n01 = mixSSE2(n010, n011, wz), n11 = mixSSE2(n110, n111, wz);
+		__m128 n0 = mixSSE2(n00, n01, wy), n1 = mixSSE2(n10, n11, wy);
+		return _mm_mul_ps(_mm_set1_ps(2.2f), mixSSE2(n0, n1, wx));
+	}
+
+	inline __m128 simplexHashSSE2(__m128 ix, __m128 iy, __m128 iz, __m128 ox, __m128 oy, __m128 oz)
+	{
+		__m128 h = permuteSSE2(_mm_add_ps(iz, oz));
+		h = permuteSSE2(_mm_add_ps(_mm_add_ps(h, iy), oy));
+		return permuteSSE2(_mm_add_ps(_mm_add_ps(h, ix), ox));
+	}
+
+	// falloff weighted gradient of the simplex corner hash h at the offset (x, y, z)
+	inline __m128 simplexCornerSSE2(__m128 h, __m128 x, __m128 y, __m128 z)
+	{
+		const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), two = _mm_set1_ps(2.0f);
+		const __m128 nsx = _mm_set1_ps(NS_X), nsy = _mm_set1_ps(NS_Y), nsz = _mm_set1_ps(NS_Z);
+		__m128 j = floorSSE2(_mm_mul_ps(_mm_mul_ps(h, nsz), nsz));
+		j = _mm_sub_ps(h, _mm_mul_ps(_mm_set1_ps(49.0f), j));
+		__m128 qx = floorSSE2(_mm_mul_ps(j, nsz));
+		__m128 qy = floorSSE2(_mm_sub_ps(j, _mm_mul_ps(_mm_set1_ps(7.0f), qx)));
+		__m128 gx = _mm_add_ps(_mm_mul_ps(qx, nsx), nsy), gy = _mm_add_ps(_mm_mul_ps(qy, nsx), nsy);
+		__m128 gz = _mm_sub_ps(_mm_sub_ps(one, absSSE2(gx)), absSSE2(gy));
+		__m128 sh = _mm_sub_ps(zero, stepSSE2(gz, zero));
+		gx = _mm_add_ps(gx, _mm_mul_ps(_mm_add_ps(_mm_mul_ps(floorSSE2(gx), two), one), sh));
+		gy = _mm_add_ps(gy, _mm_mul_ps(_mm_add_ps(_mm_mul_ps(floorSSE2(gy), two), one), sh));
+		__m128 norm = invSqrtSSE2(dotSSE2(gx, gy, gz, gx, gy, gz));
+		gx = _mm_mul_ps(gx, norm);
+		gy = _mm_mul_ps(gy, norm);
+		gz = _mm_mul_ps(gz, norm);
+
+		__m128 m = _mm_max_ps(_mm_sub_ps(_mm_set1_ps(0.6f), dotSSE2(x, y, z, x, y, z)), zero);
+		m = _mm_mul_ps(m, m);
+		return _mm_mul_ps(_mm_mul_ps(m, m), dotSSE2(gx, gy, gz, x, y, z));
+	}
+
+	inline __m128 simplexSSE2(__m128 x, __m128 y, __m128 z)
+	{
+		const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+		const __m128 cx = _mm_set1_ps(C_X), cy = _mm_set1_ps(C_Y);
+
+		// first corner and offset of the skewed cell
+		__m128 s = dotSSE2(x, y, z, cy, cy, cy);
+		__m128 ix = floorSSE2(_mm_add_ps(x, s)), iy = floorSSE2(_mm_add_ps(y, s));
+		__m128 iz = floorSSE2(_mm_add_ps(z, s));
+		__m128 t = dotSSE2(ix, iy, iz, cx, cx, cx);
+		__m128 x0 = _mm_add_ps(_mm_sub_ps(x, ix), t), y0 = _mm_add_ps(_mm_sub_ps(y, iy), t);
+		__m128 z0 = _mm_add_ps(_mm_sub_ps(z, iz), t);
+
+		// the other corners of the simplex
+		__m128 gx = stepSSE2(y0, x0), gy = stepSSE2(z0, y0), gz = stepSSE2(x0, z0);
+		__m128 lx = _mm_sub_ps(one, gx), ly = _mm_sub_ps(one, gy), lz = _mm_sub_ps(one, gz);
+		__m128 i1x = _mm_min_ps(gx, lz), i1y = _mm_min_ps(gy, lx), i1z = _mm_min_ps(gz, ly);
+		__m128 i2x = _mm_max_ps(gx, lz), i2y = _mm_max_ps(gy, lx), i2z = _mm_max_ps(gz, ly);
+		__m128 x1 = _mm_add_ps(_mm_sub_ps(x0, i1x), cx), y1 = _mm_add_ps(_mm_sub_ps(y0, i1y), cx);
+		__m128 z1 = _mm_add_ps(_mm_sub_ps(z0, i1z), cx);
+		__m128 x2 = _mm_add_ps(_mm_sub_ps(x0, i2x), cy), y2 = _mm_add_ps(_mm_sub_ps(y0, i2y), cy);
+		__m128 z2 = _mm_add_ps(_mm_sub_ps(z0, i2z), cy);
+		const __m128 half = _mm_set1_ps(0.5f);
+		__m128 x3 = _mm_sub_ps(x0, half), y3 = _mm_sub_ps(y0, half), z3 = _mm_sub_ps(z0, half);
+
+		ix = mod289SSE2(ix);
+		iy = mod289SSE2(iy);
+		iz = mod289SSE2(iz);
+		__m128 n0 = simplexCornerSSE2(simplexHashSSE2(ix, iy, iz, zero, zero, zero), x0, y0, z0);
+		__m128 n1 = simplexCornerSSE2(simplexHashSSE2(ix, iy, iz, i1x, i1y, i1z), x1, y1, z1);
+		__m128 n2 = simplexCornerSSE2(simplexHashSSE2(ix, iy, iz, i2x, i2y, i2z), x2, y2, z2);
+		__m128 n3 = simplexCornerSSE2(simplexHashSSE2(ix, iy, iz, one, one, one), x3, y3, z3);
+		return _mm_mul_ps(_mm_set1_ps(42.0f), _mm_add_ps(_mm_add_ps(n0, n1), _mm_add_ps(n2, n3)));
+	}
+
+	void fractalSSE2(const NoiseField::ParametersT& p, const float* x, const float* y,
+		const float* z, float* out, size_t count)
+	{
+		bool simplex = (p.noise == NoiseField::NOISE_SIMPLEX);
+		bool ridged = (p.fractal == NoiseField::FRACTAL_RIDGED);
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 ox = _mm_set1_ps(p.offset.x), oy = _mm_set1_ps(p.offset.y);
+		const __m128 oz = _mm_set1_ps(p.offset.z);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 qx = _mm_add_ps(_mm_loadu_ps(x + i), ox), qy = _mm_add_ps(_mm_loadu_ps(y + i), oy);
+			__m128 qz = _mm_add_ps(_mm_loadu_ps(z + i), oz);
+			__m128 sum = _mm_setzero_ps();
+			float frequency = p.frequency, amplitude = 1.0f;
+			for (int o = 0; o < p.octaves; ++o)
+			{
+				__m128 f = _mm_set1_ps(frequency);
+				__m128 sx = _mm_mul_ps(qx, f), sy = _mm_mul_ps(qy, f), sz = _mm_mul_ps(qz, f);
+				__m128 n = simplex ? simplexSSE2(sx, sy, sz) : perlinSSE2(sx, sy, sz);
+				if (ridged)
+				{
+					n = _mm_sub_ps(one, absSSE2(n));
+					n = _mm_mul_ps(n, n);
+				}
+				sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set1_ps(amplitude), n));
+				frequency *= p.lacunarity;
+				amplitude *= p.gain;
+			}
+			_mm_storeu_ps(out + i, sum);
+		}
+		fractalScalar(p, x + i, y + i, z + i, out + i, count - i);
+	}
+
+
+	// AVX2 kernel: 8 samples per register ////////////////////////////////////////////////////////
+	CG_TARGET_AVX2 inline __m256 absAVX2(__m256 x)
+	{
+		return _mm256_and_ps(x, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+	}
+
+	CG_TARGET_AVX2 inline __m256 stepAVX2(__m256 edge, __m256 x)
+	{
+		return _mm256_andnot_ps(_mm256_cmp_ps(x, edge, _CMP_LT_OQ), _mm256_set1_ps(1.0f));
+	}
+
+	CG_TARGET_AVX2 inline __m256 mod289AVX2(__m256 x)
+	{
+		const __m256 k = _mm256_set1_ps(289.0f);
+		return _mm256_sub_ps(x, _mm256_mul_ps(_mm256_floor_ps(_mm256_div_ps(x, k)), k));
+	}
+
+	CG_TARGET_AVX2 inline __m256 permuteAVX2(__m256 x)
+	{
+		__m256 t = _mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(34.0f)), _mm256_set1_ps(1.0f));
+		return mod289AVX2(_mm256_mul_ps(t, x));
+	}
+
+	CG_TARGET_AVX2 inline __m256 dotAVX2(__m256 ax, __m256 ay, __m256 az, __m256 bx, __m256 by,
+		__m256 bz)
+	{
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)),
+			_mm256_mul_ps(az, bz));
+	}
+
+	CG_TARGET_AVX2 inline __m256 invSqrtAVX2(__m256 r)
+	{
+		return _mm256_sub_ps(_mm256_set1_ps(INV_SQRT_A), _mm256_mul_ps(_mm256_set1_ps(INV_SQRT_B), r));
+	}
+
+	CG_TARGET_AVX2 inline __m256 fadeAVX2(__m256 t)
+	{
+		__m256 s = _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f));
+		s = _mm256_add_ps(_mm256_mul_ps(t, s), _mm256_set1_ps(10.0f));
+		return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), s);
+	}
+
+	CG_TARGET_AVX2 inline __m256 mixAVX2(__m256 a, __m256 b, __m256 t)
+	{
+		return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+	}
+
+	CG_TARGET_AVX2 inline __m256 perlinCornerAVX2(__m256 h, __m256 fx, __m256 fy, __m256 fz)
+	{
+		const __m256 zero = _mm256_setzero_ps(), half = _mm256_set1_ps(0.5f);
+		__m256 gx = _mm256_mul_ps(h, _mm256_set1_ps(SEVENTH));
+		__m256 gy = _mm256_mul_ps(_mm256_floor_ps(gx), _mm256_set1_ps(SEVENTH));
+		gy = _mm256_sub_ps(_mm256_sub_ps(gy, _mm256_floor_ps(gy)), half);
+		gx = _mm256_sub_ps(gx, _mm256_floor_ps(gx));
+		__m256 gz = _mm256_sub_ps(_mm256_sub_ps(half, absAVX2(gx)), absAVX2(gy));
+		__m256 sz = stepAVX2(gz, zero);
+		gx = _mm256_sub_ps(gx, _mm256_mul_ps(sz, _mm256_sub_ps(stepAVX2(zero, gx), half)));
+		gy = _mm256_sub_ps(gy, _mm256_mul_ps(sz, _mm256_sub_ps(stepAVX2(zero, gy), half)));
+		__m256 norm = invSqrtAVX2(dotAVX2(gx, gy, gz, gx, gy, gz));
+		gx = _mm256_mul_ps(gx, norm);
+		gy = _mm256_mul_ps(gy, norm);
+		gz = _mm256_mul_ps(gz, norm);
+		return dotAVX2(gx, gy, gz, fx, fy, fz);
+	}
+
+	CG_TARGET_AVX2 inline __m256 perlinAVX2(__m256 x, __m256 y, __m256 z)
+	{
+		const __m256 one = _mm256_set1_ps(1.0f);
+		__m256 ix0 = _mm256_floor_ps(x), iy0 = _mm256_floor_ps(y), iz0 = _mm256_floor_ps(z);
+		__m256 fx0 = _mm256_sub_ps(x, ix0), fy0 = _mm256_sub_ps(y, iy0);
+		__m256 fz0 = _mm256_sub_ps(z, iz0);
+		__m256 fx1 = _mm256_sub_ps(fx0, one), fy1 = _mm256_sub_ps(fy0, one);
+		__m256 fz1 = _mm256_sub_ps(fz0, one);
+		__m256 ix1 = mod289AVX2(_mm256_add_ps(ix0, one)), iy1 = mod289AVX2(_mm256_add_ps(iy0, one));
+		__m256 iz1 = mod289AVX2(_mm256_add_ps(iz0, one));
+		ix0 = mod289AVX2(ix0);
+		iy0 = mod289AVX2(iy0);
+		iz0 = mod289AVX2(iz0);
+
+		__m256 px0 = permuteAVX2(ix0), px1 = permuteAVX2(ix1);
+		__m256 h00 = permuteAVX2(_mm256_add_ps(px0, iy0)), h10 = permuteAVX2(_mm256_add_ps(px1, iy0));
+		__m256 h01 = permuteAVX2(_mm256_add_ps(px0, iy1)), h11 = permuteAVX2(_mm256_add_ps(px1, iy1));
+		__m256 n000 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h00, iz0)), fx0, fy0, fz0);
+		__m256 n100 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h10, iz0)), fx1, fy0, fz0);
+		__m256 n010 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h01, iz0)), fx0, fy1, fz0);
+		__m256 n110 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h11, iz0)), fx1, fy1, fz0);
+		__m256 n001 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h00, iz1)), fx0, fy0, fz1);
+		__m256 n101 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h10, iz1)), fx1, fy0, fz1);
+		__m256 n011 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h01, iz1)), fx0, fy1, fz1);
+		__m256 n111 = perlinCornerAVX2(permuteAVX2(_mm256_add_ps(h11, iz1)), fx1, fy1, fz1);
+
+		__m256 wx = fadeAVX2(fx0), wy = fadeAVX2(fy0), wz = fadeAVX2(fz0);
+		__m256 n00 = mixAVX2(n000, n001, wz), n10 = mixAVX2(n100, n101, wz);
+		__m256 n01 = mixAVX2(n010, n011, wz), n11 = mixAVX2(n110, n111, wz);
+		__m256 n0 = mixAVX2(n00, n01, wy), n1 = mixAVX2(n10, n11, wy);
+		return _mm256_mul_ps(_mm256_set1_ps(2.2f), mixAVX2(n0, n1, wx));
+	}
+
+	CG_TARGET_AVX2 inline __m256 simplexHashAVX2(__m256 ix, __m256 iy, __m256 iz, __m256 ox,
+		__m256 oy, __m256 oz)
+	{
+		__m256 h = permuteAVX2(_mm256_add_ps(iz, oz));
+		h = permuteAVX2(_mm256_add_ps(_mm256_add_ps(h, iy), oy));
+		return permuteAVX2(_mm256_add_ps(_mm256_add_ps(h, ix), ox));
+	}
+
+	CG_TARGET_AVX2 inline __m256 simplexCornerAVX2(__m256 h, __m256 x, __m256 y, __m256 z)
+	{
+		const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+		const __m256 two = _mm256_set1_ps(2.0f);
+		const __m256 nsx = _mm256_set1_ps(NS_X), nsy = _mm256_set1_ps(NS_Y);
+		const __m256 nsz = _mm256_set1_ps(NS_Z);
+		__m256 j = _mm256_floor_ps(_mm256_mul_ps(_mm256_mul_ps(h, nsz), nsz));
+		j = _mm256_sub_ps(h, _mm256_mul_ps(_mm256_set1_ps(49.0f), j));
+		__m256 qx = _mm256_floor_ps(_mm256_mul_ps(j, nsz));
+		__m256 qy = _mm256_floor_ps(_mm256_sub_ps(j, _mm256_mul_ps(_mm256_set1_ps(7.0f), qx)));
+		__m256 gx = _mm256_add_ps(_mm256_mul_ps(qx, nsx), nsy);
+		__m256 gy = _mm256_add_ps(_mm256_mul_ps(qy, nsx), nsy);
+		__m256 gz = _mm256_sub_ps(_mm256_sub_ps(one, absAVX2(gx)), absAVX2(gy));
+		__m256 sh = _mm256_sub_ps(zero, stepAVX2(gz, zero));
+		gx = _mm256_add_ps(gx, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_floor_ps(gx), two),
+			one), sh));
+		gy = _mm256_add_ps(gy, _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_floor_ps(gy), two),
+			one), sh));
+		__m256 norm = invSqrtAVX2(dotAVX2(gx, gy, gz, gx, gy, gz));
+		gx = _mm256_mul_ps(gx, norm);
+		gy = _mm256_mul_ps(gy, norm);
+		gz = _mm256_mul_ps(gz, norm);
+
+		__m256 m = _mm256_sub_ps(_mm256_set1_ps(0.6f), dotAVX2(x, y, z, x, y, z));
+		m = _mm256_max_ps(m, zero);
+		m = _mm256_mul_ps(m, m);
+		return _mm256_mul_ps(_mm256_mul_ps(m, m), dotAVX2(gx, gy, gz, x, y, z));
+	}
+
+	CG_TARGET_AVX2 inline __m256 simplexAVX2(__m256 x, __m256 y, __m256 z)
+	{
+		const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+		const __m256 cx = _mm256_set1_ps(C_X), cy = _mm256_set1_ps(C_Y);
+
+		__m256 s = dotAVX2(x, y, z, cy, cy, cy);
+		__m256 ix = _mm256_floor_ps(_mm256_add_ps(x, s)), iy = _mm256_floor_ps(_mm256_add_ps(y, s));
+		__m256 iz = _mm256_floor_ps(_mm256_add_ps(z, s));
+		__m256 t = dotAVX2(ix, iy, iz, cx, cx, cx);
+		__m256 x0 = _mm256_add_ps(_mm256_sub_ps(x, ix), t), y0 = _mm256_add_ps(_mm256_sub_ps(y, iy), t);
+		__m256 z0 = _mm256_add_ps(_mm256_sub_ps(z, iz), t);
+
+		__m256 gx = stepAVX2(y0, x0), gy = stepAVX2(z0, y0), gz = stepAVX2(x0, z0);
+		__m256 lx = _mm256_sub_ps(one, gx), ly = _mm256_sub_ps(one, gy), lz = _mm256_sub_ps(one, gz);
+		__m256 i1x = _mm256_min_ps(gx, lz), i1y = _mm256_min_ps(gy, lx);
+		__m256 i1z = _mm256_min_ps(gz, ly);
+		__m256 i2x = _mm256_max_ps(gx, lz), i2y = _mm256_max_ps(gy, lx);
+		__m256 i2z = _mm256_max_ps(gz, ly);
+		__m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, i1x), cx);
+		__m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, i1y), cx);
+		__m256 z1 = _mm256_add_ps(_mm256_sub_ps(z0, i1z), cx);
+		__m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, i2x), cy);
+		__m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, i2y), cy);
+		__m256 z2 = _mm256_add_ps(_mm256_sub_ps(z0, i2z), cy);
+		const __m256 half = _mm256_set1_ps(0.5f);
+		__m256 x3 = _mm256_sub_ps(x0, half), y3 = _mm256_sub_ps(y0, half);
+		__m256 z3 = _mm256_sub_ps(z0, half);
+
+		ix = mod289AVX2(ix);
+		iy = mod289AVX2(iy);
+		iz = mod289AVX2(iz);
+		__m256 n0 = simplexCornerAVX2(simplexHashAVX2(ix, iy, iz, zero, zero, zero), x0, y0, z0);
+		__m256 n1 = simplexCornerAVX2(simplexHashAVX2(ix, iy, iz, i1x, i1y, i1z), x1, y1, z1);
+		__m256 n2 = simplexCornerAVX2(simplexHashAVX2(ix, iy, iz, i2x, i2y, i2z), x2, y2, z2);
+		__m256 n3 = simplexCornerAVX2(simplexHashAVX2(ix, iy, iz, one, one, one), x3, y3, z3);
+		return _mm256_mul_ps(_mm256_set1_ps(42.0f),
+			_mm256_add_ps(_mm256_add_ps(n0, n1), _mm256_add_ps(n2, n3)));
+	}
+
+	CG_TARGET_AVX2 void fractalAVX2(const NoiseField::ParametersT& p, const float* x,
+		const float* y, const float* z, float* out, size_t count)
+	{
+		bool simplex = (p.noise == NoiseField::NOISE_SIMPLEX);
+		bool ridged = (p.fractal == NoiseField::FRACTAL_RIDGED);
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 ox = _mm256_set1_ps(p.offset.x), oy = _mm256_set1_ps(p.offset.y);
+		const __m256 oz = _mm256_set1_ps(p.offset.z);
+
+		size_t i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			__m256 qx = _mm256_add_ps(_mm256_loadu_ps(x + i), ox);
+			__m256 qy = _mm256_add_ps(_mm256_loadu_ps(y + i), oy);
+			__m256 qz = _mm256_add_ps(_mm256_loadu_ps(z + i), oz);
+			__m256 sum = _mm256_setzero_ps();
+			float frequency = p.frequency, amplitude = 1.0f;
+			for (int o = 0; o < p.octaves; ++o)
+			{
+				__m256 f = _mm256_set1_ps(frequency);
+				__m256 sx = _mm256_mul_ps(qx, f), sy = _mm256_mul_ps(qy, f), sz = _mm256_mul_ps(qz, f);
+				__m256 n = simplex ? simplexAVX2(sx, sy, sz) : perlinAVX2(sx, sy, sz);
+				if (ridged)
+				{
+					n = _mm256_sub_ps(one, absAVX2(n));
+					n = _mm256_mul_ps(n, n);
+				}
+				sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_set1_ps(amplitude), n));
+				frequency *= p.lacunarity;
+				amplitude *= p.gain;
+			}
+			_mm256_storeu_ps(out + i, sum);
+		}
+		fractalSSE2(p, x + i, y + i, z + i, out + i, count - i);
+	}
+
+
+	// AVX-512 kernel: 16 samples per register, masked tails //////////////////////////////////////
+	CG_TARGET_AVX512 inline __m512 floorAVX512(__m512 x)
+	{
+		return _mm512_roundscale_ps(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	}
+
+	CG_TARGET_AVX512 inline __m512 stepAVX512(__m512 edge, __m512 x)
+	{
+		__mmask16 below = _mm512_cmp_ps_mask(x, edge, _CMP_LT_OQ);
+		return _mm512_mask_blend_ps(below, _mm512_set1_ps(1.0f), _mm512_setzero_ps());
+	}
+
+	CG_TARGET_AVX512 inline __m512 mod289AVX512(__m512 x)
+	{
+		const __m512 k = _mm512_set1_ps(289.0f);
+		return _mm512_sub_ps(x, _mm512_mul_ps(floorAVX512(_mm512_div_ps(x, k)), k));
+	}
+
+	CG_TARGET_AVX512 inline __m512 permuteAVX512(__m512 x)
+	{
+		__m512 t = _mm512_add_ps(_mm512_mul_ps(x, _mm512_set1_ps(34.0f)), _mm512_set1_ps(1.0f));
+		return mod289AVX512(_mm512_mul_ps(t, x));
+	}
+
+	CG_TARGET_AVX512 inline __m512 dotAVX512(__m512 ax, __m512 ay, __m512 az, __m512 bx,
+		__m512 by, __m512 bz)
+	{
+		return _mm512_add_ps(_mm512_add_ps(_mm512_mul_ps(ax, bx), _mm512_mul_ps(ay, by)),
+			_mm512_mul_ps(az, bz));
+	}
+
+	CG_TARGET_AVX512 inline __m512 invSqrtAVX512(__m512 r)
+	{
+		return _mm512_sub_ps(_mm512_set1_ps(INV_SQRT_A), _mm512_mul_ps(_mm512_set1_ps(INV_SQRT_B), r));
+	}
+
+	CG_TARGET_AVX512 inline __m512 fadeAVX512(__m512 t)
+	{
+		__m512 s = _mm512_sub_ps(_mm512_mul_ps(t, _mm512_set1_ps(6.0f)), _mm512_set1_ps(15.0f));
+		s = _mm512_add_ps(_mm512_mul_ps(t, s), _mm512_set1_ps(10.0f));
+		return _mm512_mul_ps(_mm512_mul_ps(_mm512_mul_ps(t, t), t), s);
+	}
+
+	CG_TARGET_AVX512 inline __m512 mixAVX512(__m512 a, __m512 b, __m512 t)
+	{
+		return _mm512_add_ps(a, _mm512_mul_ps(t, _mm512_sub_ps(b, a)));
+	}
+
+	CG_TARGET_AVX512 inline __m512 perlinCornerAVX512(__m512 h, __m512 fx, __m512 fy, __m512 fz)
+	{
+		const __m512 zero = _mm512_setzero_ps(), half = _mm512_set1_ps(0.5f);
+		__m512 gx = _mm512_mul_ps(h, _mm512_set1_ps(SEVENTH));
+		__m512 gy = _mm512_mul_ps(floorAVX512(gx), _mm512_set1_ps(SEVENTH));
+		gy = _mm512_sub_ps(_mm512_sub_ps(gy, floorAVX512(gy)), half);
+		gx = _mm512_sub_ps(gx, floorAVX512(gx));
+		__m512 gz = _mm512_sub_ps(_mm512_sub_ps(half, _mm512_abs_ps(gx)), _mm512_abs_ps(gy));
+		__m512 sz = stepAVX512(gz, zero);
+		gx = _mm512_sub_ps(gx, _mm512_mul_ps(sz, _mm512_sub_ps(stepAVX512(zero, gx), half)));
+		gy = _mm512_sub_ps(gy, _mm512_mul_ps(sz, _mm512_sub_ps(stepAVX512(zero, gy), half)));
+		__m512 norm = invSqrtAVX512(dotAVX512(gx, gy, gz, gx, gy, gz));
+		gx = _mm512_mul_ps(gx, norm);
+		gy = _mm512_mul_ps(gy, norm);
+		gz = _mm512_mul_ps(gz, norm);
+		return dotAVX512(gx, gy, gz, fx, fy, fz);
+	}
+
+	CG_TARGET_AVX512 inline __m512 perlinAVX512(__m512 x, __m512 y, __m512 z)
+	{
+		const __m512 one = _mm512_set1_ps(1.0f);
+		__m512 ix0 = floorAVX512(x), iy0 = floorAVX512(y), iz0 = floorAVX512(z);
+		__m512 fx0 = _mm512_sub_ps(x, ix0), fy0 = _mm512_sub_ps(y, iy0);
+		__m512 fz0 = _mm512_sub_ps(z, iz0);
+		__m512 fx1 = _mm512_sub_ps(fx0, one), fy1 = _mm512_sub_ps(fy0, one);
+		__m512 fz1 = _mm512_sub_ps(fz0, one);
+		__m512 ix1 = mod289AVX512(_mm512_add_ps(ix0, one));
+		__m512 iy1 = mod289AVX512(_mm512_add_ps(iy0, one));
+		__m512 iz1 = mod289AVX512(_mm512_add_ps(iz0, one));
+		ix0 = mod289AVX512(ix0);
+		iy0 = mod289AVX512(iy0);
+		iz0 = mod289AVX512(iz0);
+
+		__m512 px0 = permuteAVX512(ix0), px1 = permuteAVX512(ix1);
+		__m512 h00 = permuteAVX512(_mm512_add_ps(px0, iy0));
+		__m512 h10 = permuteAVX512(_mm512_add_ps(px1, iy0));
+		__m512 h01 = permuteAVX512(_mm512_add_ps(px0, iy1));
+		__m512 h11 = permuteAVX512(_mm512_add_ps(px1, iy1));
+		__m512 n000 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h00, iz0)), fx0, fy0, fz0);
+		__m512 n100 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h10, iz0)), fx1, fy0, fz0);
+		__m512 n010 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h01, iz0)), fx0, fy1, fz0);
+		__m512 n110 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h11, iz0)), fx1, fy1, fz0);
+		__m512 n001 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h00, iz1)), fx0, fy0, fz1);
+		__m512 n101 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h10, iz1)), fx1, fy0, fz1);
+		__m512 n011 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h01, iz1)), fx0, fy1, fz1);
+		__m512 n111 = perlinCornerAVX512(permuteAVX512(_mm512_add_ps(h11, iz1)), fx1, fy1, fz1);
+
+		__m512 wx = fadeAVX512(fx0), wy = fadeAVX512(fy0), wz = fadeAVX512(fz0);
+		__m512 n00 = mixAVX512(n000, n001, wz), n10 = mixAVX512(n100, n101, wz);
+		__m512 n01 = mixAVX512(n010, n011, wz), n11 = mixAVX512(n110, n111, wz);
+		__m512 n0 = mixAVX512(n00, n01, wy), n1 = mixAVX512(n10, n11, wy);
+		return _mm512_mul_ps(_mm512_set1_ps(2.2f), mixAVX512(n0, n1, wx));
+	}
+
+	CG_TARGET_AVX512 inline __m512 simplexHashAVX512(__m512 ix, __m512 iy, __m512 iz, __m512 ox,
+		__m512 oy, __m512 oz)
+	{
+		__m512 h = permuteAVX512(_mm512_add_ps(iz, oz));
+		h = permuteAVX512(_mm512_add_ps(_mm512_add_ps(h, iy), oy));
+		return permuteAVX512(_mm512_add_ps(_mm512_add_ps(h, ix), ox));
+	}
+
+	CG_TARGET_AVX512 inline __m512 simplexCornerAVX512(__m512 h, __m512 x, __m512 y, __m512 z)
+	{
+		const __m512 zero = _mm512_setzero_ps(), one = _mm512_set1_ps(1.0f);
+		const __m512 two = _mm512_set1_ps(2.0f);
+		const __m512 nsx = _mm512_set1_ps(NS_X), nsy = _mm512_set1_ps(NS_Y);
+		const __m512 nsz = _mm512_set1_ps(NS_Z);
+		__m512 j = floorAVX512(_mm512_mul_ps(_mm512_mul_ps(h, nsz), nsz));
+		j = _mm512_sub_ps(h, _mm512_mul_ps(_mm512_set1_ps(49.0f), j));
+		__m512 qx = floorAVX512(_mm512_mul_ps(j, nsz));
+		__m512 qy = floorAVX512(_mm512_sub_ps(j, _mm512_mul_ps(_mm512_set1_ps(7.0f), qx)));
+		__m512 gx = _mm512_add_ps(_mm512_mul_ps(qx, nsx), nsy);
+		__m512 gy = _mm512_add_ps(_mm512_mul_ps(qy, nsx), nsy);
+		__m512 gz = _mm512_sub_ps(_mm512_sub_ps(one, _mm512_abs_ps(gx)), _mm512_abs_ps(gy));
+		__m512 sh = _mm512_sub_ps(zero, stepAVX512(gz, zero));
+		gx = _mm512_add_ps(gx, _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(floorAVX512(gx), two),
+			one), sh));
+		gy = _mm512_add_ps(gy, _mm512_mul_ps(_mm512_add_ps(_mm512_mul_ps(floorAVX512(gy), two),
+			one), sh));
+		__m512 norm = invSqrtAVX512(dotAVX512(gx, gy, gz, gx, gy, gz));
+		gx = _mm512_mul_ps(gx, norm);
+		gy = _mm512_mul_ps(gy, norm);
+		gz = _mm512_mul_ps(gz, norm);
+
+		__m512 m = _mm512_sub_ps(_mm512_set1_ps(0.6f), dotAVX512(x, y, z, x, y, z));
+		m = _mm512_max_ps(m, zero);
+		m = _mm512_mul_ps(m, m);
+		return _mm512_mul_ps(_mm512_mul_ps(m, m), dotAVX512(gx, gy, gz, x, y, z));
+	}
+
+	CG_TARGET_AVX512 inline __m512 simplexAVX512(__m512 x, __m512 y, __m512 z)
+	{
+		const __m512 zero = _mm512_setzero_ps(), one = _mm512_set1_ps(1.0f);
+		const __m512 cx = _mm512_set1_ps(C_X), cy = _mm512_set1_ps(C_Y);
+
+		__m512 s = dotAVX512(x, y, z, cy, cy, cy);
+		__m512 ix = floorAVX512(_mm512_add_ps(x, s)), iy = floorAVX512(_mm512_add_ps(y, s));
+		__m512 iz = floorAVX512(_mm512_add_ps(z, s));
+		__m512 t = dotAVX512(ix, iy, iz, cx, cx, cx);
+		__m512 x0 = _mm512_add_ps(_mm512_sub_ps(x, ix), t), y0 = _mm512_add_ps(_mm512_sub_ps(y, iy), t);
+		__m512 z0 = _mm512_add_ps(_mm512_sub_ps(z, iz), t);
+
+		__m512 gx = stepAVX512(y0, x0), gy = stepAVX512(z0, y0), gz = stepAVX512(x0, z0);
+		__m512 lx = _mm512_sub_ps(one, gx), ly = _mm512_sub_ps(one, gy), lz = _mm512_sub_ps(one, gz);
+		__m512 i1x = _mm512_min_ps(gx, lz), i1y = _mm512_min_ps(gy, lx);
+		__m512 i1z = _mm512_min_ps(gz, ly);
+		__m512 i2x = _mm512_max_ps(gx, lz), i2y = _mm512_max_ps(gy, lx);
+		__m512 i2z = _mm512_max_ps(gz, ly);
+		__m512 x1 = _mm512_add_ps(_mm512_sub_ps(x0, i1x), cx);
+		__m512 y1 = _mm512_add_ps(_mm512_sub_ps(y0, i1y), cx);
+		__m512 z1 = _mm512_add_ps(_mm512_sub_ps(z0, i1z), cx);
+		__m512 x2 = _mm512_add_ps(_mm512_sub_ps(x0, i2x), cy);
+		__m512 y2 = _mm512_add_ps(_mm512_sub_ps(y0, i2y), cy);
+		__m512 z2 = _mm512_add_ps(_mm512_sub_ps(z0, i2z), cy);
+		const __m512 half = _mm512_set1_ps(0.5f);
+		__m512 x3 = _mm512_sub_ps(x0, half), y3 = _mm512_sub_ps(y0, half);
+		__m512 z3 = _mm512_sub_ps(z0, half);
+
+		ix = mod289AVX512(ix);
+		iy = mod289AVX512(iy);
+		iz = mod289AVX512(iz);
+		__m512 n0 = simplexCornerAVX512(simplexHashAVX512(ix, iy, iz, zero, zero, zero), x0, y0, z0);
+		__m512 n1 = simplexCornerAVX512(simplexHashAVX512(ix, iy, iz, i1x, i1y, i1z), x1, y1, z1);
+		__m512 n2 = simplexCornerAVX512(simplexHashAVX512(ix, iy, iz, i2x, i2y, i2z), x2, y2, z2);
+		__m512 n3 = simplexCornerAVX512(simplexHashAVX512(ix, iy, iz, one, one, one), x3, y3, z3);
+		return _mm512_mul_ps(_mm512_set1_ps(42.0f),
+			_mm512_add_ps(_mm512_add_ps(n0, n1), _mm512_add_ps(n2, n3)));
+	}
+
+	CG_TARGET_AVX512 void fractalAVX512(const NoiseField::ParametersT& p, const float* x,
+		const float* y, const float* z, float* out, size_t count)
+	{
+		bool simplex = (p.noise == NoiseField::NOISE_SIMPLEX);
+		bool ridged = (p.fractal == NoiseField::FRACTAL_RIDGED);
+		const __m512 one = _mm512_set1_ps(1.0f);
+		const __m512 ox = _mm512_set1_ps(p.offset.x), oy = _mm512_set1_ps(p.offset.y);
+		const __m512 oz = _mm512_set1_ps(p.offset.z);
+
+		for (size_t i = 0; i < count; i += 16)
+		{
+			__mmask16 mask = (count - i >= 16) ? __mmask16(0xffff) : __mmask16((1u << (count - i)) - 1);
+			__m512 qx = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, x + i), ox);
+			__m512 qy = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, y + i), oy);
+			__m512 qz = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, z + i), oz);
+			__m512 sum = _mm512_setzero_ps();
+			float frequency = p.frequency, amplitude = 1.0f;
+			for (int o = 0; o < p.octaves; ++o)
+			{
+				__m512 f = _mm512_set1_ps(frequency);
+				__m512 sx = _mm512_mul_ps(qx, f), sy = _mm512_mul_ps(qy, f), sz = _mm512_mul_ps(qz, f);
+				__m512 n = simplex ? simplexAVX512(sx, sy, sz) : perlinAVX512(sx, sy, sz);
+				if (ridged)
+				{
+					n = _mm512_sub_ps(one, _mm512_abs_ps(n));
+					n = _mm512_mul_ps(n, n);
+				}
+				sum = _mm512_add_ps(sum, _mm512_mul_ps(_mm512_set1_ps(amplitude), n));
+				frequency *= p.lacunarity;
+				amplitude *= p.gain;
+			}
+			_mm512_mask_storeu_ps(out + i, mask, sum);
+		}
+	}
+
+#endif // CG_SIMD_X86
+
+
+	// kernels indexed by CpuInfo::SimdLevelT /////////////////////////////////////////////////////
+	const KernelT KERNELS[] =
+	{
+		fractalScalar,
+#if CG_SIMD_X86
+		fractalSSE2,
+		fractalAVX2,
+		fractalAVX512,
+#endif
+	};
+
+	inline KernelT getKernel(void)
+	{
+		int level = NoiseField::getLevel();
+		return KERNELS[level < int(sizeof(KERNELS) / sizeof(KERNELS[0])) ? level : 0];
+	}
+}
+
+
+
+NoiseField::ParametersT NoiseField::getDefaultParameters(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ParametersT parameters;
+	parameters.noise = NOISE_SIMPLEX;
+	parameters.fractal = FRACTAL_FBM;
+	parameters.octaves = 6;
+	parameters.frequency = 1.0f / 256.0f;
+	parameters.lacunarity = 2.0f;
+	parameters.gain = 0.5f;
+	parameters.offset = glm::vec3(0.0f);
+	return parameters;
+}
+// NoiseField::getDefaultParameters() /////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: sample()
+// purpose:  Octave sum at one position with glm::perlin() or glm::simplex(), the reference of
+//           the SIMD kernels.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float NoiseField::sample(const ParametersT& parameters, const glm::vec3& position)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::vec3 q = position + parameters.offset;
+	float sum = 0.0f, frequency = parameters.frequency, amplitude = 1.0f;
+	for (int o = 0; o < parameters.octaves; ++o)
+	{
+		glm::vec3 s = q * frequency;
+		float n = (parameters.noise == NOISE_SIMPLEX) ? glm::simplex(s) : glm::perlin(s);
+		if (parameters.fractal == FRACTAL_RIDGED)
+		{
+			n = 1.0f - fabs(n);
+			n = n * n;
+		}
+		sum += amplitude * n;
+		frequency *= parameters.lacunarity;
+		amplitude *= parameters.gain;
+	}
+	return sum;
+}
+// NoiseField::sample() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: evaluate()
+// purpose:  out[i] = sample(parameters, (x[i], y[i], z[i])) for count positions.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NoiseField::evaluate(const ParametersT& parameters, const float* x, const float* y,
+	const float* z, float* out, size_t count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	getKernel()(parameters, x, y, z, out, count);
+}
+// NoiseField::evaluate() /////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: generate()
+// purpose:  Fills out[(k * height + j) * width + i] with the octave sum at (i, j, k). The
+//           height * depth rows are taken by threads workers (0 uses all hardware threads).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void NoiseField::generate(const ParametersT& parameters, float* out, int width, int height,
+	int depth, unsigned threads)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int rows = height * depth;
+	if ((width <= 0) || (rows <= 0)) return;
+
+	KernelT kernel = getKernel();
+	vector<float> xs(width);
+	for (int i = 0; i < width; ++i) xs[i] = float(i);
+	atomic<int> nextRow(0);
+
+	// every thread evaluates the next row until all rows are done
+	auto evaluateRows = [&]()
+	{
+		vector<float> ys(width), zs(width);
+		for (int row = nextRow++; row < rows; row = nextRow++)
+		{
+			fill(ys.begin(), ys.end(), float(row % height));
+			fill(zs.begin(), zs.end(), float(row / height));
+			kernel(parameters, &xs[0], &ys[0], &zs[0], out + size_t(row) * width, width);
+		}
+	};
+
+	if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+	threads = min(threads, unsigned(rows));
+
+	vector<thread> workers;
+	for (unsigned i = 1; i < threads; ++i) workers.push_back(thread(evaluateRows));
+	evaluateRows();
+	for (size_t i = 0; i < workers.size(); ++i) workers[i].join();
+}
+// NoiseField::generate() /////////////////////////////////////////////////////////////////////////
+
+
+
+CpuInfo::SimdLevelT NoiseField::getLevel(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return CpuInfo::getLevel();
+}
+// NoiseField::getLevel() /////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,769 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ParticleSystem.cpp
+//
+//  \brief      Particle fountain simulated, compacted and sorted by compute shaders and drawn
+//              with an indirect draw whose count the GPU writes, with a CPU fallback over
+//              structure of arrays.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+using namespace std;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#endif
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/ParticleSystem.h"
+#include "../inc/StateTracker.h"
+#include "../inc/ErrorCheck.h"
+#include "../inc/CpuInfo.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const GLuint ParticleSystem::PARAMETER_BINDING;
+const GLuint ParticleSystem::PARTICLE_BINDING;
+const GLuint ParticleSystem::OUTPUT_BINDING;
+const GLuint ParticleSystem::STATE_BINDING;
+const GLuint ParticleSystem::DRAW_BINDING;
+const GLuint ParticleSystem::KEY_BINDING;
+const GLuint ParticleSystem::VALUE_BINDING;
+const GLuint ParticleSystem::SORTED_KEY_BINDING;
+const GLuint ParticleSystem::SORTED_VALUE_BINDING;
+const GLuint ParticleSystem::COUNTER_BINDING;
+const int    ParticleSystem::QUERY_COUNT;
+const GLuint ParticleSystem::UPDATE_GROUP;
+const GLuint ParticleSystem::SORT_BLOCK;
+const int    ParticleSystem::SORT_PASSES;
+
+
+
+// simulation of the alive particles (structure of arrays) ///////////////////////////////////////
+namespace
+{
+	typedef ParticleSystem::ParticleArrayT ParticleArrayT;
+
+	struct StepT
+	{
+		float time;          // seconds
+		float fall;          // gravity * time
+		float restitution;
+	};
+
+	// advances the particles [begin, end), moves the survivors in order to the indices from
+	// write on and returns the index after the last survivor
+	typedef size_t (*AdvanceT)(ParticleArrayT& p, size_t begin, size_t end, size_t write,
+		const StepT& step);
+
+
+	// the same operations in the same order as the update compute shader
+	size_t advanceScalar(ParticleArrayT& p, size_t begin, size_t end, size_t write,
+		const StepT& step)
+	{
+		for (size_t i = begin; i < end; ++i)
+		{
+			float life = p.life[i] - step.time;
+			if (life <= 0.0f) continue;
+			float vy = p.vy[i] - step.fall;
+			float x = p.x[i] + p.vx[i] * step.time;
+			float y = p.y[i] + vy * step.time;
+			float z = p.z[i] + p.vz[i] * step.time;
+			if (y < 0.0f)
+			{
+				y = -y * step.restitution;
+				vy = -vy * step.restitution;
+			}
+
+			p.x[write] = x; p.y[write] = y; p.z[write] = z;
+			p.vx[write] = p.vx[i]; p.vy[write] = vy; p.vz[write] = p.vz[i];
+			p.life[write] = life;
+			++write;
+		}
+		return write;
+	}
+
+#if CG_SIMD_X86
+	// 4 particles per iteration, groups without dead particles are stored in one piece
+	size_t advanceSSE2(ParticleArrayT& p, size_t begin, size_t end, size_t write,
+		const StepT& step)
+	{
+		__m128 time = _mm_set1_ps(step.time), fall = _mm_set1_ps(step.fall);
+		__m128 restitution = _mm_set1_ps(step.restitution);
+		__m128 zero = _mm_setzero_ps(), sign = _mm_set1_ps(-0.0f);
+		size_t i = begin;
+		for (; i + 4 <= end; i += 4)
+		{
+			__m128 life = _mm_sub_ps(_mm_loadu_ps(&p.life[i]), time);
+			int alive = _mm_movemask_ps(_mm_cmpgt_ps(life, zero));
+			if (!alive) continue;
+
+			__m128 vx = _mm_loadu_ps(&p.vx[i]), vz = _mm_loadu_ps(&p.vz[i]);
+			__m128 vy = _mm_sub_ps(_mm_loadu_ps(&p.vy[i]), fall);
+			__m128 x = _mm_add_ps(_mm_loadu_ps(&p.x[i]), _mm_mul_ps(vx, time));
+			__m128 y = _mm_add_ps(_mm_loadu_ps(&p.y[i]), _mm_mul_ps(vy, time));
+			__m128 z = _mm_add_ps(_mm_loadu_ps(&p.z[i]), _mm_mul_ps(vz, time));
+			__m128 below = _mm_cmplt_ps(y, zero);
+			__m128 bounceY = _mm_mul_ps(_mm_xor_ps(y, sign), restitution);
+			__m128 bounceVY = _mm_mul_ps(_mm_xor_ps(vy, sign), restitution);
+			y = _mm_or_ps(_mm_and_ps(below, bounceY), _mm_andnot_ps(below, y));
+			vy = _mm_or_ps(_mm_and_ps(below, bounceVY), _mm_andnot_ps(below, vy));
+
+			// write <= i, the group is loaded before it is overwritten
+			if (alive == 15)
+			{
+				_mm_storeu_ps(&p.x[write], x); _mm_storeu_ps(&p.y[write], y);
+				_mm_storeu_ps(&p.z[write], z); _mm_storeu_ps(&p.vx[write], vx);
+				_mm_storeu_ps(&p.vy[write], vy); _mm_storeu_ps(&p.vz[write], vz);
+				_mm_storeu_ps(&p.life[write], life);
+				write += 4;
+				continue;
+			}
+
+			float lanes[7][4];
+			_mm_storeu_ps(lanes[0], x); _mm_storeu_ps(lanes[1], y); _mm_storeu_ps(lanes[2], z);
+			_mm_storeu_ps(lanes[3], vx); _mm_storeu_ps(lanes[4], vy); _mm_storeu_ps(lanes[5], vz);
+			_mm_storeu_ps(lanes[6], life);
+			for (int k = 0; k < 4; ++k)
+			{
+				if (!(alive & (1 << k))) continue;
+				p.x[write] = lanes[0][k]; p.y[write] = lanes[1][k]; p.z[write] = lanes[2][k];
+				p.vx[write] = lanes[3][k]; p.vy[write] = lanes[4][k]; p.vz[write] = lanes[5][k];
+				p.life[write] = lanes[6][k];
+				++write;
+			}
+		}
+		return advanceScalar(p, i, end, write, step);
+	}
+#endif // CG_SIMD_X86
+}
+
+
+
+void ParticleSystem::ParticleArrayT::resize(size_t capacity)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	x.resize(capacity); y.resize(capacity); z.resize(capacity);
+	vx.resize(capacity); vy.resize(capacity); vz.resize(capacity);
+	life.resize(capacity);
+	count = min(count, capacity);
+}
+// ParticleSystem::ParticleArrayT::resize() ///////////////////////////////////////////////////////
+
+
+
+ParticleSystem::ParticleSystem(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Capacity(0), _HistogramShift(-1), _ScatterShift(-1), _VertexArray(0), _Mode(MODE_GPU),
+  _Sorting(true), _Sorted(false), _EmissionDebt(0.0f), _Emitted(0), _NextQuery(0),
+  _Timing(false)
+{
+	_Programs = ProgramsT();
+	for (int u = 0; u < 4; ++u) _RenderLocations[u] = -1;
+	for (int i = 0; i < BUFFER_COUNT; ++i) _Buffers[i] = 0;
+	for (int q = 0; q < 4 * QUERY_COUNT; ++q) _Queries[q] = 0;
+	for (int q = 0; q < QUERY_COUNT; ++q) _QueryPending[q] = false;
+
+	_Parameters.position = glm::vec3(0.0f);
+	_Parameters.rate = 10000.0f;
+	_Parameters.speed = 6.0f;
+	_Parameters.spread = 0.25f;
+	_Parameters.lifetime = 4.0f;
+	_Parameters.gravity = 9.81f;
+	_Parameters.restitution = 0.5f;
+	_Parameters.radius = 0.02f;
+	_Statistics = StatisticsT();
+}
+// ParticleSystem::ParticleSystem() ///////////////////////////////////////////////////////////////
+
+
+
+ParticleSystem::~ParticleSystem(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// ParticleSystem::~ParticleSystem() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  Creates the buffers for capacity particles. The render program reads the particles
+//           from shader storage buffers in its vertex shader and needs OpenGL 4.3, without the
+//           compute programs only MODE_CPU is available.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ParticleSystem::init(GLsizei capacity, const ProgramsT& programs)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+	if (!GLEW_VERSION_4_3)
+	{
+		cout << "Error: the particle system needs OpenGL 4.3 (shader storage buffers)" << endl;
+		return false;
+	}
+	GLint vertexBlocks = 0;
+	glGetIntegerv(GL_MAX_VERTEX_SHADER_STORAGE_BLOCKS, &vertexBlocks);
+	if (vertexBlocks < 2)
+	{
+		cout << "Error: the particle system needs shader storage buffers in vertex shaders"
+			<< endl;
+		return false;
+	}
+	if (capacity < 1 || !programs.render)
+	{
+		cout << "Error: the particle system needs a capacity and a render program" << endl;
+		return false;
+	}
+
+	_Capacity = capacity;
+	_Programs = programs;
+	bool compute = programs.prepare && programs.update && programs.sortSetup
+		&& programs.histogram && programs.scan && programs.scatter;
+	_Mode = compute ? MODE_GPU : MODE_CPU;
+
+	static const char* names[4] = { "matModelView", "matProjection", "viewportHeight",
+		"sortedParticles" };
+	for (int u = 0; u < 4; ++u) _RenderLocations[u] = glGetUniformLocation(programs.render,
+		names[u]);
+	if (compute)
+	{
+		_HistogramShift = glGetUniformLocation(programs.histogram, "radixShift");
+		_ScatterShift = glGetUniformLocation(programs.scatter, "radixShift");
+	}
+
+	_CPUParticles.resize(capacity);
+	_Upload.resize(capacity);
+	_Order.resize(capacity);
+	_Distances.resize(capacity);
+
+	// the radix sort scans 16 digit counts of every block of SORT_BLOCK keys
+	GLsizeiptr particles = capacity * sizeof(ShaderParticleT), keys = capacity * sizeof(GLuint);
+	GLsizeiptr histogram = 16 * ((capacity + SORT_BLOCK - 1) / SORT_BLOCK) * sizeof(GLuint);
+	GLuint state[12] = { 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0 };
+	const GLenum storage = GL_SHADER_STORAGE_BUFFER;
+
+	glGenBuffers(BUFFER_COUNT, _Buffers);
+	StateTracker::bindBuffer(GL_UNIFORM_BUFFER, _Buffers[BUFFER_PARAMETERS]);
+	glBufferData(GL_UNIFORM_BUFFER, sizeof(ShaderParametersT), NULL, GL_DYNAMIC_DRAW);
+	StateTracker::bindBuffer(storage, _Buffers[BUFFER_PARTICLES]);
+	glBufferData(storage, particles, NULL, GL_DYNAMIC_DRAW);
+	StateTracker::bindBuffer(storage, _Buffers[BUFFER_OUTPUT]);
+	glBufferData(storage, particles, NULL, GL_DYNAMIC_DRAW);
+	StateTracker::bindBuffer(storage, _Buffers[BUFFER_STATE]);
+	glBufferData(storage, sizeof(state), state, GL_DYNAMIC_DRAW);
+	StateTracker::bindBuffer(storage, _Buffers[BUFFER_DRAW]);
+	glBufferData(storage, 4 * sizeof(GLuint), NULL, GL_DYNAMIC_DRAW);
+	for (int b = BUFFER_KEYS; b <= BUFFER_SORTED_VALUES; ++b)
+	{
+		StateTracker::bindBuffer(storage, _Buffers[b]);
+		glBufferData(storage, keys, NULL, GL_DYNAMIC_DRAW);
+	}
+	StateTracker::bindBuffer(storage, _Buffers[BUFFER_HISTOGRAM]);
+	glBufferData(storage, histogram, NULL, GL_DYNAMIC_DRAW);
+
+	glGenVertexArrays(1, &_VertexArray);
+	glGenQueries(4 * QUERY_COUNT, _Queries);
+	reset();
+
+	CG_GL_CHECK("ParticleSystem::init");
+	return true;
+}
+// ParticleSystem::init() /////////////////////////////////////////////////////////////////////////
+
+
+
+void ParticleSystem::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_VertexArray) StateTracker::deleteVertexArrays(1, &_VertexArray);
+	if (_Buffers[0]) StateTracker::deleteBuffers(BUFFER_COUNT, _Buffers);
+	if (_Queries[0]) glDeleteQueries(4 * QUERY_COUNT, _Queries);
+
+	for (int i = 0; i < BUFFER_COUNT; ++i) _Buffers[i] = 0;
+	for (int q = 0; q < 4 * QUERY_COUNT; ++q) _Queries[q] = 0;
+	for (int q = 0; q < QUERY_COUNT; ++q) _QueryPending[q] = false;
+	_VertexArray = 0;
+	_Capacity = 0;
+	_Programs = ProgramsT();
+	_NextQuery = 0;
+	_Timing = false;
+	_CPUParticles = ParticleArrayT();
+	_Upload.clear();
+	_Order.clear();
+	_Distances.clear();
+}
+// ParticleSystem::release() //////////////////////////////////////////////////////////////////////
+
+
+
+void ParticleSystem::setMode(ModeT mode)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if ((mode == MODE_GPU) && !_Programs.update) return;
+	if (mode == _Mode) return;
+	_Mode = mode;
+	if (_Buffers[0]) reset();
+}
+// ParticleSystem::setMode() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: update()
+// purpose:  Advances the particles by deltaTime seconds and emits the new ones; eye is the
+//           position the particles are sorted for (model coordinates).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParticleSystem::update(float deltaTime, const glm::vec3& eye)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Buffers[0]) return;
+	CG_GL_SCOPE("ParticleSystem::update");
+	readQueries();
+
+	GLuint emit = takeEmission(deltaTime);
+	writeParameters(deltaTime, eye, emit);
+	_Timing = !_QueryPending[_NextQuery];
+	GLuint* queries = &_Queries[4 * _NextQuery];
+
+	if (_Timing) glQueryCounter(queries[0], GL_TIMESTAMP);
+	if (_Mode == MODE_GPU) updateGPU();
+	else updateCPU(deltaTime, eye, emit);
+	if (_Timing) glQueryCounter(queries[1], GL_TIMESTAMP);
+	if ((_Mode == MODE_GPU) && _Sorting) sortGPU();
+	if (_Timing) glQueryCounter(queries[2], GL_TIMESTAMP);
+
+	_Emitted += emit;
+	_Sorted = _Sorting;
+	CG_GL_CHECK("ParticleSystem::update");
+}
+// ParticleSystem::update() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: draw()
+// purpose:  Draws the particles of the last update() as point sprites, the count comes from
+//           the indirect draw command. Leaves the render program bound.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParticleSystem::draw(const glm::mat4& projection, const glm::mat4& modelView,
+	GLsizei height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Buffers[0]) return;
+	CG_GL_SCOPE("ParticleSystem::draw");
+
+	StateTracker::useProgram(_Programs.render);
+	glUniformMatrix4fv(_RenderLocations[0], 1, GL_FALSE, glm::value_ptr(modelView));
+	glUniformMatrix4fv(_RenderLocations[1], 1, GL_FALSE, glm::value_ptr(projection));
+	glUniform1f(_RenderLocations[2], float(height));
+	glUniform1i(_RenderLocations[3], _Sorted ? 1 : 0);
+
+	const GLenum storage = GL_SHADER_STORAGE_BUFFER;
+	StateTracker::bindBufferBase(GL_UNIFORM_BUFFER, PARAMETER_BINDING,
+		_Buffers[BUFFER_PARAMETERS]);
+	StateTracker::bindBufferBase(storage, PARTICLE_BINDING, _Buffers[BUFFER_PARTICLES]);
+	StateTracker::bindBufferBase(storage, VALUE_BINDING, _Buffers[BUFFER_VALUES]);
+
+	// premultiplied alpha, the particles are tested against but do not write the depth
+	StateTracker::enable(GL_BLEND);
+	StateTracker::blendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+	StateTracker::depthMask(GL_FALSE);
+	StateTracker::enable(GL_PROGRAM_POINT_SIZE);
+
+	StateTracker::bindVertexArray(_VertexArray);
+	StateTracker::bindBuffer(GL_DRAW_INDIRECT_BUFFER, _Buffers[BUFFER_DRAW]);
+	glDrawArraysIndirect(GL_POINTS, 0);
+
+	StateTracker::disable(GL_PROGRAM_POINT_SIZE);
+	StateTracker::depthMask(GL_TRUE);
+	StateTracker::disable(GL_BLEND);
+
+	if (_Timing)
+	{
+		glQueryCounter(_Queries[4 * _NextQuery + 3], GL_TIMESTAMP);
+		_QueryPending[_NextQuery] = true;
+		_NextQuery = (_NextQuery + 1) % QUERY_COUNT;
+		_Timing = false;
+	}
+}
+// ParticleSystem::draw() /////////////////////////////////////////////////////////////////////////
+
+
+
+ParticleSystem::StatisticsT ParticleSystem::getStatistics(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT statistics = _Statistics;
+	statistics.mode = _Mode;
+	statistics.capacity = GLuint(_Capacity);
+	statistics.sorting = _Sorted;
+	statistics.particles = GLuint(_CPUParticles.count);
+	if (!_Buffers[0]) return statistics;
+
+	// the count of the GPU particles is in the draw command
+	if (_Mode == MODE_GPU)
+	{
+		StateTracker::bindBuffer(GL_DRAW_INDIRECT_BUFFER, _Buffers[BUFFER_DRAW]);
+		glGetBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(GLuint), &statistics.particles);
+	}
+	return statistics;
+}
+// ParticleSystem::getStatistics() ////////////////////////////////////////////////////////////////
+
+
+
+void ParticleSystem::report(ostream& out)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT s = getStatistics();
+	out << "Particles (" << ((_Mode == MODE_GPU) ? "GPU" :
+		((CpuInfo::getLevel() >= CpuInfo::SL_SSE2) ? "CPU SSE2" : "CPU scalar")) << "): "
+		<< s.particles << " of " << s.capacity << ", " << (s.sorting ? "sorted" : "unsorted")
+		<< ", update " << fixed << setprecision(3) << s.updateMilliseconds << " ms, sort "
+		<< s.sortMilliseconds << " ms, draw " << s.drawMilliseconds << " ms" << endl;
+	out.unsetf(ios::floatfield);
+}
+// ParticleSystem::report() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: simulate()
+// purpose:  CPU simulation, the emission is limited by the free capacity before the update as
+//           on the GPU. Without SSE2 the scalar reference is used.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+size_t ParticleSystem::simulate(ParticleArrayT& particles, const ParametersT& parameters,
+	float deltaTime, size_t emit, GLuint firstSeed)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	AdvanceT advance = advanceScalar;
+#if CG_SIMD_X86
+	if (CpuInfo::getLevel() >= CpuInfo::SL_SSE2) advance = advanceSSE2;
+#endif
+
+	StepT step = { deltaTime, parameters.gravity * deltaTime, parameters.restitution };
+	size_t alive = particles.count;
+	particles.count = advance(particles, 0, alive, 0, step);
+	return emitParticles(particles, parameters, min(emit, particles.capacity() - alive),
+		firstSeed);
+}
+// ParticleSystem::simulate() /////////////////////////////////////////////////////////////////////
+
+
+
+size_t ParticleSystem::simulateScalar(ParticleArrayT& particles, const ParametersT& parameters,
+	float deltaTime, size_t emit, GLuint firstSeed)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StepT step = { deltaTime, parameters.gravity * deltaTime, parameters.restitution };
+	size_t alive = particles.count;
+	particles.count = advanceScalar(particles, 0, alive, 0, step);
+	return emitParticles(particles, parameters, min(emit, particles.capacity() - alive),
+		firstSeed);
+}
+// ParticleSystem::simulateScalar() ///////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: random()
+// purpose:  Uniform number in [0, 1) from the lowbias32 integer hash of seed, the same bits as
+//           particleRandom() of the compute shader.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+float ParticleSystem::random(GLuint seed)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	seed ^= seed >> 16;
+	seed *= 0x7feb352du;
+	seed ^= seed >> 15;
+	seed *= 0x846ca68bu;
+	seed ^= seed >> 16;
+	return float(seed >> 8) * (1.0f / 16777216.0f);
+}
+// ParticleSystem::random() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: emitParticles()
+// purpose:  Appends emit particles at the emitter, particle i uses the seeds
+//           3 * (firstSeed + i) + 0, 1, 2 for the horizontal velocity and the lifetime.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+size_t ParticleSystem::emitParticles(ParticleArrayT& particles, const ParametersT& parameters,
+	size_t emit, GLuint firstSeed)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	float speed = parameters.speed, spread = parameters.spread * speed;
+	size_t write = particles.count;
+	for (size_t i = 0; i < emit; ++i, ++write)
+	{
+		GLuint seed = 3u * (firstSeed + GLuint(i));
+		particles.x[write] = parameters.position.x;
+		particles.y[write] = parameters.position.y;
+		particles.z[write] = parameters.position.z;
+		particles.vx[write] = spread * (2.0f * random(seed) - 1.0f);
+		particles.vy[write] = speed;
+		particles.vz[write] = spread * (2.0f * random(seed + 1u) - 1.0f);
+		particles.life[write] = parameters.lifetime * (0.5f + 0.5f * random(seed + 2u));
+	}
+	particles.count = write;
+	return emit;
+}
+// ParticleSystem::emitParticles() ////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: reset()
+// purpose:  Removes all particles and restarts the emission.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParticleSystem::reset(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_CPUParticles.count = 0;
+	_EmissionDebt = 0.0f;
+	_Emitted = 0;
+	_Sorted = false;
+
+	GLuint command[4] = { 0, 1, 0, 0 };   // DrawArraysIndirectCommand
+	StateTracker::bindBuffer(GL_DRAW_INDIRECT_BUFFER, _Buffers[BUFFER_DRAW]);
+	glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(command), command);
+}
+// ParticleSystem::reset() ////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: takeEmission()
+// purpose:  Whole particles due in deltaTime at the emission rate, the fraction is carried to
+//           the next frame.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint ParticleSystem::takeEmission(float deltaTime)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_EmissionDebt += max(_Parameters.rate, 0.0f) * max(deltaTime, 0.0f);
+	float emit = min(float(int(_EmissionDebt)), float(_Capacity));
+	_EmissionDebt = min(_EmissionDebt - emit, 1.0f);
+	return GLuint(emit);
+}
+// ParticleSystem::takeEmission() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: updateGPU()
+// purpose:  Prepare and update pass, the update reads the particles and appends the survivors
+//           and the new particles to the output buffer, which becomes the particle buffer.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParticleSystem::updateGPU(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const GLenum storage = GL_SHADER_STORAGE_BUFFER;
+	const GLbitfield barriers = GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT
+		| GL_ATOMIC_COUNTER_BARRIER_BIT;
+	StateTracker::bindBufferBase(GL_UNIFORM_BUFFER, PARAMETER_BINDING,
+		_Buffers[BUFFER_PARAMETERS]);
+	StateTracker::bindBufferBase(storage, STATE_BINDING, _Buffers[BUFFER_STATE]);
+	StateTracker::bindBufferBase(storage, DRAW_BINDING, _Buffers[BUFFER_DRAW]);
+	StateTracker::useProgram(_Programs.prepare);
+	glDispatchCompute(1, 1, 1);
+	glMemoryBarrier(barriers);
+
+	// the count of the draw command is the counter of the appended particles
+	StateTracker::bindBufferBase(storage, PARTICLE_BINDING, _Buffers[BUFFER_PARTICLES]);
+	StateTracker::bindBufferBase(storage, OUTPUT_BINDING, _Buffers[BUFFER_OUTPUT]);
+	StateTracker::bindBufferBase(storage, KEY_BINDING, _Buffers[BUFFER_KEYS]);
+	StateTracker::bindBufferBase(storage, VALUE_BINDING, _Buffers[BUFFER_VALUES]);
+	StateTracker::bindBufferBase(GL_ATOMIC_COUNTER_BUFFER, COUNTER_BINDING,
+		_Buffers[BUFFER_DRAW]);
+	StateTracker::bindBuffer(GL_DISPATCH_INDIRECT_BUFFER, _Buffers[BUFFER_STATE]);
+	StateTracker::useProgram(_Programs.update);
+	glDispatchComputeIndirect(0);
+	glMemoryBarrier(barriers);
+
+	swap(_Buffers[BUFFER_PARTICLES], _Buffers[BUFFER_OUTPUT]);
+}
+// ParticleSystem::updateGPU() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: sortGPU()
+// purpose:  Radix sort of the depth keys written by the update, 8 passes of 4 bit digits. The
+//           passes alternate between the key and value buffers and end in the input buffers.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParticleSystem::sortGPU(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const GLenum storage = GL_SHADER_STORAGE_BUFFER;
+	const GLintptr sortDispatch = 4 * sizeof(GLuint);
+	StateTracker::useProgram(_Programs.sortSetup);
+	glDispatchCompute(1, 1, 1);
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+
+	StateTracker::bindBufferBase(storage, OUTPUT_BINDING, _Buffers[BUFFER_HISTOGRAM]);
+	StateTracker::bindBuffer(GL_DISPATCH_INDIRECT_BUFFER, _Buffers[BUFFER_STATE]);
+	for (int pass = 0; pass < SORT_PASSES; ++pass)
+	{
+		StateTracker::bindBufferBase(storage, KEY_BINDING, _Buffers[BUFFER_KEYS]);
+		StateTracker::bindBufferBase(storage, VALUE_BINDING, _Buffers[BUFFER_VALUES]);
+		StateTracker::bindBufferBase(storage, SORTED_KEY_BINDING, _Buffers[BUFFER_SORTED_KEYS]);
+		StateTracker::bindBufferBase(storage, SORTED_VALUE_BINDING,
+			_Buffers[BUFFER_SORTED_VALUES]);
+
+		StateTracker::useProgram(_Programs.histogram);
+		glUniform1ui(_HistogramShift, 4 * pass);
+		glDispatchComputeIndirect(sortDispatch);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+		StateTracker::useProgram(_Programs.scan);
+		glDispatchCompute(1, 1, 1);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+		StateTracker::useProgram(_Programs.scatter);
+		glUniform1ui(_ScatterShift, 4 * pass);
+		glDispatchComputeIndirect(sortDispatch);
+		glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+		swap(_Buffers[BUFFER_KEYS], _Buffers[BUFFER_SORTED_KEYS]);
+		swap(_Buffers[BUFFER_VALUES], _Buffers[BUFFER_SORTED_VALUES]);
+	}
+}
+// ParticleSystem::sortGPU() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: updateCPU()
+// purpose:  Simulates and sorts on the CPU and uploads the particles, the sorted indices and
+//           the draw command for the same draw as the GPU path.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParticleSystem::updateCPU(float deltaTime, const glm::vec3& eye, GLuint emit)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	simulate(_CPUParticles, _Parameters, deltaTime, emit, _Emitted);
+
+	const ParticleArrayT& p = _CPUParticles;
+	GLuint count = GLuint(p.count);
+	for (GLuint i = 0; i < count; ++i)
+	{
+		_Upload[i].position = glm::vec4(p.x[i], p.y[i], p.z[i], p.life[i]);
+		_Upload[i].velocity = glm::vec4(p.vx[i], p.vy[i], p.vz[i], 0.0f);
+	}
+	chrono::steady_clock::time_point simulated = chrono::steady_clock::now();
+
+	// back to front, equal distances keep the particle order like the radix sort
+	if (_Sorting)
+	{
+		for (GLuint i = 0; i < count; ++i)
+		{
+			glm::vec3 offset = glm::vec3(p.x[i], p.y[i], p.z[i]) - eye;
+			_Distances[i] = glm::dot(offset, offset);
+			_Order[i] = i;
+		}
+		const vector<float>& distances = _Distances;
+		stable_sort(_Order.begin(), _Order.begin() + count, [&](GLuint a, GLuint b)
+		{
+			return distances[a] > distances[b];
+		});
+	}
+	chrono::steady_clock::time_point sorted = chrono::steady_clock::now();
+
+	const GLenum storage = GL_SHADER_STORAGE_BUFFER;
+	if (count)
+	{
+		StateTracker::bindBuffer(storage, _Buffers[BUFFER_PARTICLES]);
+		glBufferSubData(storage, 0, count * sizeof(ShaderParticleT), &_Upload[0]);
+		if (_Sorting)
+		{
+			StateTracker::bindBuffer(storage, _Buffers[BUFFER_VALUES]);
+			glBufferSubData(storage, 0, count * sizeof(GLuint), &_Order[0]);
+		}
+	}
+	GLuint command[4] = { count, 1, 0, 0 };
+	StateTracker::bindBuffer(GL_DRAW_INDIRECT_BUFFER, _Buffers[BUFFER_DRAW]);
+	glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, sizeof(command), command);
+
+	_Statistics.updateMilliseconds = chrono::duration<double, milli>(simulated - start).count();
+	_Statistics.sortMilliseconds = chrono::duration<double, milli>(sorted - simulated).count();
+}
+// ParticleSystem::updateCPU() ////////////////////////////////////////////////////////////////////
+
+
+
+void ParticleSystem::writeParameters(float deltaTime, const glm::vec3& eye, GLuint emit)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const ParametersT& p = _Parameters;
+	ShaderParametersT shader;
+	shader.emitter = glm::vec4(p.position, p.radius);
+	shader.velocity = glm::vec4(p.speed, p.spread, p.lifetime, p.gravity);
+	shader.simulation = glm::vec4(deltaTime, p.restitution, _Sorting ? 1.0f : 0.0f, 0.0f);
+	shader.eye = glm::vec4(eye, 1.0f);
+	shader.emission[0] = emit;
+	shader.emission[1] = _Emitted;
+	shader.emission[2] = GLuint(_Capacity);
+	shader.emission[3] = 0;
+
+	StateTracker::bindBuffer(GL_UNIFORM_BUFFER, _Buffers[BUFFER_PARAMETERS]);
+	glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(shader), &shader);
+}
+// ParticleSystem::writeParameters() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: readQueries()
+// purpose:  Collects the finished timestamps in submission order without waiting. The update
+//           and sort times of MODE_CPU are measured on the CPU.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ParticleSystem::readQueries(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < QUERY_COUNT; ++i)
+	{
+		int slot = (_NextQuery + i) % QUERY_COUNT;
+		if (!_QueryPending[slot]) continue;
+
+		GLint available = 0;
+		glGetQueryObjectiv(_Queries[4 * slot + 3], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) break;
+
+		GLuint64 time[4];
+		for (int t = 0; t < 4; ++t)
+		{
+			glGetQueryObjectui64v(_Queries[4 * slot + t], GL_QUERY_RESULT, &time[t]);
+		}
+		if (_Mode == MODE_GPU)
+		{
+			_Statistics.updateMilliseconds = (time[1] - time[0]) * 1.0e-6;
+			_Statistics.sortMilliseconds = (time[2] - time[1]) * 1.0e-6;
+		}
+		_Statistics.drawMilliseconds = (time[3] - time[2]) * 1.0e-6;
+		_QueryPending[slot] = false;
+	}
+}
+// ParticleSystem::readQueries() //////////////////////////////////////////////////////////////////
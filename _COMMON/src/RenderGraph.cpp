@@ -0,0 +1,679 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   RenderGraph.cpp
+//
+//  \brief      Declarative render graph: passes declare the textures they read and write, the
+//              graph culls unused passes, orders them, aliases transient textures and inserts
+//              the memory barriers.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include <queue>
+#include <functional>
+#include <algorithm>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/RenderGraph.h"
+#include "../inc/StateTracker.h"
+#include "../inc/ErrorCheck.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const int RenderGraph::MAX_UNUSED_FRAMES;
+
+
+
+RenderGraph::RenderGraph(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Framebuffer(0), _ColorAttachments(0), _DepthAttachment(false), _Compiled(false)
+{
+	_Statistics = StatisticsT();
+}
+// RenderGraph::RenderGraph() /////////////////////////////////////////////////////////////////////
+
+
+
+RenderGraph::~RenderGraph(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// RenderGraph::~RenderGraph() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: reset()
+// purpose:  Removes the passes and textures of the previous frame, the pool is kept.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void RenderGraph::reset(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Passes.clear();
+	_Resources.clear();
+	_Order.clear();
+	_Compiled = false;
+}
+// RenderGraph::reset() ///////////////////////////////////////////////////////////////////////////
+
+
+
+int RenderGraph::createTexture(const string& name, const TextureDescT& desc)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ResourceT resource = { name, desc, 0, false, -1, -1, -1 };
+	_Resources.push_back(resource);
+	return int(_Resources.size()) - 1;
+}
+// RenderGraph::createTexture() ///////////////////////////////////////////////////////////////////
+
+
+
+int RenderGraph::importTexture(const string& name, GLuint texture, const TextureDescT& desc)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ResourceT resource = { name, desc, texture, true, -1, -1, -1 };
+	_Resources.push_back(resource);
+	return int(_Resources.size()) - 1;
+}
+// RenderGraph::importTexture() ///////////////////////////////////////////////////////////////////
+
+
+
+int RenderGraph::addPass(const string& name, ExecuteT execute)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	PassT pass;
+	pass.name = name;
+	pass.execute = execute;
+	pass.live = false;
+	pass.barriers = 0;
+	_Passes.push_back(pass);
+	return int(_Passes.size()) - 1;
+}
+// RenderGraph::addPass() /////////////////////////////////////////////////////////////////////////
+
+
+
+void RenderGraph::read(int pass, int texture, UsageT usage)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	AccessT access = { texture, usage, false };
+	_Passes[pass].accesses.push_back(access);
+}
+// RenderGraph::read() ////////////////////////////////////////////////////////////////////////////
+
+
+
+void RenderGraph::write(int pass, int texture, UsageT usage)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	AccessT access = { texture, usage, true };
+	_Passes[pass].accesses.push_back(access);
+}
+// RenderGraph::write() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: compile()
+// purpose:  Culls, orders, allocates and synchronizes the declared passes. Returns false if the
+//           dependencies form a cycle (nothing is executed then).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool RenderGraph::compile(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	cull();
+	_Compiled = sort();
+	if (!_Compiled)
+	{
+		cout << "Error: render graph dependencies form a cycle" << endl;
+		return false;
+	}
+	allocate();
+	placeBarriers();
+	return true;
+}
+// RenderGraph::compile() /////////////////////////////////////////////////////////////////////////
+
+
+
+void RenderGraph::execute(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Compiled) return;
+
+	for (size_t step = 0; step < _Order.size(); ++step)
+	{
+		const PassT& pass = _Passes[_Order[step]];
+		CG_GL_SCOPE(pass.name.c_str());
+
+		if (pass.barriers) glMemoryBarrier(pass.barriers);
+		bindFramebuffer(pass);
+		pass.execute(*this);
+	}
+}
+// RenderGraph::execute() /////////////////////////////////////////////////////////////////////////
+
+
+
+void RenderGraph::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (size_t i = 0; i < _Pool.size(); ++i) StateTracker::deleteTextures(1, &_Pool[i].texture);
+	_Pool.clear();
+	if (_Framebuffer) glDeleteFramebuffers(1, &_Framebuffer);
+	_Framebuffer = 0;
+	_ColorAttachments = 0;
+	_DepthAttachment = false;
+	reset();
+}
+// RenderGraph::release() /////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: cull()
+// purpose:  Marks the passes writing imported textures and, transitively, the writers of every
+//           texture a live pass reads as live. A pass that reads and writes a texture only
+//           depends on the writers declared before it.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void RenderGraph::cull(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<vector<int> > writers(_Resources.size());
+	vector<int> work;
+	for (size_t p = 0; p < _Passes.size(); ++p)
+	{
+		PassT& pass = _Passes[p];
+		pass.live = false;
+		for (size_t a = 0; a < pass.accesses.size(); ++a)
+		{
+			const AccessT& access = pass.accesses[a];
+			if (!access.write) continue;
+			if (writers[access.resource].empty() || writers[access.resource].back() != int(p))
+				writers[access.resource].push_back(int(p));
+			if (_Resources[access.resource].imported && !pass.live)
+			{
+				pass.live = true;
+				work.push_back(int(p));
+			}
+		}
+	}
+
+	while (!work.empty())
+	{
+		int p = work.back();
+		work.pop_back();
+		const PassT& pass = _Passes[p];
+		for (size_t a = 0; a < pass.accesses.size(); ++a)
+		{
+			const AccessT& access = pass.accesses[a];
+			if (access.write) continue;
+			const vector<int>& resourceWriters = writers[access.resource];
+			bool writes = (find(resourceWriters.begin(), resourceWriters.end(), p) !=
+				resourceWriters.end());
+			for (size_t w = 0; w < resourceWriters.size(); ++w)
+			{
+				int writer = resourceWriters[w];
+				if (writes && writer >= p) break;
+				if (!_Passes[writer].live)
+				{
+					_Passes[writer].live = true;
+					work.push_back(writer);
+				}
+			}
+		}
+	}
+
+	_Statistics.passes = int(_Passes.size());
+	_Statistics.culledPasses = 0;
+	for (size_t p = 0; p < _Passes.size(); ++p)
+	{
+		if (!_Passes[p].live) _Statistics.culledPasses++;
+	}
+}
+// RenderGraph::cull() ////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: sort()
+// purpose:  Orders the live passes topologically: the writers of a texture are chained in
+//           declaration order, passes that only read it follow its last writer. Among ready
+//           passes the one declared first runs first.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool RenderGraph::sort(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t passCount = _Passes.size();
+	vector<vector<int> > edges(passCount);
+	vector<int> inDegree(passCount, 0);
+
+	for (size_t r = 0; r < _Resources.size(); ++r)
+	{
+		// live writers in declaration order
+		int lastWriter = -1;
+		for (size_t p = 0; p < passCount; ++p)
+		{
+			const PassT& pass = _Passes[p];
+			if (!pass.live) continue;
+			for (size_t a = 0; a < pass.accesses.size(); ++a)
+			{
+				if (pass.accesses[a].resource != int(r) || !pass.accesses[a].write) continue;
+				if (lastWriter >= 0)
+				{
+					edges[lastWriter].push_back(int(p));
+					inDegree[p]++;
+				}
+				lastWriter = int(p);
+				break;
+			}
+		}
+		if (lastWriter < 0) continue;
+
+		// readers that do not write the texture
+		for (size_t p = 0; p < passCount; ++p)
+		{
+			const PassT& pass = _Passes[p];
+			if (!pass.live) continue;
+			bool reads = false, writes = false;
+			for (size_t a = 0; a < pass.accesses.size(); ++a)
+			{
+				if (pass.accesses[a].resource != int(r)) continue;
+				if (pass.accesses[a].write) writes = true;
+				else reads = true;
+			}
+			if (reads && !writes)
+			{
+				edges[lastWriter].push_back(int(p));
+				inDegree[p]++;
+			}
+		}
+	}
+
+	priority_queue<int, vector<int>, greater<int> > ready;
+	size_t liveCount = 0;
+	for (size_t p = 0; p < passCount; ++p)
+	{
+		if (!_Passes[p].live) continue;
+		liveCount++;
+		if (inDegree[p] == 0) ready.push(int(p));
+	}
+
+	_Order.clear();
+	while (!ready.empty())
+	{
+		int p = ready.top();
+		ready.pop();
+		_Order.push_back(p);
+		for (size_t e = 0; e < edges[p].size(); ++e)
+		{
+			if (--inDegree[edges[p][e]] == 0) ready.push(edges[p][e]);
+		}
+	}
+	return _Order.size() == liveCount;
+}
+// RenderGraph::sort() ////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: allocate()
+// purpose:  Computes the lifetimes of the transient textures and assigns pool textures in pass
+//           order, a pool texture is free again after the last pass using its transient.
+//           Tracks the peak of the live transient memory.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void RenderGraph::allocate(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// pool textures that no frame needed for a while
+	for (size_t i = 0; i < _Pool.size(); )
+	{
+		if (_Pool[i].unusedFrames > MAX_UNUSED_FRAMES)
+		{
+			StateTracker::deleteTextures(1, &_Pool[i].texture);
+			_Pool.erase(_Pool.begin() + i);
+		}
+		else ++i;
+	}
+
+	// lifetimes in the pass order
+	vector<vector<int> > starts(_Order.size()), ends(_Order.size());
+	for (size_t step = 0; step < _Order.size(); ++step)
+	{
+		const PassT& pass = _Passes[_Order[step]];
+		for (size_t a = 0; a < pass.accesses.size(); ++a)
+		{
+			ResourceT& resource = _Resources[pass.accesses[a].resource];
+			if (resource.first < 0) resource.first = int(step);
+			resource.last = int(step);
+		}
+	}
+
+	_Statistics.transients = 0;
+	_Statistics.unaliasedBytes = 0;
+	for (size_t r = 0; r < _Resources.size(); ++r)
+	{
+		ResourceT& resource = _Resources[r];
+		if (resource.imported) continue;
+		_Statistics.transients++;
+		if (resource.first < 0) continue;
+		starts[resource.first].push_back(int(r));
+		ends[resource.last].push_back(int(r));
+		_Statistics.unaliasedBytes += getTextureSize(resource.desc);
+	}
+
+	// greedy assignment, free pool textures with the same description are reused
+	for (size_t i = 0; i < _Pool.size(); ++i) _Pool[i].used = false;
+	vector<bool> busy(_Pool.size(), false);
+	size_t liveBytes = 0;
+	_Statistics.peakBytes = 0;
+	for (size_t step = 0; step < _Order.size(); ++step)
+	{
+		for (size_t s = 0; s < starts[step].size(); ++s)
+		{
+			ResourceT& resource = _Resources[starts[step][s]];
+			int index = -1;
+			for (size_t i = 0; i < _Pool.size() && index < 0; ++i)
+			{
+				if (!busy[i] && isEqual(_Pool[i].desc, resource.desc)) index = int(i);
+			}
+			if (index < 0)
+			{
+				PoolTextureT texture = { resource.desc, 0, 0, false, 0 };
+				glGenTextures(1, &texture.texture);
+				StateTracker::bindTexture(GL_TEXTURE_2D, texture.texture);
+				glTexStorage2D(GL_TEXTURE_2D, 1, resource.desc.format, resource.desc.width,
+					resource.desc.height);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+				_Pool.push_back(texture);
+				busy.push_back(false);
+				index = int(_Pool.size()) - 1;
+			}
+			busy[index] = true;
+			_Pool[index].used = true;
+			resource.pool = index;
+			resource.texture = _Pool[index].texture;
+			liveBytes += getTextureSize(resource.desc);
+		}
+		_Statistics.peakBytes = max(_Statistics.peakBytes, liveBytes);
+
+		for (size_t e = 0; e < ends[step].size(); ++e)
+		{
+			const ResourceT& resource = _Resources[ends[step][e]];
+			busy[resource.pool] = false;
+			liveBytes -= getTextureSize(resource.desc);
+		}
+	}
+
+	_Statistics.textures = 0;
+	_Statistics.poolBytes = 0;
+	for (size_t i = 0; i < _Pool.size(); ++i)
+	{
+		PoolTextureT& texture = _Pool[i];
+		texture.unusedFrames = texture.used ? 0 : texture.unusedFrames + 1;
+		if (texture.used) _Statistics.textures++;
+		_Statistics.poolBytes += getTextureSize(texture.desc);
+	}
+}
+// RenderGraph::allocate() ////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: placeBarriers()
+// purpose:  Image stores leave all barrier bits pending on their texture object (pool textures
+//           keep them across frames, aliased transients share them). A pass gets the pending
+//           bits of its usages, a barrier clears its bits for all texture objects.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void RenderGraph::placeBarriers(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const GLbitfield allBits = getBarrierBit(USAGE_SAMPLED) | getBarrierBit(USAGE_IMAGE) |
+		getBarrierBit(USAGE_ATTACHMENT);
+	vector<GLbitfield> imported(_Resources.size(), 0);
+
+	_Statistics.barriers = 0;
+	for (size_t step = 0; step < _Order.size(); ++step)
+	{
+		PassT& pass = _Passes[_Order[step]];
+		pass.barriers = 0;
+		for (size_t a = 0; a < pass.accesses.size(); ++a)
+		{
+			const AccessT& access = pass.accesses[a];
+			const ResourceT& resource = _Resources[access.resource];
+			GLbitfield pending = resource.imported ? imported[access.resource] :
+				_Pool[resource.pool].pending;
+			pass.barriers |= getBarrierBit(access.usage) & pending;
+		}
+
+		if (pass.barriers)
+		{
+			_Statistics.barriers++;
+			for (size_t i = 0; i < _Pool.size(); ++i) _Pool[i].pending &= ~pass.barriers;
+			for (size_t r = 0; r < imported.size(); ++r) imported[r] &= ~pass.barriers;
+		}
+
+		for (size_t a = 0; a < pass.accesses.size(); ++a)
+		{
+			const AccessT& access = pass.accesses[a];
+			if (!access.write || access.usage != USAGE_IMAGE) continue;
+			const ResourceT& resource = _Resources[access.resource];
+			if (resource.imported) imported[access.resource] = allBits;
+			else _Pool[resource.pool].pending = allBits;
+		}
+	}
+}
+// RenderGraph::placeBarriers() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: bindFramebuffer()
+// purpose:  Attaches the textures a pass accesses as attachments to the graph FBO, or binds the
+//           default framebuffer if one of them is the imported texture 0.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void RenderGraph::bindFramebuffer(const PassT& pass)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<int> attachments;
+	for (size_t a = 0; a < pass.accesses.size(); ++a)
+	{
+		const AccessT& access = pass.accesses[a];
+		if (access.usage != USAGE_ATTACHMENT) continue;
+		if (find(attachments.begin(), attachments.end(), access.resource) == attachments.end())
+			attachments.push_back(access.resource);
+	}
+	if (attachments.empty()) return;
+
+	const TextureDescT& viewport = _Resources[attachments[0]].desc;
+	for (size_t i = 0; i < attachments.size(); ++i)
+	{
+		const ResourceT& resource = _Resources[attachments[i]];
+		if (resource.imported && resource.texture == 0)
+		{
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			glViewport(0, 0, resource.desc.width, resource.desc.height);
+			return;
+		}
+	}
+
+	if (_Framebuffer == 0) glGenFramebuffers(1, &_Framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, _Framebuffer);
+
+	GLenum drawBuffers[8];
+	int colors = 0;
+	bool depth = false;
+	for (size_t i = 0; i < attachments.size(); ++i)
+	{
+		const ResourceT& resource = _Resources[attachments[i]];
+		GLenum format = resource.desc.format;
+		if (isDepthFormat(format))
+		{
+			bool stencil = (format == GL_DEPTH24_STENCIL8) || (format == GL_DEPTH32F_STENCIL8);
+			glFramebufferTexture2D(GL_FRAMEBUFFER, stencil ? GL_DEPTH_STENCIL_ATTACHMENT :
+				GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, resource.texture, 0);
+			depth = true;
+		}
+		else if (colors < 8)
+		{
+			drawBuffers[colors] = GL_COLOR_ATTACHMENT0 + colors;
+			glFramebufferTexture2D(GL_FRAMEBUFFER, drawBuffers[colors], GL_TEXTURE_2D,
+				resource.texture, 0);
+			colors++;
+		}
+	}
+
+	// detach what the previous pass attached beyond this pass
+	for (int i = colors; i < _ColorAttachments; ++i)
+	{
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, 0, 0);
+	}
+	if (_DepthAttachment && !depth)
+	{
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0, 0);
+	}
+	_ColorAttachments = colors;
+	_DepthAttachment = depth;
+
+	if (colors > 0) glDrawBuffers(colors, drawBuffers);
+	else glDrawBuffer(GL_NONE);
+	glViewport(0, 0, viewport.width, viewport.height);
+
+	if (ErrorCheck::isPointActive() &&
+		glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		cout << "Error: incomplete framebuffer in render pass " << pass.name << endl;
+	}
+}
+// RenderGraph::bindFramebuffer() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: report()
+// purpose:  Prints the pass order with the barriers, the culled passes, the pool assignment of
+//           the transient textures and the transient memory of the last compiled frame.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void RenderGraph::report(ostream& out) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	out << "Render Graph: " << _Statistics.passes << " passes (" << _Statistics.culledPasses
+		<< " culled), " << _Statistics.transients << " transient textures in "
+		<< _Statistics.textures << " pool textures, " << _Statistics.barriers << " barriers"
+		<< endl;
+
+	for (size_t step = 0; step < _Order.size(); ++step)
+	{
+		const PassT& pass = _Passes[_Order[step]];
+		out << "   " << step + 1 << ". " << pass.name;
+		if (pass.barriers)
+		{
+			out << " (barrier:";
+			if (pass.barriers & GL_TEXTURE_FETCH_BARRIER_BIT) out << " fetch";
+			if (pass.barriers & GL_SHADER_IMAGE_ACCESS_BARRIER_BIT) out << " image";
+			if (pass.barriers & GL_FRAMEBUFFER_BARRIER_BIT) out << " framebuffer";
+			out << ")";
+		}
+		out << endl;
+	}
+
+	bool culled = false;
+	for (size_t p = 0; p < _Passes.size(); ++p)
+	{
+		if (_Passes[p].live) continue;
+		out << (culled ? ", " : "   culled:   ") << _Passes[p].name;
+		culled = true;
+	}
+	if (culled) out << endl;
+
+	bool transients = false;
+	for (size_t r = 0; r < _Resources.size(); ++r)
+	{
+		const ResourceT& resource = _Resources[r];
+		if (resource.imported || resource.pool < 0) continue;
+		out << (transients ? ", " : "   textures: ") << resource.name << " -> #" << resource.pool;
+		transients = true;
+	}
+	if (transients) out << endl;
+
+	out << "   memory:   " << (_Statistics.peakBytes >> 10) << " KB peak transient memory ("
+		<< (_Statistics.unaliasedBytes >> 10) << " KB without aliasing), pool "
+		<< (_Statistics.poolBytes >> 10) << " KB" << endl;
+}
+// RenderGraph::report() //////////////////////////////////////////////////////////////////////////
+
+
+
+size_t RenderGraph::getTextureSize(const TextureDescT& desc)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t bytes = 4;
+	switch (desc.format)
+	{
+		case GL_R8: bytes = 1; break;
+		case GL_RG8: case GL_R16F: case GL_DEPTH_COMPONENT16: bytes = 2; break;
+		case GL_RGBA16F: case GL_RG32F: case GL_DEPTH32F_STENCIL8: bytes = 8; break;
+		case GL_RGBA32F: bytes = 16; break;
+	}
+	return bytes * desc.width * desc.height;
+}
+// RenderGraph::getTextureSize() //////////////////////////////////////////////////////////////////
+
+
+
+bool RenderGraph::isDepthFormat(GLenum format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return (format == GL_DEPTH_COMPONENT16) || (format == GL_DEPTH_COMPONENT24) ||
+		(format == GL_DEPTH_COMPONENT32F) || (format == GL_DEPTH24_STENCIL8) ||
+		(format == GL_DEPTH32F_STENCIL8);
+}
+// RenderGraph::isDepthFormat() ///////////////////////////////////////////////////////////////////
+
+
+
+bool RenderGraph::isEqual(const TextureDescT& a, const TextureDescT& b)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return (a.width == b.width) && (a.height == b.height) && (a.format == b.format);
+}
+// RenderGraph::isEqual() /////////////////////////////////////////////////////////////////////////
+
+
+
+GLbitfield RenderGraph::getBarrierBit(UsageT usage)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (usage)
+	{
+		case USAGE_SAMPLED: return GL_TEXTURE_FETCH_BARRIER_BIT;
+		case USAGE_IMAGE: return GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+		case USAGE_ATTACHMENT: return GL_FRAMEBUFFER_BARRIER_BIT;
+	}
+	return 0;
+}
+// RenderGraph::getBarrierBit() ///////////////////////////////////////////////////////////////////
@@ -0,0 +1,276 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ResourceBundle.cpp
+//
+//  \brief      Read only resource archive (shader sources, SPIR-V modules, scenes) that is
+//              memory mapped as a whole and serves its files without copying them.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Mapping moved to MappedFile
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+using namespace std;
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/ResourceBundle.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const unsigned ResourceBundle::VERSION;
+const unsigned ResourceBundle::ALIGNMENT;
+const ResourceBundle* ResourceBundle::_Mounted = NULL;
+
+
+
+namespace
+{
+	// byte wise order of the index (the same as strcmp() on the '\0' terminated names)
+	int compareNames(const char* a, size_t aLength, const char* b, size_t bLength)
+	{
+		int result = memcmp(a, b, min(aLength, bLength));
+		if (result != 0) return result;
+		return (aLength < bLength) ? -1 : (aLength > bLength) ? 1 : 0;
+	}
+
+	bool lessName(const string& a, const string& b)
+	{
+		return compareNames(a.data(), a.size(), b.data(), b.size()) < 0;
+	}
+}
+
+
+
+ResourceBundle::ResourceBundle(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+	: _Data(NULL), _Size(0), _Entries(NULL), _Count(0)
+{
+}
+// ResourceBundle::ResourceBundle() ///////////////////////////////////////////////////////////////
+
+
+
+ResourceBundle::~ResourceBundle(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	close();
+}
+// ResourceBundle::~ResourceBundle() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: open()
+// purpose:  Maps the archive read only into memory and validates its index. Returns false
+//           (silently, if the file does not exist) when no usable archive could be mapped.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ResourceBundle::open(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	close();
+
+	if (!_File.open(filename)) return false;
+	_Data = _File.getData();
+	_Size = _File.getSize();
+
+	if (!validate())
+	{
+		cout << "Error: invalid resource bundle (" << filename << ")" << endl;
+		close();
+		return false;
+	}
+
+	cout << "Resource bundle: " << filename << " (" << _Count << " files, " << _Size
+		<< " bytes)" << endl;
+	return true;
+}
+// ResourceBundle::open() /////////////////////////////////////////////////////////////////////////
+
+
+
+void ResourceBundle::close(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Mounted == this) _Mounted = NULL;
+
+	_File.close();
+	_Data = NULL;
+	_Size = 0;
+	_Entries = NULL;
+	_Count = 0;
+}
+// ResourceBundle::close() ////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: validate()
+// purpose:  Checks the header and that all names and files lie inside the mapping, so find()
+//           never has to check bounds again, and sets up the index.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ResourceBundle::validate(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Size < sizeof(HeaderT)) return false;
+	const HeaderT* header = (const HeaderT*) _Data;
+	if (memcmp(header->magic, "CGRB", 4) != 0 || header->version != VERSION) return false;
+	if (header->count > (_Size - sizeof(HeaderT)) / sizeof(EntryT)) return false;
+
+	const EntryT* entries = (const EntryT*) (_Data + sizeof(HeaderT));
+	for (unsigned i = 0; i < header->count; ++i)
+	{
+		const EntryT& entry = entries[i];
+		if (entry.name >= _Size || entry.nameLength >= _Size - entry.name) return false;
+		if (entry.data >= _Size || entry.size >= _Size - entry.data) return false;
+		if (_Data[entry.name + entry.nameLength] != '\0' || _Data[entry.data + entry.size] != '\0') return false;
+	}
+
+	_Entries = entries;
+	_Count = header->count;
+	return true;
+}
+// ResourceBundle::validate() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: find()
+// purpose:  Binary search of the name in the index (leading "./" and "../" are skipped).
+//           Returns false if the bundle does not contain the file.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ResourceBundle::find(const char* name, size_t length, ViewT& view) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (;;)
+	{
+		if (length >= 2 && name[0] == '.' && (name[1] == '/' || name[1] == '\\'))
+		{
+			name += 2; length -= 2;
+		}
+		else if (length >= 3 && name[0] == '.' && name[1] == '.' && (name[2] == '/' || name[2] == '\\'))
+		{
+			name += 3; length -= 3;
+		}
+		else break;
+	}
+
+	size_t first = 0, last = _Count;
+	while (first < last)
+	{
+		size_t middle = (first + last) / 2;
+		const EntryT& entry = _Entries[middle];
+		int order = compareNames(_Data + entry.name, entry.nameLength, name, length);
+		if (order == 0)
+		{
+			view.data = _Data + entry.data;
+			view.size = entry.size;
+			return true;
+		}
+		if (order < 0) first = middle + 1;
+		else last = middle;
+	}
+	return false;
+}
+// ResourceBundle::find() /////////////////////////////////////////////////////////////////////////
+
+
+
+ResourceBundle::ViewT ResourceBundle::getName(size_t entry) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ViewT view = { _Data + _Entries[entry].name, _Entries[entry].nameLength };
+	return view;
+}
+// ResourceBundle::getName() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: findMounted()
+// purpose:  Looks the file up in the mounted bundle. Returns false if no bundle is mounted or
+//           the file is not in it (the caller then reads the file system).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ResourceBundle::findMounted(const string& name, ViewT& view)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return (_Mounted != NULL) && _Mounted->find(name, view);
+}
+// ResourceBundle::findMounted() //////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: pack()
+// purpose:  Writes the archive of the named files (relative to the root directory, which is
+//           not part of the stored names). Returns false if a file cannot be read or written.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ResourceBundle::pack(const string& filename, const string& root, const vector<string>& names)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// canonical names ('/' separators, no leading "./") in index order
+	vector<string> sorted;
+	for (size_t i = 0; i < names.size(); ++i)
+	{
+		string name = names[i];
+		replace(name.begin(), name.end(), '\\', '/');
+		while (name.compare(0, 2, "./") == 0) name.erase(0, 2);
+		sorted.push_back(name);
+	}
+	sort(sorted.begin(), sorted.end(), lessName);
+	sorted.erase(unique(sorted.begin(), sorted.end()), sorted.end());
+
+	HeaderT header = { { 'C', 'G', 'R', 'B' }, VERSION, unsigned(sorted.size()), 0 };
+	vector<EntryT> entries(sorted.size());
+	vector<char> blob;
+	size_t offset = sizeof(HeaderT) + entries.size() * sizeof(EntryT);
+
+	for (size_t i = 0; i < sorted.size(); ++i)
+	{
+		ifstream file((root + "/" + sorted[i]).c_str(), ios_base::in | ios_base::binary);
+		if (!file)
+		{
+			cout << "Error: unable to read resource " << root << "/" << sorted[i] << endl;
+			return false;
+		}
+		vector<char> data((istreambuf_iterator<char>(file)), istreambuf_iterator<char>());
+
+		entries[i].name = unsigned(offset + blob.size());
+		entries[i].nameLength = unsigned(sorted[i].size());
+		blob.insert(blob.end(), sorted[i].begin(), sorted[i].end());
+		blob.push_back('\0');
+
+		while ((offset + blob.size()) % ALIGNMENT != 0) blob.push_back('\0');
+		entries[i].data = unsigned(offset + blob.size());
+		entries[i].size = unsigned(data.size());
+		blob.insert(blob.end(), data.begin(), data.end());
+		blob.push_back('\0');
+	}
+
+	ofstream archive(filename.c_str(), ios_base::out | ios_base::binary | ios_base::trunc);
+	archive.write((const char*) &header, sizeof(header));
+	if (!entries.empty()) archive.write((const char*) &entries[0], entries.size() * sizeof(EntryT));
+	if (!blob.empty()) archive.write(&blob[0], blob.size());
+	if (!archive)
+	{
+		cout << "Error: unable to write resource bundle " << filename << endl;
+		return false;
+	}
+	return true;
+}
+// ResourceBundle::pack() /////////////////////////////////////////////////////////////////////////
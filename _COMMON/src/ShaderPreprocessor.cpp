@@ -0,0 +1,620 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ShaderPreprocessor.cpp
+//
+//  \brief      GLSL preprocessor with #include resolution, injected defines and cached shader
+//              variants (permutations), separable stage programs and program pipelines.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Separable stage programs and program pipelines
+//     2026-10-18   1.20      agt      Sources served from the mounted ResourceBundle
+//     2026-10-18   1.30      agt      Pipelines deleted through the StateTracker
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/UtilGLSL.h"
+#include "../inc/ShaderPreprocessor.h"
+#include "../inc/ResourceBundle.h"
+#include "../inc/StateTracker.h"
+
+
+
+namespace
+{
+	bool isIdentifierChar(char c)
+	{
+		return isalnum((unsigned char) c) || (c == '_');
+	}
+
+	// all identifiers of a source text (used to skip defines a variant does not reference)
+	set<string> getIdentifiers(const string& source)
+	{
+		set<string> identifiers;
+		for (size_t i = 0; i < source.size(); )
+		{
+			if (isIdentifierChar(source[i]))
+			{
+				size_t start = i;
+				while (i < source.size() && isIdentifierChar(source[i])) ++i;
+				if (!isdigit((unsigned char) source[start])) identifiers.insert(source.substr(start, i - start));
+			}
+			else ++i;
+		}
+		return identifiers;
+	}
+
+	string toString(size_t value)
+	{
+		ostringstream stream;
+		stream << value;
+		return stream.str();
+	}
+}
+
+
+
+ShaderPreprocessor::ShaderPreprocessor(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT statistics = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	_Statistics = statistics;
+}
+// ShaderPreprocessor::ShaderPreprocessor() ///////////////////////////////////////////////////////
+
+
+
+ShaderPreprocessor::~ShaderPreprocessor(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// ShaderPreprocessor::~ShaderPreprocessor() //////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: release()
+// purpose:  Deletes all shader, program and pipeline objects and clears the source caches.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ShaderPreprocessor::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (map<vector<GLuint>, GLuint>::iterator it = _Pipelines.begin(); it != _Pipelines.end(); ++it)
+	{
+		StateTracker::deleteProgramPipelines(1, &it->second);
+	}
+	for (map<GLuint, GLuint>::iterator it = _Stages.begin(); it != _Stages.end(); ++it)
+	{
+		glDeleteProgram(it->second);
+	}
+	for (map<vector<GLuint>, GLuint>::iterator it = _Programs.begin(); it != _Programs.end(); ++it)
+	{
+		glDeleteProgram(it->second);
+	}
+	for (map<pair<GLenum, GLuint64>, GLuint>::iterator it = _Shaders.begin(); it != _Shaders.end(); ++it)
+	{
+		glDeleteShader(it->second);
+	}
+	_Pipelines.clear();
+	_Stages.clear();
+	_Programs.clear();
+	_Shaders.clear();
+	_Sources.clear();
+	_Variants.clear();
+	_Contents.clear();
+	_FileCopies.clear();
+	_Files.clear();
+}
+// ShaderPreprocessor::release() //////////////////////////////////////////////////////////////////
+
+
+
+void ShaderPreprocessor::addIncludePath(const string& path)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_IncludePaths.push_back(path);
+}
+// ShaderPreprocessor::addIncludePath() ///////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getPermutationKey()
+// purpose:  Returns the canonical key of a define set ("A=1;B=;C=x", sorted by name).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+string ShaderPreprocessor::getPermutationKey(const DefinesT& defines)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	string key;
+	for (DefinesT::const_iterator it = defines.begin(); it != defines.end(); ++it)
+	{
+		key += it->first + "=" + it->second + ";";
+	}
+	return key;
+}
+// ShaderPreprocessor::getPermutationKey() ////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getShaderType()
+// purpose:  Returns the shader type of a file name extension as used by UtilGLSL, or 0.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLenum ShaderPreprocessor::getShaderType(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (filename.find(".vert") != string::npos) return GL_VERTEX_SHADER;
+	if (filename.find(".frag") != string::npos) return GL_FRAGMENT_SHADER;
+	if (filename.find(".geom") != string::npos) return GL_GEOMETRY_SHADER;
+	if (filename.find(".tess") != string::npos) return GL_TESS_EVALUATION_SHADER;
+	if (filename.find(".tecs") != string::npos) return GL_TESS_CONTROL_SHADER;
+	if (filename.find(".comp") != string::npos) return GL_COMPUTE_SHADER;
+	return 0;
+}
+// ShaderPreprocessor::getShaderType() ////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getStageBit()
+// purpose:  Returns the glUseProgramStages() bit of a shader type, or 0.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLbitfield ShaderPreprocessor::getStageBit(GLenum type)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	switch (type)
+	{
+		case GL_VERTEX_SHADER:          return GL_VERTEX_SHADER_BIT;
+		case GL_FRAGMENT_SHADER:        return GL_FRAGMENT_SHADER_BIT;
+		case GL_GEOMETRY_SHADER:        return GL_GEOMETRY_SHADER_BIT;
+		case GL_TESS_EVALUATION_SHADER: return GL_TESS_EVALUATION_SHADER_BIT;
+		case GL_TESS_CONTROL_SHADER:    return GL_TESS_CONTROL_SHADER_BIT;
+		case GL_COMPUTE_SHADER:         return GL_COMPUTE_SHADER_BIT;
+	}
+	return 0;
+}
+// ShaderPreprocessor::getStageBit() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getHash()
+// purpose:  64-bit FNV-1a hash of a text.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint64 ShaderPreprocessor::getHash(const string& text)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint64 hash = 14695981039346656037ULL;
+	for (size_t i = 0; i < text.size(); ++i)
+	{
+		hash = (hash ^ (unsigned char) text[i]) * 1099511628211ULL;
+	}
+	return hash;
+}
+// ShaderPreprocessor::getHash() //////////////////////////////////////////////////////////////////
+
+
+
+const ResourceBundle::ViewT* ShaderPreprocessor::readFile(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	map<string, ResourceBundle::ViewT>::const_iterator it = _Contents.find(filename);
+	if (it != _Contents.end()) return &it->second;
+
+	// the mounted bundle answers includes and misses without touching the file system,
+	// its files are expanded in place
+	ResourceBundle::ViewT view;
+	if (UtilGLSL::findShaderFile(filename, view)) return &(_Contents[filename] = view);
+
+	// probe first, UtilGLSL::readShaderFile() reports missing files as errors
+	ifstream file(filename.c_str());
+	if (!file) return NULL;
+	file.close();
+
+	char* contents = UtilGLSL::readShaderFile(filename);
+	if (contents == NULL) return NULL;
+	string& text = _FileCopies[filename];
+	text = contents;
+	delete[] contents;
+	view.data = text.c_str();
+	view.size = text.size();
+	return &(_Contents[filename] = view);
+}
+// ShaderPreprocessor::readFile() /////////////////////////////////////////////////////////////////
+
+
+
+bool ShaderPreprocessor::resolveInclude(const string& name, const string& includer, string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// relative to the including file first, then the include paths
+	size_t slash = includer.find_last_of("/\\");
+	filename = (slash == string::npos) ? name : includer.substr(0, slash + 1) + name;
+	if (readFile(filename) != NULL) return true;
+
+	for (size_t i = 0; i < _IncludePaths.size(); ++i)
+	{
+		filename = _IncludePaths[i] + "/" + name;
+		if (readFile(filename) != NULL) return true;
+	}
+	return false;
+}
+// ShaderPreprocessor::resolveInclude() ///////////////////////////////////////////////////////////
+
+
+
+int ShaderPreprocessor::getSourceString(const string& filename)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<string>::iterator it = find(_Files.begin(), _Files.end(), filename);
+	if (it != _Files.end()) return int(it - _Files.begin());
+
+	_Files.push_back(filename);
+	return int(_Files.size() - 1);
+}
+// ShaderPreprocessor::getSourceString() //////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: expandFile()
+// purpose:  Appends the file to the source and recursively expands its #include lines.
+//           Every removed directive leaves an empty line and every include is followed by a
+//           #line directive, so line numbers in compiler messages stay valid. For the main
+//           file, injection receives the position after the #version line.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ShaderPreprocessor::expandFile(const string& filename, int depth, string& source,
+	size_t& injection, vector<string>& stack, set<string>& once)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (once.count(filename)) return true;
+	if (depth > MAX_INCLUDE_DEPTH || find(stack.begin(), stack.end(), filename) != stack.end())
+	{
+		cout << "Error: recursive #include of shader file (" << filename << ")" << endl;
+		return false;
+	}
+
+	const ResourceBundle::ViewT* contents = readFile(filename);
+	if (contents == NULL)
+	{
+		cout << "Error: Unable to load shader source code (" << filename << ")" << endl << endl;
+		return false;
+	}
+
+	stack.push_back(filename);
+	string sourceString = toString(getSourceString(filename));
+	if (depth > 0) source += "#line 1 " + sourceString + "\n";
+	else injection = 0;
+
+	// lines are taken from the view of the file, only directive lines are copied for parsing
+	const char* text = contents->data;
+	const char* end = text + contents->size;
+	for (size_t lineNumber = 1; text < end; ++lineNumber)
+	{
+		const char* begin = text;
+		const char* newline = (const char*) memchr(text, '\n', end - text);
+		size_t length = (newline == NULL) ? end - begin : newline - begin;
+		text = (newline == NULL) ? end : newline + 1;
+		if (length > 0 && begin[length - 1] == '\r') --length;
+
+		const char* first = begin;
+		while (first < begin + length && isspace((unsigned char) *first)) ++first;
+		if (first == begin + length || *first != '#')
+		{
+			source.append(begin, length);
+			source += "\n";
+			continue;
+		}
+
+		// directive name and argument
+		string line(begin, length);
+		istringstream tokens(line);
+		string directive, argument;
+		tokens >> directive;
+		if (directive == "#")
+		{
+			tokens >> directive;
+			directive = "#" + directive;
+		}
+		tokens >> argument;
+
+		if (directive == "#version" && depth == 0)
+		{
+			source += line + "\n";
+			injection = source.size();
+			source += "#line " + toString(lineNumber + 1) + " " + sourceString + "\n";
+		}
+		else if (directive == "#pragma" && argument == "once")
+		{
+			once.insert(filename);
+			source += "\n";
+		}
+		else if (directive == "#include")
+		{
+			size_t open = line.find_first_of("\"<");
+			size_t close = (open == string::npos) ? open : line.find_first_of("\">", open + 1);
+			string name, included;
+			if (close != string::npos) name = line.substr(open + 1, close - open - 1);
+
+			if (name.empty() || !resolveInclude(name, filename, included))
+			{
+				cout << "Error: " << filename << "(" << lineNumber << "): unable to resolve "
+					<< line << endl;
+				stack.pop_back();
+				return false;
+			}
+			if (!expandFile(included, depth + 1, source, injection, stack, once))
+			{
+				stack.pop_back();
+				return false;
+			}
+			source += "#line " + toString(lineNumber + 1) + " " + sourceString + "\n";
+		}
+		else
+		{
+			source += line + "\n";
+		}
+	}
+
+	stack.pop_back();
+	return true;
+}
+// ShaderPreprocessor::expandFile() ///////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: expand()
+// purpose:  Returns the expanded source of a shader variant (NULL on errors). The returned
+//           text is owned by the preprocessor and shared by all variants with equal content.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+const string* ShaderPreprocessor::expand(const string& filename, const DefinesT& defines)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Statistics.expansions++;
+	string variant = filename + "|" + getPermutationKey(defines);
+	map<string, GLuint64>::const_iterator it = _Variants.find(variant);
+	if (it != _Variants.end())
+	{
+		_Statistics.expansionHits++;
+		return &_Sources[it->second];
+	}
+
+	string source;
+	size_t injection = 0;
+	vector<string> stack;
+	set<string> once;
+	if (!expandFile(filename, 0, source, injection, stack, once)) return NULL;
+
+	// inject the referenced defines after the #version line
+	set<string> identifiers = getIdentifiers(source);
+	string injected;
+	for (DefinesT::const_iterator d = defines.begin(); d != defines.end(); ++d)
+	{
+		if (identifiers.count(d->first)) injected += "#define " + d->first + " " + d->second + "\n";
+	}
+	source.insert(injection, injected);
+
+	// store each distinct source once
+	GLuint64 hash = getHash(source);
+	if (_Sources.find(hash) == _Sources.end())
+	{
+		_Sources[hash] = source;
+		_Statistics.sources++;
+	}
+	_Variants[variant] = hash;
+	return &_Sources[hash];
+}
+// ShaderPreprocessor::expand() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getShader()
+// purpose:  Returns the compiled shader object of a variant (0 on errors). Variants with the
+//           same expanded source share one shader object.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint ShaderPreprocessor::getShader(GLenum type, const string& filename, const DefinesT& defines)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const string* source = expand(filename, defines);
+	if (source == NULL) return 0;
+
+	pair<GLenum, GLuint64> key(type, getHash(*source));
+	map<pair<GLenum, GLuint64>, GLuint>::const_iterator it = _Shaders.find(key);
+	if (it != _Shaders.end())
+	{
+		_Statistics.shaderHits++;
+		return it->second;
+	}
+
+	const char* code = source->c_str();
+	GLuint shader = glCreateShader(type);
+	glShaderSource(shader, 1, &code, NULL);
+	glCompileShader(shader);
+	UtilGLSL::checkShaderInfoLog(shader);
+
+	GLint successful = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &successful);
+	if (!successful)
+	{
+		cout << "Error: compiling " << filename << " (" << getPermutationKey(defines) << ")" << endl;
+		glDeleteShader(shader);
+		return 0;
+	}
+
+	_Statistics.shaders++;
+	_Shaders[key] = shader;
+	return shader;
+}
+// ShaderPreprocessor::getShader() ////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getProgram()
+// purpose:  Returns the linked program of the shader files (types from their extensions)
+//           compiled with the given defines, or 0 on errors. Permutations that result in the
+//           same shader objects share one program.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint ShaderPreprocessor::getProgram(const vector<string>& filenames, const DefinesT& defines)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<GLuint> shaders;
+	for (size_t i = 0; i < filenames.size(); ++i)
+	{
+		GLenum type = getShaderType(filenames[i]);
+		GLuint shader = type ? getShader(type, filenames[i], defines) : 0;
+		if (shader == 0)
+		{
+			if (type == 0) cout << "Error: Unknown shader file (" << filenames[i] << ")" << endl;
+			return 0;
+		}
+		shaders.push_back(shader);
+	}
+	sort(shaders.begin(), shaders.end());
+
+	map<vector<GLuint>, GLuint>::const_iterator it = _Programs.find(shaders);
+	if (it != _Programs.end())
+	{
+		_Statistics.programHits++;
+		return it->second;
+	}
+
+	GLuint program = glCreateProgram();
+	for (size_t i = 0; i < shaders.size(); ++i) glAttachShader(program, shaders[i]);
+	glLinkProgram(program);
+	UtilGLSL::checkProgramInfoLog(program);
+	for (size_t i = 0; i < shaders.size(); ++i) glDetachShader(program, shaders[i]);
+
+	GLint successful = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &successful);
+	if (!successful)
+	{
+		cout << "Error: linking shader program (" << getPermutationKey(defines) << ")" << endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	_Statistics.programs++;
+	_Programs[shaders] = program;
+	return program;
+}
+// ShaderPreprocessor::getProgram() ///////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getStageProgram()
+// purpose:  Returns the separable single stage program of a variant (0 on errors). Variants
+//           with the same expanded source share one shader object and thus one program.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint ShaderPreprocessor::getStageProgram(GLenum type, const string& filename, const DefinesT& defines)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint shader = getShader(type, filename, defines);
+	if (shader == 0) return 0;
+
+	map<GLuint, GLuint>::const_iterator it = _Stages.find(shader);
+	if (it != _Stages.end())
+	{
+		_Statistics.stageHits++;
+		return it->second;
+	}
+
+	GLuint program = glCreateProgram();
+	glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+	glAttachShader(program, shader);
+	glLinkProgram(program);
+	UtilGLSL::checkProgramInfoLog(program);
+	glDetachShader(program, shader);
+
+	GLint successful = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &successful);
+	if (!successful)
+	{
+		cout << "Error: linking separable program " << filename << " (" << getPermutationKey(defines)
+			<< ")" << endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	_Statistics.stages++;
+	_Stages[shader] = program;
+	return program;
+}
+// ShaderPreprocessor::getStageProgram() //////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: getPipeline()
+// purpose:  Returns the program pipeline object that combines the separable stage programs of
+//           the shader files (one file per stage), or 0 on errors. Combinations that result
+//           in the same stage programs share one pipeline.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint ShaderPreprocessor::getPipeline(const vector<string>& filenames, const DefinesT& defines)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	vector<GLuint> programs;
+	vector<GLbitfield> stages;
+	for (size_t i = 0; i < filenames.size(); ++i)
+	{
+		GLenum type = getShaderType(filenames[i]);
+		GLuint program = type ? getStageProgram(type, filenames[i], defines) : 0;
+		if (program == 0)
+		{
+			if (type == 0) cout << "Error: Unknown shader file (" << filenames[i] << ")" << endl;
+			return 0;
+		}
+		programs.push_back(program);
+		stages.push_back(getStageBit(type));
+	}
+
+	// the key does not depend on the order of the files
+	vector<GLuint> key(programs);
+	sort(key.begin(), key.end());
+	map<vector<GLuint>, GLuint>::const_iterator it = _Pipelines.find(key);
+	if (it != _Pipelines.end())
+	{
+		_Statistics.pipelineHits++;
+		return it->second;
+	}
+
+	GLuint pipeline = 0;
+	glGenProgramPipelines(1, &pipeline);
+	for (size_t i = 0; i < programs.size(); ++i)
+	{
+		glUseProgramStages(pipeline, stages[i], programs[i]);
+	}
+
+	_Statistics.pipelines++;
+	_Pipelines[key] = pipeline;
+	return pipeline;
+}
+// ShaderPreprocessor::getPipeline() //////////////////////////////////////////////////////////////
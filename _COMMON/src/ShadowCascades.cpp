@@ -0,0 +1,484 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   ShadowCascades.cpp
+//
+//  \brief      Cascaded shadow maps of a directional light with cached static casters: the
+//              static part of every cascade is re-rendered only when the light or the static
+//              casters change and scrolled incrementally when the view moves.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/ShadowCascades.h"
+#include "../inc/StateTracker.h"
+#include "../inc/ErrorCheck.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const int ShadowCascades::MAX_CASCADES;
+const int ShadowCascades::QUERY_COUNT;
+
+
+
+ShadowCascades::ShadowCascades(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Cascades(0), _Size(0), _Caching(true), _Texture(0), _Scratch(0), _Framebuffer(0),
+  _Direction(0.0f), _BoundsMin(-1.0f), _BoundsMax(1.0f), _LightView(1.0f), _Near(-1.0f),
+  _Far(1.0f), _NextQuery(0)
+{
+	for (int c = 0; c < MAX_CASCADES; ++c)
+	{
+		_Static[c] = 0;
+		_Valid[c] = false;
+		_Origins[c] = glm::ivec2(0);
+		_TexelSize[c] = 0.0f;
+		_Matrices[c] = glm::mat4(1.0f);
+	}
+	for (int c = 0; c <= MAX_CASCADES; ++c) _Splits[c] = 0.0f;
+	for (int q = 0; q < 2 * QUERY_COUNT; ++q) _Queries[q] = 0;
+	for (int q = 0; q < QUERY_COUNT; ++q) _QueryStates[q] = 0;
+	_Statistics = StatisticsT();
+	setLightDirection(glm::vec3(-1.0f, -2.0f, -0.5f));
+}
+// ShadowCascades::ShadowCascades() ///////////////////////////////////////////////////////////////
+
+
+
+ShadowCascades::~ShadowCascades(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// ShadowCascades::~ShadowCascades() //////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  Creates the depth array texture of the cascades (32 bit float depth, comparison
+//           sampling with linear filtering for 2x2 PCF), one static map per cascade, the
+//           scroll scratch map and the framebuffer. Needs glCopyImageSubData() (OpenGL 4.3).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool ShadowCascades::init(int cascades, GLsizei size)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+	if (cascades < 1 || cascades > MAX_CASCADES || size < 16)
+	{
+		cout << "Error: invalid shadow cascades " << cascades << " x " << size << endl;
+		return false;
+	}
+	if (!GLEW_VERSION_4_3 && !GLEW_ARB_copy_image)
+	{
+		cout << "Error: shadow cascades need glCopyImageSubData() (OpenGL 4.3)" << endl;
+		return false;
+	}
+
+	_Cascades = cascades;
+	_Size = size;
+
+	glGenTextures(1, &_Texture);
+	StateTracker::bindTexture(GL_TEXTURE_2D_ARRAY, _Texture);
+	glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_DEPTH_COMPONENT32F, size, size, cascades);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+	glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+	// static maps and scratch map are only copied, never sampled
+	glGenTextures(cascades, _Static);
+	glGenTextures(1, &_Scratch);
+	for (int c = 0; c <= cascades; ++c)
+	{
+		StateTracker::bindTexture(GL_TEXTURE_2D, (c < cascades) ? _Static[c] : _Scratch);
+		glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH_COMPONENT32F, size, size);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	}
+
+	glGenFramebuffers(1, &_Framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, _Framebuffer);
+	glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, _Static[0], 0);
+	glDrawBuffer(GL_NONE);
+	glReadBuffer(GL_NONE);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (status != GL_FRAMEBUFFER_COMPLETE)
+	{
+		cout << "Error: shadow cascade framebuffer incomplete (0x" << hex << status << dec << ")"
+			<< endl;
+		release();
+		return false;
+	}
+
+	glGenQueries(2 * QUERY_COUNT, _Queries);
+	invalidate();
+
+	CG_GL_CHECK("ShadowCascades::init");
+	return true;
+}
+// ShadowCascades::init() /////////////////////////////////////////////////////////////////////////
+
+
+
+void ShadowCascades::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Framebuffer) glDeleteFramebuffers(1, &_Framebuffer);
+	if (_Texture) StateTracker::deleteTextures(1, &_Texture);
+	if (_Cascades) StateTracker::deleteTextures(_Cascades, _Static);
+	if (_Scratch) StateTracker::deleteTextures(1, &_Scratch);
+	if (_Queries[0]) glDeleteQueries(2 * QUERY_COUNT, _Queries);
+
+	for (int c = 0; c < MAX_CASCADES; ++c)
+	{
+		_Static[c] = 0;
+		_Valid[c] = false;
+	}
+	for (int q = 0; q < 2 * QUERY_COUNT; ++q) _Queries[q] = 0;
+	for (int q = 0; q < QUERY_COUNT; ++q) _QueryStates[q] = 0;
+	_Framebuffer = _Texture = _Scratch = 0;
+	_Cascades = 0;
+	_Size = 0;
+	_NextQuery = 0;
+	_Statistics = StatisticsT();
+}
+// ShadowCascades::release() //////////////////////////////////////////////////////////////////////
+
+
+
+void ShadowCascades::setLightDirection(const glm::vec3& direction)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::vec3 normalized = glm::normalize(direction);
+	if (normalized == _Direction) return;
+
+	_Direction = normalized;
+	setupLight();
+}
+// ShadowCascades::setLightDirection() ////////////////////////////////////////////////////////////
+
+
+
+void ShadowCascades::setCasterBounds(const glm::vec3& minimum, const glm::vec3& maximum)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (minimum == _BoundsMin && maximum == _BoundsMax) return;
+
+	_BoundsMin = minimum;
+	_BoundsMax = maximum;
+	setupLight();
+}
+// ShadowCascades::setCasterBounds() //////////////////////////////////////////////////////////////
+
+
+
+void ShadowCascades::invalidate(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int c = 0; c < MAX_CASCADES; ++c) _Valid[c] = false;
+}
+// ShadowCascades::invalidate() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: update()
+// purpose:  Fits the cascades to the view frustum splits and renders them. With caching a
+//           cascade re-renders its static map only when it is invalid or moved by a whole map,
+//           scrolls it when its snapped origin moved and keeps it otherwise; the layer is the
+//           static map plus the dynamic casters.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ShadowCascades::update(const glm::mat4& projection, const glm::mat4& view, DrawCastersT draw)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Framebuffer) return;
+	readQueries();
+
+	_Statistics.cascades = _Cascades;
+	_Statistics.rendered = _Statistics.scrolled = _Statistics.cached = 0;
+	_Statistics.texelsRendered = 0;
+	_Statistics.texels = size_t(_Cascades) * _Size * _Size;
+
+	// near and far plane of the perspective projection
+	if (projection[2][3] != -1.0f || projection[3][3] != 0.0f)
+	{
+		cout << "Error: shadow cascades need a perspective projection" << endl;
+		return;
+	}
+	float zNear = projection[3][2] / (projection[2][2] - 1.0f);
+	float zFar = projection[3][2] / (projection[2][2] + 1.0f);
+
+	// practical split scheme
+	const float lambda = 0.75f;
+	for (int c = 0; c <= _Cascades; ++c)
+	{
+		float t = float(c) / _Cascades;
+		float logarithmic = zNear * pow(zFar / zNear, t);
+		float uniform = zNear + (zFar - zNear) * t;
+		_Splits[c] = lambda * logarithmic + (1.0f - lambda) * uniform;
+	}
+
+	// tangents of the half field of view squared, for the split bounding spheres
+	float k2 = 1.0f / (projection[0][0] * projection[0][0])
+		+ 1.0f / (projection[1][1] * projection[1][1]);
+	glm::mat4 viewToLight = _LightView * glm::inverse(view);
+
+	int slot = _NextQuery;
+	bool timing = (_QueryStates[slot] == 0);
+	if (timing) glQueryCounter(_Queries[2 * slot], GL_TIMESTAMP);
+
+	GLint framebuffer = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &framebuffer);
+	glBindFramebuffer(GL_FRAMEBUFFER, _Framebuffer);
+	glViewport(0, 0, _Size, _Size);
+	StateTracker::enable(GL_DEPTH_TEST);
+	StateTracker::depthFunc(GL_LESS);
+	StateTracker::depthMask(GL_TRUE);
+	StateTracker::enable(GL_POLYGON_OFFSET_FILL);
+	glPolygonOffset(2.0f, 4.0f);
+
+	static const char* scopes[MAX_CASCADES] =
+	{
+		"shadow cascade 0", "shadow cascade 1", "shadow cascade 2", "shadow cascade 3"
+	};
+	for (int c = 0; c < _Cascades; ++c)
+	{
+		CG_GL_SCOPE(scopes[c]);
+
+		// smallest sphere around the split: its center lies on the view axis
+		float n = _Splits[c], f = _Splits[c + 1];
+		float z = min(f, 0.5f * (f + n) * (1.0f + k2));
+		float radius = sqrt((f - z) * (f - z) + f * f * k2);
+		glm::vec3 center = glm::vec3(viewToLight * glm::vec4(0.0f, 0.0f, -z, 1.0f));
+
+		// snap the origin to whole texels, so static texels stay valid when the view moves
+		float texel = 2.0f * radius / (_Size - 1);
+		glm::ivec2 origin(int(floor((center.x - radius) / texel)),
+			int(floor((center.y - radius) / texel)));
+		_Matrices[c] = glm::ortho(origin.x * texel, (origin.x + _Size) * texel,
+			origin.y * texel, (origin.y + _Size) * texel, _Near, _Far) * _LightView;
+
+		if (_Caching)
+		{
+			glm::ivec2 delta = origin - _Origins[c];
+			if (!_Valid[c] || texel != _TexelSize[c] || abs(delta.x) >= _Size
+				|| abs(delta.y) >= _Size)
+			{
+				_Origins[c] = origin;
+				_TexelSize[c] = texel;
+				renderRegion(c, 0, 0, _Size, _Size, draw);
+				_Valid[c] = true;
+				++_Statistics.rendered;
+			}
+			else if (delta != glm::ivec2(0))
+			{
+				scroll(c, delta, draw);
+				++_Statistics.scrolled;
+			}
+			else ++_Statistics.cached;
+
+			glCopyImageSubData(_Static[c], GL_TEXTURE_2D, 0, 0, 0, 0,
+				_Texture, GL_TEXTURE_2D_ARRAY, 0, 0, 0, c, _Size, _Size, 1);
+			glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, _Texture, 0, c);
+			draw(_Matrices[c], Frustum(_Matrices[c]), true);
+		}
+		else
+		{
+			_Valid[c] = false;
+			_Origins[c] = origin;
+			_TexelSize[c] = texel;
+			glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, _Texture, 0, c);
+			glClear(GL_DEPTH_BUFFER_BIT);
+			Frustum region(_Matrices[c]);
+			draw(_Matrices[c], region, false);
+			draw(_Matrices[c], region, true);
+			++_Statistics.rendered;
+			_Statistics.texelsRendered += size_t(_Size) * _Size;
+		}
+	}
+
+	StateTracker::disable(GL_POLYGON_OFFSET_FILL);
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+	if (timing)
+	{
+		glQueryCounter(_Queries[2 * slot + 1], GL_TIMESTAMP);
+		_QueryStates[slot] = (_Statistics.rendered == _Cascades) ? 2 : 1;
+		_NextQuery = (slot + 1) % QUERY_COUNT;
+	}
+}
+// ShadowCascades::update() ///////////////////////////////////////////////////////////////////////
+
+
+
+void ShadowCascades::bind(GLuint unit) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StateTracker::activeTexture(GL_TEXTURE0 + unit);
+	StateTracker::bindTexture(GL_TEXTURE_2D_ARRAY, _Texture);
+}
+// ShadowCascades::bind() /////////////////////////////////////////////////////////////////////////
+
+
+
+void ShadowCascades::report(ostream& out) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const StatisticsT& s = _Statistics;
+	out << "Shadow cascades (" << (_Caching ? "cached" : "uncached") << "): " << s.cascades
+		<< " x " << _Size << "^2, " << s.rendered << " rendered, " << s.scrolled
+		<< " scrolled, " << s.cached << " cached, " << fixed << setprecision(1)
+		<< (s.texels ? 100.0 * s.texelsRendered / s.texels : 0.0) << " % static texels, GPU "
+		<< setprecision(3) << s.milliseconds << " ms";
+	if (s.fullMilliseconds > 0.0)
+	{
+		out << " (" << setprecision(1) << 100.0 * s.milliseconds / s.fullMilliseconds
+			<< " % of a full re-render with " << setprecision(3) << s.fullMilliseconds << " ms)";
+	}
+	out << endl;
+}
+// ShadowCascades::report() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: setupLight()
+// purpose:  Light space looks along the light direction; the depth range covers the caster
+//           bounds, so casters outside of the view still throw their shadows into it.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ShadowCascades::setupLight(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::vec3 up = (fabs(_Direction.y) > 0.99f) ? glm::vec3(0.0f, 0.0f, 1.0f)
+		: glm::vec3(0.0f, 1.0f, 0.0f);
+	_LightView = glm::lookAt(glm::vec3(0.0f), _Direction, up);
+
+	// view depth along -z: near is the largest z of the box corners in light space
+	float zMin = FLT_MAX, zMax = -FLT_MAX;
+	for (int i = 0; i < 8; ++i)
+	{
+		glm::vec3 corner((i & 1) ? _BoundsMax.x : _BoundsMin.x,
+			(i & 2) ? _BoundsMax.y : _BoundsMin.y, (i & 4) ? _BoundsMax.z : _BoundsMin.z);
+		float z = (_LightView * glm::vec4(corner, 1.0f)).z;
+		zMin = min(zMin, z);
+		zMax = max(zMax, z);
+	}
+	float margin = 0.01f * (zMax - zMin) + 0.01f;
+	_Near = -zMax - margin;
+	_Far = -zMin + margin;
+	invalidate();
+}
+// ShadowCascades::setupLight() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: renderRegion()
+// purpose:  Renders the static casters into the texels [x0, x1) x [y0, y1) of the static map
+//           of a cascade: the region is cleared with a scissor and the callback gets the
+//           frustum of the region to skip all casters outside of it.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ShadowCascades::renderRegion(int cascade, int x0, int y0, int x1, int y1,
+	DrawCastersT draw)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glFramebufferTexture(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, _Static[cascade], 0);
+	StateTracker::enable(GL_SCISSOR_TEST);
+	glScissor(x0, y0, x1 - x0, y1 - y0);
+	glClear(GL_DEPTH_BUFFER_BIT);
+
+	const glm::ivec2& origin = _Origins[cascade];
+	float texel = _TexelSize[cascade];
+	Frustum region(glm::ortho((origin.x + x0) * texel, (origin.x + x1) * texel,
+		(origin.y + y0) * texel, (origin.y + y1) * texel, _Near, _Far) * _LightView);
+	draw(_Matrices[cascade], region, false);
+
+	StateTracker::disable(GL_SCISSOR_TEST);
+	_Statistics.texelsRendered += size_t(x1 - x0) * (y1 - y0);
+}
+// ShadowCascades::renderRegion() /////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: scroll()
+// purpose:  Moves the origin of a static map by delta texels: the overlap of the old and the
+//           new map is copied into the scratch map, which becomes the static map, and the
+//           exposed columns (full height) and rows (remaining width) are rendered.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ShadowCascades::scroll(int cascade, const glm::ivec2& delta, DrawCastersT draw)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int dx = delta.x, dy = delta.y;
+	glCopyImageSubData(_Static[cascade], GL_TEXTURE_2D, 0, max(dx, 0), max(dy, 0), 0,
+		_Scratch, GL_TEXTURE_2D, 0, max(-dx, 0), max(-dy, 0), 0,
+		_Size - abs(dx), _Size - abs(dy), 1);
+	swap(_Static[cascade], _Scratch);
+	_Origins[cascade] += delta;
+
+	if (dx > 0) renderRegion(cascade, _Size - dx, 0, _Size, _Size, draw);
+	else if (dx < 0) renderRegion(cascade, 0, 0, -dx, _Size, draw);
+
+	int x0 = max(-dx, 0), x1 = _Size - max(dx, 0);
+	if (dy > 0) renderRegion(cascade, x0, _Size - dy, x1, _Size, draw);
+	else if (dy < 0) renderRegion(cascade, x0, 0, x1, -dy, draw);
+}
+// ShadowCascades::scroll() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: readQueries()
+// purpose:  Collects the finished timestamp pairs in submission order without waiting; a pair
+//           of an update() that re-rendered all cascades is the reference for the others.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void ShadowCascades::readQueries(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < QUERY_COUNT; ++i)
+	{
+		int slot = (_NextQuery + i) % QUERY_COUNT;
+		if (!_QueryStates[slot]) continue;
+
+		GLint available = 0;
+		glGetQueryObjectiv(_Queries[2 * slot + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) break;
+
+		GLuint64 start = 0, end = 0;
+		glGetQueryObjectui64v(_Queries[2 * slot], GL_QUERY_RESULT, &start);
+		glGetQueryObjectui64v(_Queries[2 * slot + 1], GL_QUERY_RESULT, &end);
+		_Statistics.milliseconds = (end - start) * 1.0e-6;
+		if (_QueryStates[slot] == 2) _Statistics.fullMilliseconds = _Statistics.milliseconds;
+		_QueryStates[slot] = 0;
+	}
+}
+// ShadowCascades::readQueries() //////////////////////////////////////////////////////////////////
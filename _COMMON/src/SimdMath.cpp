@@ -0,0 +1,314 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   SimdMath.cpp
+//
+//  \brief      Runtime dispatched versions of the hot GLM math paths (matrix multiply and
+//              inverse, quaternion products and batch transforms).
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+#include <immintrin.h>
+#include <glm/simd/matrix.h>
+#define SIMDMATH_USE_SSE 1
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/SimdMath.h"
+
+
+
+// inline all GLM helpers into the wider variants, so they get compiled for that target as well
+#if defined(__GNUC__)
+#define SIMDMATH_FLATTEN __attribute__((flatten))
+#else
+#define SIMDMATH_FLATTEN
+#endif
+
+
+
+namespace
+{
+	struct KernelsT
+	{
+		void (*multiply)(const float* a, const float* b, float* out);
+		void (*inverse)(const float* m, float* out);
+		void (*multiplyQuat)(const float* p, size_t pStride, const float* q, float* out, size_t count);
+	};
+
+
+	// scalar reference kernels (GLM operators) ///////////////////////////////////////////////////
+	void multiplyScalar(const float* a, const float* b, float* out)
+	{
+		glm::mat4 product = glm::make_mat4(a) * glm::make_mat4(b);
+		for (int k = 0; k < 16; ++k) out[k] = glm::value_ptr(product)[k];
+	}
+
+	void inverseScalar(const float* m, float* out)
+	{
+		glm::mat4 inverse = glm::inverse(glm::make_mat4(m));
+		for (int k = 0; k < 16; ++k) out[k] = glm::value_ptr(inverse)[k];
+	}
+
+	void multiplyQuatScalar(const float* p, size_t pStride, const float* q, float* out, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i, p += pStride, q += 4, out += 4)
+		{
+			glm::quat r = glm::quat(p[3], p[0], p[1], p[2]) * glm::quat(q[3], q[0], q[1], q[2]);
+			out[0] = r.x; out[1] = r.y; out[2] = r.z; out[3] = r.w;
+		}
+	}
+
+#if SIMDMATH_USE_SSE && CG_SIMD_X86
+
+	// quaternion product p * q with (x, y, z, w) lanes:
+	//   p.w * (qx, qy, qz, qw) + p.x * (qw, -qz, qy, -qx) + p.y * (qz, qw, -qx, -qy)
+	//   + p.z * (-qy, qx, qw, -qz)
+	// the signs are folded into the broadcast components of p
+
+	// column c of a * b is the sum of the columns of a weighted by the components of column c of b
+
+	// SSE2 kernels (GLM's own SSE code paths) ////////////////////////////////////////////////////
+	void multiplySSE2(const float* a, const float* b, float* out)
+	{
+		__m128 a0 = _mm_loadu_ps(a), a1 = _mm_loadu_ps(a + 4), a2 = _mm_loadu_ps(a + 8), a3 = _mm_loadu_ps(a + 12);
+		for (int c = 0; c < 4; ++c)
+		{
+			__m128 bc = _mm_loadu_ps(b + 4 * c);
+			__m128 r = _mm_mul_ps(a0, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(0, 0, 0, 0)));
+			r = _mm_add_ps(r, _mm_mul_ps(a1, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(1, 1, 1, 1))));
+			r = _mm_add_ps(r, _mm_mul_ps(a2, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(2, 2, 2, 2))));
+			r = _mm_add_ps(r, _mm_mul_ps(a3, _mm_shuffle_ps(bc, bc, _MM_SHUFFLE(3, 3, 3, 3))));
+			_mm_storeu_ps(out + 4 * c, r);
+		}
+	}
+
+	void inverseSSE2(const float* m, float* out)
+	{
+		__m128 in[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+		__m128 result[4];
+		glm_mat4_inverse(in, result);
+		for (int c = 0; c < 4; ++c) _mm_storeu_ps(out + 4 * c, result[c]);
+	}
+
+	void multiplyQuatSSE2(const float* p, size_t pStride, const float* q, float* out, size_t count)
+	{
+		const __m128 signX = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+		const __m128 signY = _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f);
+		const __m128 signZ = _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f);
+
+		for (size_t i = 0; i < count; ++i, p += pStride, q += 4, out += 4)
+		{
+			__m128 pv = _mm_loadu_ps(p);
+			__m128 qv = _mm_loadu_ps(q);
+			__m128 r = _mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(3, 3, 3, 3)), qv);
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(0, 0, 0, 0)), signX),
+				_mm_shuffle_ps(qv, qv, _MM_SHUFFLE(0, 1, 2, 3))));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(1, 1, 1, 1)), signY),
+				_mm_shuffle_ps(qv, qv, _MM_SHUFFLE(1, 0, 3, 2))));
+			r = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(pv, pv, _MM_SHUFFLE(2, 2, 2, 2)), signZ),
+				_mm_shuffle_ps(qv, qv, _MM_SHUFFLE(2, 3, 0, 1))));
+			_mm_storeu_ps(out, r);
+		}
+	}
+
+
+	// AVX2 kernels: two columns or quaternions per register, VEX encoded GLM inverse with FMA /////
+	CG_TARGET_AVX2 void multiplyAVX2(const float* a, const float* b, float* out)
+	{
+		__m256 a0 = _mm256_broadcast_ps((const __m128*) a);
+		__m256 a1 = _mm256_broadcast_ps((const __m128*) (a + 4));
+		__m256 a2 = _mm256_broadcast_ps((const __m128*) (a + 8));
+		__m256 a3 = _mm256_broadcast_ps((const __m128*) (a + 12));
+		for (int c = 0; c < 4; c += 2)
+		{
+			__m256 bc = _mm256_loadu_ps(b + 4 * c);
+			__m256 r = _mm256_mul_ps(a0, _mm256_permute_ps(bc, 0x00));
+			r = _mm256_fmadd_ps(a1, _mm256_permute_ps(bc, 0x55), r);
+			r = _mm256_fmadd_ps(a2, _mm256_permute_ps(bc, 0xaa), r);
+			_mm256_storeu_ps(out + 4 * c, _mm256_fmadd_ps(a3, _mm256_permute_ps(bc, 0xff), r));
+		}
+	}
+
+	CG_TARGET_AVX2 SIMDMATH_FLATTEN void inverseAVX2(const float* m, float* out)
+	{
+		__m128 in[4] = { _mm_loadu_ps(m), _mm_loadu_ps(m + 4), _mm_loadu_ps(m + 8), _mm_loadu_ps(m + 12) };
+		__m128 result[4];
+		glm_mat4_inverse(in, result);
+		for (int c = 0; c < 4; ++c) _mm_storeu_ps(out + 4 * c, result[c]);
+	}
+
+	CG_TARGET_AVX2 inline __m256 multiplyQuatAVX2(__m256 pv, __m256 qv)
+	{
+		const __m256 signX = _mm256_setr_ps(1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f);
+		const __m256 signY = _mm256_setr_ps(1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f);
+		const __m256 signZ = _mm256_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f);
+
+		__m256 r = _mm256_mul_ps(_mm256_permute_ps(pv, 0xff), qv);
+		r = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_permute_ps(pv, 0x00), signX), _mm256_permute_ps(qv, 0x1b), r);
+		r = _mm256_fmadd_ps(_mm256_mul_ps(_mm256_permute_ps(pv, 0x55), signY), _mm256_permute_ps(qv, 0x4e), r);
+		return _mm256_fmadd_ps(_mm256_mul_ps(_mm256_permute_ps(pv, 0xaa), signZ), _mm256_permute_ps(qv, 0xb1), r);
+	}
+
+	CG_TARGET_AVX2 void multiplyQuatAVX2(const float* p, size_t pStride, const float* q, float* out, size_t count)
+	{
+		size_t i = 0;
+		if (pStride == 0)
+		{
+			__m256 pv = _mm256_broadcast_ps((const __m128*) p);
+			for (; i + 2 <= count; i += 2)
+			{
+				_mm256_storeu_ps(out + 4 * i, multiplyQuatAVX2(pv, _mm256_loadu_ps(q + 4 * i)));
+			}
+		}
+		else
+		{
+			for (; i + 2 <= count; i += 2)
+			{
+				__m256 pv = _mm256_loadu_ps(p + 4 * i);
+				_mm256_storeu_ps(out + 4 * i, multiplyQuatAVX2(pv, _mm256_loadu_ps(q + 4 * i)));
+			}
+		}
+		multiplyQuatSSE2(p + pStride * i, pStride, q + 4 * i, out + 4 * i, count - i);
+	}
+
+
+	// AVX-512 kernels: the whole product or four quaternions per register ///////////////////////
+	CG_TARGET_AVX512 void multiplyAVX512(const float* a, const float* b, float* out)
+	{
+		__m512 bv = _mm512_loadu_ps(b);
+		__m512 r = _mm512_mul_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a)), _mm512_permute_ps(bv, 0x00));
+		r = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a + 4)), _mm512_permute_ps(bv, 0x55), r);
+		r = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a + 8)), _mm512_permute_ps(bv, 0xaa), r);
+		r = _mm512_fmadd_ps(_mm512_broadcast_f32x4(_mm_loadu_ps(a + 12)), _mm512_permute_ps(bv, 0xff), r);
+		_mm512_storeu_ps(out, r);
+	}
+
+	CG_TARGET_AVX512 void multiplyQuatAVX512(const float* p, size_t pStride, const float* q, float* out, size_t count)
+	{
+		const __m512 signX = _mm512_broadcast_f32x4(_mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f));
+		const __m512 signY = _mm512_broadcast_f32x4(_mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f));
+		const __m512 signZ = _mm512_broadcast_f32x4(_mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f));
+		__m512 fixed = _mm512_setzero_ps();
+		if (pStride == 0 && count > 0) fixed = _mm512_broadcast_f32x4(_mm_loadu_ps(p));
+
+		for (size_t i = 0; i < count; i += 4)
+		{
+			__mmask16 mask = (count - i >= 4) ? __mmask16(0xffff) : __mmask16((1u << (4 * (count - i))) - 1);
+			__m512 pv = (pStride == 0) ? fixed : _mm512_maskz_loadu_ps(mask, p + 4 * i);
+			__m512 qv = _mm512_maskz_loadu_ps(mask, q + 4 * i);
+
+			__m512 r = _mm512_mul_ps(_mm512_permute_ps(pv, 0xff), qv);
+			r = _mm512_fmadd_ps(_mm512_mul_ps(_mm512_permute_ps(pv, 0x00), signX), _mm512_permute_ps(qv, 0x1b), r);
+			r = _mm512_fmadd_ps(_mm512_mul_ps(_mm512_permute_ps(pv, 0x55), signY), _mm512_permute_ps(qv, 0x4e), r);
+			r = _mm512_fmadd_ps(_mm512_mul_ps(_mm512_permute_ps(pv, 0xaa), signZ), _mm512_permute_ps(qv, 0xb1), r);
+			_mm512_mask_storeu_ps(out + 4 * i, mask, r);
+		}
+	}
+
+#endif // SIMDMATH_USE_SSE && CG_SIMD_X86
+
+
+	// kernel sets indexed by CpuInfo::SimdLevelT, the AVX-512 level inverts with the AVX2 kernel
+	const KernelsT KERNELS[] =
+	{
+		{ multiplyScalar, inverseScalar, multiplyQuatScalar },
+#if SIMDMATH_USE_SSE && CG_SIMD_X86
+		{ multiplySSE2, inverseSSE2, multiplyQuatSSE2 },
+		{ multiplyAVX2, inverseAVX2, multiplyQuatAVX2 },
+		{ multiplyAVX512, inverseAVX2, multiplyQuatAVX512 },
+#endif
+	};
+
+	inline const KernelsT& getKernels(void)
+	{
+		int level = SimdMath::getLevel();
+		return KERNELS[level < int(sizeof(KERNELS) / sizeof(KERNELS[0])) ? level : 0];
+	}
+}
+
+
+
+glm::mat4 SimdMath::multiply(const glm::mat4& a, const glm::mat4& b)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::mat4 result;
+	getKernels().multiply(glm::value_ptr(a), glm::value_ptr(b), glm::value_ptr(result));
+	return result;
+}
+// SimdMath::multiply() ///////////////////////////////////////////////////////////////////////////
+
+
+
+glm::mat4 SimdMath::inverse(const glm::mat4& m)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::mat4 result;
+	getKernels().inverse(glm::value_ptr(m), glm::value_ptr(result));
+	return result;
+}
+// SimdMath::inverse() ////////////////////////////////////////////////////////////////////////////
+
+
+
+glm::quat SimdMath::multiply(const glm::quat& p, const glm::quat& q)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	glm::quat result;
+	getKernels().multiplyQuat(&p.x, 4, &q.x, &result.x, 1);
+	return result;
+}
+// SimdMath::multiply() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: multiply()
+// purpose:  out[i] = p * q[i], e.g. to rotate the orientations of many instances at once.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void SimdMath::multiply(const glm::quat& p, const glm::quat* q, glm::quat* out, size_t count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	getKernels().multiplyQuat(&p.x, 0, (const float*) q, (float*) out, count);
+}
+// SimdMath::multiply() ///////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: multiply()
+// purpose:  out[i] = p[i] * q[i] for quaternion arrays.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void SimdMath::multiply(const glm::quat* p, const glm::quat* q, glm::quat* out, size_t count)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	getKernels().multiplyQuat((const float*) p, 4, (const float*) q, (float*) out, count);
+}
+// SimdMath::multiply() ///////////////////////////////////////////////////////////////////////////
+
+
+
+CpuInfo::SimdLevelT SimdMath::getLevel(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return CpuInfo::getLevel();
+}
+// SimdMath::getLevel() ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,502 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   StateTracker.cpp
+//
+//  \brief      Thin layer over the OpenGL state calls that shadows the bound objects and the
+//              fixed function state and drops calls that would not change anything.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iomanip>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/StateTracker.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const int    StateTracker::MAX_TEXTURE_UNITS;
+const GLuint StateTracker::UNKNOWN;
+const int    StateTracker::BUFFER_TARGETS;
+const int    StateTracker::TEXTURE_TARGETS;
+const int    StateTracker::CAPABILITIES;
+
+bool    StateTracker::_Enabled = true;
+StateTracker::StatisticsT StateTracker::_Frame = { { 0 }, { 0 } };
+StateTracker::StatisticsT StateTracker::_LastFrame = { { 0 }, { 0 } };
+StateTracker::StatisticsT StateTracker::_Total = { { 0 }, { 0 } };
+
+GLuint  StateTracker::_Program = StateTracker::UNKNOWN;
+GLuint  StateTracker::_Pipeline = StateTracker::UNKNOWN;
+GLuint  StateTracker::_VertexArray = StateTracker::UNKNOWN;
+GLuint  StateTracker::_Buffers[StateTracker::BUFFER_TARGETS];
+GLuint  StateTracker::_ActiveTexture = StateTracker::UNKNOWN;
+GLuint  StateTracker::_Textures[StateTracker::MAX_TEXTURE_UNITS][StateTracker::TEXTURE_TARGETS];
+GLuint  StateTracker::_Capabilities[StateTracker::CAPABILITIES];
+GLuint  StateTracker::_BlendFunc[2];
+GLuint  StateTracker::_DepthFunc = StateTracker::UNKNOWN;
+GLuint  StateTracker::_DepthMask = StateTracker::UNKNOWN;
+GLuint  StateTracker::_PolygonMode[2];
+GLfloat StateTracker::_ClearColor[4];
+bool    StateTracker::_ClearColorKnown = false;
+
+
+
+namespace
+{
+	// the shadow arrays start unknown as well
+	struct InitializerT
+	{
+		InitializerT(void) { StateTracker::invalidate(); }
+	} initializer;
+}
+
+
+
+size_t StateTracker::StatisticsT::getIssued(void) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t sum = 0;
+	for (int i = 0; i < CALL_COUNT; ++i) sum += issued[i];
+	return sum;
+}
+// StateTracker::StatisticsT::getIssued() /////////////////////////////////////////////////////////
+
+
+
+size_t StateTracker::StatisticsT::getElided(void) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	size_t sum = 0;
+	for (int i = 0; i < CALL_COUNT; ++i) sum += elided[i];
+	return sum;
+}
+// StateTracker::StatisticsT::getElided() /////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: invalidate()
+// purpose:  Forgets the shadowed state, the next call of every kind is issued.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void StateTracker::invalidate(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Program = _Pipeline = _VertexArray = _ActiveTexture = UNKNOWN;
+	for (int i = 0; i < BUFFER_TARGETS; ++i) _Buffers[i] = UNKNOWN;
+	for (int unit = 0; unit < MAX_TEXTURE_UNITS; ++unit)
+	{
+		for (int i = 0; i < TEXTURE_TARGETS; ++i) _Textures[unit][i] = UNKNOWN;
+	}
+	for (int i = 0; i < CAPABILITIES; ++i) _Capabilities[i] = UNKNOWN;
+	_BlendFunc[0] = _BlendFunc[1] = UNKNOWN;
+	_DepthFunc = _DepthMask = UNKNOWN;
+	_PolygonMode[0] = _PolygonMode[1] = UNKNOWN;
+	_ClearColorKnown = false;
+}
+// StateTracker::invalidate() /////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::useProgram(GLuint program)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (filter(CALL_PROGRAM, program == _Program)) return;
+	glUseProgram(program);
+	_Program = program;
+}
+// StateTracker::useProgram() /////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::bindProgramPipeline(GLuint pipeline)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (filter(CALL_PIPELINE, pipeline == _Pipeline)) return;
+	glBindProgramPipeline(pipeline);
+	_Pipeline = pipeline;
+}
+// StateTracker::bindProgramPipeline() ////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::bindVertexArray(GLuint vertexArray)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (filter(CALL_VERTEX_ARRAY, vertexArray == _VertexArray)) return;
+	glBindVertexArray(vertexArray);
+	_VertexArray = vertexArray;
+
+	// the element array buffer binding is part of the vertex array
+	_Buffers[getBufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+}
+// StateTracker::bindVertexArray() ////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::bindBuffer(GLenum target, GLuint buffer)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int index = getBufferIndex(target);
+	if (filter(CALL_BUFFER, (index >= 0) && (buffer == _Buffers[index]))) return;
+	glBindBuffer(target, buffer);
+	if (index >= 0) _Buffers[index] = buffer;
+}
+// StateTracker::bindBuffer() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: bindBufferBase()
+// purpose:  Indexed bindings are not shadowed and always issued, but they change the generic
+//           binding point of the target too.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void StateTracker::bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	filter(CALL_BUFFER, false);
+	glBindBufferBase(target, index, buffer);
+	int generic = getBufferIndex(target);
+	if (generic >= 0) _Buffers[generic] = buffer;
+}
+// StateTracker::bindBufferBase() /////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::activeTexture(GLenum unit)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (filter(CALL_ACTIVE_TEXTURE, unit - GL_TEXTURE0 == _ActiveTexture)) return;
+	glActiveTexture(unit);
+	GLuint index = unit - GL_TEXTURE0;
+	_ActiveTexture = (index < GLuint(MAX_TEXTURE_UNITS)) ? index : UNKNOWN;
+}
+// StateTracker::activeTexture() //////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::bindTexture(GLenum target, GLuint texture)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int index = getTextureIndex(target);
+	bool known = (index >= 0) && (_ActiveTexture != UNKNOWN);
+	if (filter(CALL_TEXTURE, known && (texture == _Textures[_ActiveTexture][index]))) return;
+	glBindTexture(target, texture);
+	if (known) _Textures[_ActiveTexture][index] = texture;
+}
+// StateTracker::bindTexture() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: deleteBuffers()
+// purpose:  Deletes the buffers, bindings of a deleted buffer revert to 0 (that includes the
+//           element array buffer of the bound vertex array).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void StateTracker::deleteBuffers(GLsizei count, const GLuint* buffers)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (GLsizei i = 0; i < count; ++i)
+	{
+		for (int target = 0; target < BUFFER_TARGETS; ++target)
+		{
+			if (buffers[i] != 0 && _Buffers[target] == buffers[i]) _Buffers[target] = 0;
+		}
+	}
+	glDeleteBuffers(count, buffers);
+}
+// StateTracker::deleteBuffers() //////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::deleteTextures(GLsizei count, const GLuint* textures)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (GLsizei i = 0; i < count; ++i)
+	{
+		for (int unit = 0; unit < MAX_TEXTURE_UNITS; ++unit)
+		{
+			for (int target = 0; target < TEXTURE_TARGETS; ++target)
+			{
+				GLuint& bound = _Textures[unit][target];
+				if (textures[i] != 0 && bound == textures[i]) bound = 0;
+			}
+		}
+	}
+	glDeleteTextures(count, textures);
+}
+// StateTracker::deleteTextures() /////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::deleteVertexArrays(GLsizei count, const GLuint* vertexArrays)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (GLsizei i = 0; i < count; ++i)
+	{
+		if (vertexArrays[i] != 0 && _VertexArray == vertexArrays[i])
+		{
+			_VertexArray = 0;
+			_Buffers[getBufferIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+		}
+	}
+	glDeleteVertexArrays(count, vertexArrays);
+}
+// StateTracker::deleteVertexArrays() /////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::deleteProgramPipelines(GLsizei count, const GLuint* pipelines)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (GLsizei i = 0; i < count; ++i)
+	{
+		if (pipelines[i] != 0 && _Pipeline == pipelines[i]) _Pipeline = 0;
+	}
+	glDeleteProgramPipelines(count, pipelines);
+}
+// StateTracker::deleteProgramPipelines() /////////////////////////////////////////////////////////
+
+
+
+void StateTracker::enable(GLenum capability)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	setCapability(capability, true);
+}
+// StateTracker::enable() /////////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::disable(GLenum capability)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	setCapability(capability, false);
+}
+// StateTracker::disable() ////////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::setCapability(GLenum capability, bool enabled)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int index = getCapabilityIndex(capability);
+	GLuint state = enabled ? GL_TRUE : GL_FALSE;
+	if (filter(CALL_CAPABILITY, (index >= 0) && (_Capabilities[index] == state))) return;
+	if (enabled) glEnable(capability);
+	else glDisable(capability);
+	if (index >= 0) _Capabilities[index] = state;
+}
+// StateTracker::setCapability() //////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::blendFunc(GLenum source, GLenum destination)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (filter(CALL_BLEND, (source == _BlendFunc[0]) && (destination == _BlendFunc[1]))) return;
+	glBlendFunc(source, destination);
+	_BlendFunc[0] = source;
+	_BlendFunc[1] = destination;
+}
+// StateTracker::blendFunc() //////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::depthFunc(GLenum function)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (filter(CALL_DEPTH, function == _DepthFunc)) return;
+	glDepthFunc(function);
+	_DepthFunc = function;
+}
+// StateTracker::depthFunc() //////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::depthMask(GLboolean flag)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint mask = flag ? GL_TRUE : GL_FALSE;
+	if (filter(CALL_DEPTH, mask == _DepthMask)) return;
+	glDepthMask(flag);
+	_DepthMask = mask;
+}
+// StateTracker::depthMask() //////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: polygonMode()
+// purpose:  Front and back modes are shadowed separately (GL_FRONT/GL_BACK are only accepted
+//           by compatibility profiles, core profiles set both with GL_FRONT_AND_BACK).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void StateTracker::polygonMode(GLenum face, GLenum mode)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	bool front = (face == GL_FRONT) || (face == GL_FRONT_AND_BACK);
+	bool back = (face == GL_BACK) || (face == GL_FRONT_AND_BACK);
+	bool unchanged = (front || back) && (!front || _PolygonMode[0] == mode) &&
+		(!back || _PolygonMode[1] == mode);
+	if (filter(CALL_POLYGON_MODE, unchanged)) return;
+	glPolygonMode(face, mode);
+	if (front) _PolygonMode[0] = mode;
+	if (back) _PolygonMode[1] = mode;
+}
+// StateTracker::polygonMode() ////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	bool unchanged = _ClearColorKnown && (red == _ClearColor[0]) && (green == _ClearColor[1]) &&
+		(blue == _ClearColor[2]) && (alpha == _ClearColor[3]);
+	if (filter(CALL_CLEAR_COLOR, unchanged)) return;
+	glClearColor(red, green, blue, alpha);
+	_ClearColor[0] = red;
+	_ClearColor[1] = green;
+	_ClearColor[2] = blue;
+	_ClearColor[3] = alpha;
+	_ClearColorKnown = true;
+}
+// StateTracker::clearColor() /////////////////////////////////////////////////////////////////////
+
+
+
+void StateTracker::beginFrame(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < CALL_COUNT; ++i)
+	{
+		_Total.issued[i] += _Frame.issued[i];
+		_Total.elided[i] += _Frame.elided[i];
+	}
+	_LastFrame = _Frame;
+	_Frame = StatisticsT();
+}
+// StateTracker::beginFrame() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: report()
+// purpose:  Prints issued and elided calls per call type of the last frame and of all frames.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void StateTracker::report(ostream& out)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const char* names[CALL_COUNT] =
+	{
+		"program", "pipeline", "vertex array", "buffer", "active texture", "texture",
+		"capability", "blend", "depth", "polygon mode", "clear color"
+	};
+
+	out << "State Tracker: " << (_Enabled ? "filtering" : "pass through") << ", last frame "
+		<< _LastFrame.getIssued() << " issued, " << _LastFrame.getElided() << " elided" << endl;
+	out << "   call               frame issued  elided    total issued   elided  elided %" << endl;
+	out << fixed << setprecision(1);
+	for (int i = 0; i < CALL_COUNT; ++i)
+	{
+		size_t total = _Total.issued[i] + _Total.elided[i];
+		if (total == 0) continue;
+		out << "   " << left << setw(16) << names[i] << right << setw(15) << _LastFrame.issued[i]
+			<< setw(8) << _LastFrame.elided[i] << setw(16) << _Total.issued[i]
+			<< setw(9) << _Total.elided[i] << setw(10) << 100.0 * _Total.elided[i] / total << endl;
+	}
+	out.unsetf(ios::floatfield);
+}
+// StateTracker::report() /////////////////////////////////////////////////////////////////////////
+
+
+
+int StateTracker::getBufferIndex(GLenum target)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const GLenum targets[BUFFER_TARGETS] =
+	{
+		GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER, GL_SHADER_STORAGE_BUFFER,
+		GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_DRAW_INDIRECT_BUFFER,
+		GL_DISPATCH_INDIRECT_BUFFER, GL_ATOMIC_COUNTER_BUFFER, GL_COPY_READ_BUFFER,
+		GL_COPY_WRITE_BUFFER, GL_TEXTURE_BUFFER, GL_TRANSFORM_FEEDBACK_BUFFER, GL_QUERY_BUFFER
+	};
+	for (int i = 0; i < BUFFER_TARGETS; ++i)
+	{
+		if (targets[i] == target) return i;
+	}
+	return -1;
+}
+// StateTracker::getBufferIndex() /////////////////////////////////////////////////////////////////
+
+
+
+int StateTracker::getTextureIndex(GLenum target)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const GLenum targets[TEXTURE_TARGETS] =
+	{
+		GL_TEXTURE_2D, GL_TEXTURE_3D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_1D,
+		GL_TEXTURE_1D_ARRAY, GL_TEXTURE_CUBE_MAP_ARRAY, GL_TEXTURE_2D_MULTISAMPLE,
+		GL_TEXTURE_BUFFER
+	};
+	for (int i = 0; i < TEXTURE_TARGETS; ++i)
+	{
+		if (targets[i] == target) return i;
+	}
+	return -1;
+}
+// StateTracker::getTextureIndex() ////////////////////////////////////////////////////////////////
+
+
+
+int StateTracker::getCapabilityIndex(GLenum capability)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const GLenum capabilities[CAPABILITIES] =
+	{
+		GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_STENCIL_TEST, GL_SCISSOR_TEST,
+		GL_POLYGON_OFFSET_FILL, GL_MULTISAMPLE, GL_PROGRAM_POINT_SIZE, GL_PRIMITIVE_RESTART,
+		GL_FRAMEBUFFER_SRGB, GL_RASTERIZER_DISCARD
+	};
+	for (int i = 0; i < CAPABILITIES; ++i)
+	{
+		if (capabilities[i] == capability) return i;
+	}
+	return -1;
+}
+// StateTracker::getCapabilityIndex() /////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: filter()
+// purpose:  Counts the call and returns true if it can be dropped.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool StateTracker::filter(CallT call, bool unchanged)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Enabled && unchanged)
+	{
+		_Frame.elided[call]++;
+		return true;
+	}
+	_Frame.issued[call]++;
+	return false;
+}
+// StateTracker::filter() /////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,255 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   TessellatedTerrain.cpp
+//
+//  \brief      GPU driven adaptive tessellation of a terrain: a coarse grid of quad patches is
+//              subdivided by the tessellation stages so that the triangle density follows the
+//              screen space size of the terrain instead of a fixed mesh resolution.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/TessellatedTerrain.h"
+#include "../inc/StateTracker.h"
+#include "../inc/ErrorCheck.h"
+
+
+#define BUFFER_OFFSET( offset )   ((GLvoid*) (offset))
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const int TessellatedTerrain::QUERY_COUNT;
+
+
+
+TessellatedTerrain::TessellatedTerrain(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Program(0), _VertexArray(0), _IndexCount(0), _Extent(0.0f), _Height(0.0f), _NextQuery(0)
+{
+	_Buffers[0] = _Buffers[1] = 0;
+	for (int u = 0; u < U_COUNT; ++u) _Locations[u] = -1;
+	for (int q = 0; q < QUERY_COUNT; ++q)
+	{
+		_Queries[q] = 0;
+		_Pending[q] = false;
+	}
+	_Statistics = StatisticsT();
+	_Statistics.pixelsPerEdge = 8.0f;
+	_Statistics.culling = true;
+}
+// TessellatedTerrain::TessellatedTerrain() ///////////////////////////////////////////////////////
+
+
+
+TessellatedTerrain::~TessellatedTerrain(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// TessellatedTerrain::~TessellatedTerrain() //////////////////////////////////////////////////////
+
+
+
+bool TessellatedTerrain::init(GLuint program, int patches, float extent, float height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+	if (!GLEW_VERSION_4_0 && !GLEW_ARB_tessellation_shader)
+	{
+		cout << "Error: tessellated terrain needs OpenGL 4.0 (tessellation shaders)" << endl;
+		return false;
+	}
+	if (!program || patches < 1 || extent <= 0.0f)
+	{
+		cout << "Error: tessellated terrain needs a program, patches and an extent" << endl;
+		return false;
+	}
+
+	_Program = program;
+	_Extent = extent;
+	_Height = height;
+	static const char* names[U_COUNT] = { "matModelView", "matProjection", "viewportSize",
+		"pixelsPerEdge", "maxTessLevel", "patchCulling", "terrainSize", "eyePosition" };
+	for (int u = 0; u < U_COUNT; ++u) _Locations[u] = glGetUniformLocation(program, names[u]);
+	glGetIntegerv(GL_MAX_TESS_GEN_LEVEL, &_Statistics.maxLevel);
+
+	// shared grid corners, every patch lists its corners counterclockwise from (-x, -z), the
+	// order the evaluation shader interpolates them in
+	vector<glm::vec2> corners;
+	corners.reserve((patches + 1) * (patches + 1));
+	for (int z = 0; z <= patches; ++z)
+	{
+		for (int x = 0; x <= patches; ++x)
+		{
+			corners.push_back(glm::vec2(-extent + 2.0f * extent * x / patches,
+				-extent + 2.0f * extent * z / patches));
+		}
+	}
+	vector<GLuint> indices;
+	indices.reserve(4 * patches * patches);
+	for (int z = 0; z < patches; ++z)
+	{
+		for (int x = 0; x < patches; ++x)
+		{
+			GLuint corner = z * (patches + 1) + x;
+			indices.push_back(corner);
+			indices.push_back(corner + 1);
+			indices.push_back(corner + patches + 2);
+			indices.push_back(corner + patches + 1);
+		}
+	}
+	_IndexCount = GLsizei(indices.size());
+	_Statistics.patches = patches * patches;
+
+	glGenVertexArrays(1, &_VertexArray);
+	StateTracker::bindVertexArray(_VertexArray);
+	glGenBuffers(2, _Buffers);
+	StateTracker::bindBuffer(GL_ARRAY_BUFFER, _Buffers[0]);
+	glBufferData(GL_ARRAY_BUFFER, corners.size() * sizeof(glm::vec2), &corners[0],
+		GL_STATIC_DRAW);
+	StateTracker::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, _Buffers[1]);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), &indices[0],
+		GL_STATIC_DRAW);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, BUFFER_OFFSET(0));
+	glEnableVertexAttribArray(0);
+	glGenQueries(QUERY_COUNT, _Queries);
+
+	CG_GL_CHECK("TessellatedTerrain::init");
+	return true;
+}
+// TessellatedTerrain::init() /////////////////////////////////////////////////////////////////////
+
+
+
+void TessellatedTerrain::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_VertexArray) StateTracker::deleteVertexArrays(1, &_VertexArray);
+	if (_Buffers[0]) StateTracker::deleteBuffers(2, _Buffers);
+	if (_Queries[0]) glDeleteQueries(QUERY_COUNT, _Queries);
+
+	for (int q = 0; q < QUERY_COUNT; ++q)
+	{
+		_Queries[q] = 0;
+		_Pending[q] = false;
+	}
+	_VertexArray = _Buffers[0] = _Buffers[1] = 0;
+	_Program = 0;
+	_IndexCount = 0;
+	_NextQuery = 0;
+	_Statistics.patches = 0;
+	_Statistics.triangles = 0;
+}
+// TessellatedTerrain::release() //////////////////////////////////////////////////////////////////
+
+
+
+void TessellatedTerrain::setPixelsPerEdge(float pixels)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	_Statistics.pixelsPerEdge = min(max(pixels, 1.0f), 256.0f);
+}
+// TessellatedTerrain::setPixelsPerEdge() /////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: draw()
+// purpose:  Draws all patches, the tessellation control shader selects the levels and culls.
+//           Leaves the terrain program bound.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TessellatedTerrain::draw(const glm::mat4& projection, const glm::mat4& modelView,
+	GLsizei width, GLsizei height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!_Program) return;
+	CG_GL_SCOPE("TessellatedTerrain::draw");
+	readQueries();
+
+	// the back-facing test runs in model coordinates, where the terrain is a height field
+	glm::vec3 eye(glm::inverse(modelView)[3]);
+
+	StateTracker::useProgram(_Program);
+	glUniformMatrix4fv(_Locations[U_MODELVIEW], 1, GL_FALSE, glm::value_ptr(modelView));
+	glUniformMatrix4fv(_Locations[U_PROJECTION], 1, GL_FALSE, glm::value_ptr(projection));
+	glUniform2f(_Locations[U_VIEWPORT], float(width), float(height));
+	glUniform1f(_Locations[U_PIXELS], _Statistics.pixelsPerEdge);
+	glUniform1f(_Locations[U_MAXLEVEL], float(_Statistics.maxLevel));
+	glUniform1i(_Locations[U_CULLING], _Statistics.culling ? 1 : 0);
+	glUniform2f(_Locations[U_SIZE], _Extent, _Height);
+	glUniform3fv(_Locations[U_EYE], 1, glm::value_ptr(eye));
+
+	bool measure = !_Pending[_NextQuery];
+	if (measure) glBeginQuery(GL_PRIMITIVES_GENERATED, _Queries[_NextQuery]);
+	glPatchParameteri(GL_PATCH_VERTICES, 4);
+	StateTracker::bindVertexArray(_VertexArray);
+	glDrawElements(GL_PATCHES, _IndexCount, GL_UNSIGNED_INT, BUFFER_OFFSET(0));
+	if (measure)
+	{
+		glEndQuery(GL_PRIMITIVES_GENERATED);
+		_Pending[_NextQuery] = true;
+		_NextQuery = (_NextQuery + 1) % QUERY_COUNT;
+	}
+}
+// TessellatedTerrain::draw() /////////////////////////////////////////////////////////////////////
+
+
+
+void TessellatedTerrain::report(ostream& out) const
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	const StatisticsT& s = _Statistics;
+	out << "Tessellated terrain: " << s.patches << " patches, " << s.triangles << " triangles ("
+		<< (s.patches ? s.triangles / s.patches : 0) << " per patch), " << s.pixelsPerEdge
+		<< " pixels per edge (max level " << s.maxLevel << "), culling "
+		<< (s.culling ? "on" : "off") << endl;
+}
+// TessellatedTerrain::report() ///////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: readQueries()
+// purpose:  Collects the finished primitive counts in submission order without waiting.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TessellatedTerrain::readQueries(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = 0; i < QUERY_COUNT; ++i)
+	{
+		int slot = (_NextQuery + i) % QUERY_COUNT;
+		if (!_Pending[slot]) continue;
+
+		GLint available = 0;
+		glGetQueryObjectiv(_Queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) break;
+
+		glGetQueryObjectui64v(_Queries[slot], GL_QUERY_RESULT, &_Statistics.triangles);
+		_Pending[slot] = false;
+	}
+}
+// TessellatedTerrain::readQueries() //////////////////////////////////////////////////////////////
@@ -0,0 +1,658 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   TextureCompressor.cpp
+//
+//  \brief      Multithreaded BC1/BC3/BC5/BC7 block compression of RGBA8 images and the
+//              compressed texture container written by the CG-BCN tool.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <cctype>
+#include <cfloat>
+#include <cmath>
+using namespace std;
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/TextureCompressor.h"
+#include "../inc/CpuInfo.h"
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const int TextureCompressor::MAX_LEVELS;
+const unsigned TextureCompressor::VERSION;
+const unsigned TextureCompressor::ALIGNMENT;
+
+
+
+// block encoders work on the 16 pixels of a block as channel rows (0..255) //////////////////////
+namespace
+{
+	struct BlockT
+	{
+		float channel[4][16];
+	};
+
+	// nearest palette entry (squared distance over the first count channels) of every pixel,
+	// returns the summed error; palette entries have 4 floats
+	typedef float (*SelectT)(const float* const* channels, int count, const float* palette,
+		int entries, unsigned char* indices);
+
+	const int REFINEMENTS = 3;
+	const int BC7_WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+
+	float selectScalar(const float* const* channels, int count, const float* palette, int entries,
+		unsigned char* indices)
+	{
+		float errors[16];
+		for (int i = 0; i < 16; ++i)
+		{
+			float best = FLT_MAX;
+			int index = 0;
+			for (int p = 0; p < entries; ++p)
+			{
+				float distance = 0.0f;
+				for (int c = 0; c < count; ++c)
+				{
+					float d = channels[c][i] - palette[4 * p + c];
+					distance = distance + d * d;
+				}
+				if (distance < best)
+				{
+					best = distance;
+					index = p;
+				}
+			}
+			indices[i] = (unsigned char) index;
+			errors[i] = best;
+		}
+
+		float error = 0.0f;
+		for (int i = 0; i < 16; ++i) error += errors[i];
+		return error;
+	}
+
+#if CG_SIMD_X86
+	// 4 pixels per iteration, same arithmetic and tie breaking as selectScalar()
+	float selectSSE2(const float* const* channels, int count, const float* palette, int entries,
+		unsigned char* indices)
+	{
+		float errors[16];
+		for (int i = 0; i < 16; i += 4)
+		{
+			__m128 values[4];
+			for (int c = 0; c < count; ++c) values[c] = _mm_loadu_ps(channels[c] + i);
+
+			__m128 best = _mm_set1_ps(FLT_MAX);
+			__m128i index = _mm_setzero_si128();
+			for (int p = 0; p < entries; ++p)
+			{
+				__m128 distance = _mm_setzero_ps();
+				for (int c = 0; c < count; ++c)
+				{
+					__m128 d = _mm_sub_ps(values[c], _mm_set1_ps(palette[4 * p + c]));
+					distance = _mm_add_ps(distance, _mm_mul_ps(d, d));
+				}
+				__m128i closer = _mm_castps_si128(_mm_cmplt_ps(distance, best));
+				best = _mm_min_ps(distance, best);
+				index = _mm_or_si128(_mm_and_si128(closer, _mm_set1_epi32(p)),
+					_mm_andnot_si128(closer, index));
+			}
+
+			int lanes[4];
+			_mm_storeu_si128((__m128i*) lanes, index);
+			_mm_storeu_ps(errors + i, best);
+			for (int k = 0; k < 4; ++k) indices[i + k] = (unsigned char) lanes[k];
+		}
+
+		float error = 0.0f;
+		for (int i = 0; i < 16; ++i) error += errors[i];
+		return error;
+	}
+#endif // CG_SIMD_X86
+
+
+	void loadBlock(const unsigned char* pixels, int width, int height, int bx, int by, BlockT& block)
+	{
+		for (int y = 0; y < 4; ++y)
+		{
+			int sy = min(4 * by + y, height - 1);
+			for (int x = 0; x < 4; ++x)
+			{
+				int sx = min(4 * bx + x, width - 1);
+				const unsigned char* p = pixels + (size_t(sy) * width + sx) * 4;
+				for (int c = 0; c < 4; ++c) block.channel[c][4 * y + x] = p[c];
+			}
+		}
+	}
+
+
+	// end points of the pixels along the principal axis (power iteration on the covariance)
+	void fitEndpoints(const float* const* channels, int count, float* e0, float* e1)
+	{
+		float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		float low[4], high[4];
+		for (int c = 0; c < count; ++c)
+		{
+			low[c] = high[c] = channels[c][0];
+			for (int i = 0; i < 16; ++i)
+			{
+				mean[c] += channels[c][i];
+				low[c] = min(low[c], channels[c][i]);
+				high[c] = max(high[c], channels[c][i]);
+			}
+			mean[c] /= 16.0f;
+		}
+
+		float covariance[4][4];
+		for (int a = 0; a < count; ++a)
+		{
+			for (int b = 0; b < count; ++b)
+			{
+				float sum = 0.0f;
+				for (int i = 0; i < 16; ++i)
+					sum += (channels[a][i] - mean[a]) * (channels[b][i] - mean[b]);
+				covariance[a][b] = sum;
+			}
+		}
+
+		float axis[4];
+		for (int c = 0; c < count; ++c) axis[c] = high[c] - low[c];
+		for (int iteration = 0; iteration < 8; ++iteration)
+		{
+			float next[4], length = 0.0f;
+			for (int a = 0; a < count; ++a)
+			{
+				next[a] = 0.0f;
+				for (int b = 0; b < count; ++b) next[a] += covariance[a][b] * axis[b];
+				length += next[a] * next[a];
+			}
+			if (length < 1.0e-12f) break;
+			length = 1.0f / sqrt(length);
+			for (int c = 0; c < count; ++c) axis[c] = next[c] * length;
+		}
+
+		float length = 0.0f;
+		for (int c = 0; c < count; ++c) length += axis[c] * axis[c];
+		if (length < 1.0e-12f)
+		{
+			// uniform block
+			for (int c = 0; c < count; ++c) e0[c] = e1[c] = mean[c];
+			return;
+		}
+		length = 1.0f / sqrt(length);
+
+		float tMin = FLT_MAX, tMax = -FLT_MAX;
+		for (int i = 0; i < 16; ++i)
+		{
+			float t = 0.0f;
+			for (int c = 0; c < count; ++c) t += (channels[c][i] - mean[c]) * axis[c] * length;
+			tMin = min(tMin, t);
+			tMax = max(tMax, t);
+		}
+		for (int c = 0; c < count; ++c)
+		{
+			e0[c] = min(255.0f, max(0.0f, mean[c] + tMax * axis[c] * length));
+			e1[c] = min(255.0f, max(0.0f, mean[c] + tMin * axis[c] * length));
+		}
+	}
+
+
+	// least squares end points for the selected indices, weights[index] is the weight of e0
+	bool solveEndpoints(const float* const* channels, int count, const unsigned char* indices,
+		const float* weights, float* e0, float* e1)
+	{
+		float a = 0.0f, b = 0.0f, c = 0.0f, x[4] = { 0.0f }, y[4] = { 0.0f };
+		for (int i = 0; i < 16; ++i)
+		{
+			float w = weights[indices[i]];
+			a += w * w;
+			b += w * (1.0f - w);
+			c += (1.0f - w) * (1.0f - w);
+			for (int k = 0; k < count; ++k)
+			{
+				x[k] += w * channels[k][i];
+				y[k] += (1.0f - w) * channels[k][i];
+			}
+		}
+
+		float determinant = a * c - b * b;
+		if (fabs(determinant) < 1.0e-6f) return false;
+		for (int k = 0; k < count; ++k)
+		{
+			e0[k] = min(255.0f, max(0.0f, (c * x[k] - b * y[k]) / determinant));
+			e1[k] = min(255.0f, max(0.0f, (a * y[k] - b * x[k]) / determinant));
+		}
+		return true;
+	}
+
+
+	unsigned short encode565(const float* color)
+	{
+		int r = int(color[0] * 31.0f / 255.0f + 0.5f);
+		int g = int(color[1] * 63.0f / 255.0f + 0.5f);
+		int b = int(color[2] * 31.0f / 255.0f + 0.5f);
+		return (unsigned short) ((r << 11) | (g << 5) | b);
+	}
+
+	void decode565(unsigned short value, float* color)
+	{
+		int r = (value >> 11) & 31, g = (value >> 5) & 63, b = value & 31;
+		color[0] = float((r << 3) | (r >> 2));
+		color[1] = float((g << 2) | (g >> 4));
+		color[2] = float((b << 3) | (b >> 2));
+		color[3] = 0.0f;
+	}
+
+
+	// BC1 color block (4 color mode, also the color part of BC3)
+	void encodeColor(const BlockT& block, SelectT select, unsigned char* out)
+	{
+		static const float WEIGHTS[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+		const float* channels[3] = { block.channel[0], block.channel[1], block.channel[2] };
+
+		float e0[3], e1[3];
+		fitEndpoints(channels, 3, e0, e1);
+		unsigned short c0 = encode565(e0), c1 = encode565(e1);
+
+		float bestError = FLT_MAX;
+		unsigned short best0 = 0, best1 = 0;
+		unsigned char best[16], indices[16];
+		for (int iteration = 0; iteration < REFINEMENTS; ++iteration)
+		{
+			if (c0 < c1) swap(c0, c1);
+
+			// equal end points only have index 0 (c0 in both the 4 and the 3 color mode)
+			float palette[16];
+			decode565(c0, palette);
+			decode565(c1, palette + 4);
+			for (int c = 0; c < 3; ++c)
+			{
+				palette[8 + c] = (2.0f * palette[c] + palette[4 + c]) / 3.0f;
+				palette[12 + c] = (palette[c] + 2.0f * palette[4 + c]) / 3.0f;
+			}
+			float error = select(channels, 3, palette, (c0 == c1) ? 1 : 4, indices);
+			if (error >= bestError) break;
+
+			bestError = error;
+			best0 = c0;
+			best1 = c1;
+			memcpy(best, indices, 16);
+			if (c0 == c1 || error == 0.0f) break;
+			if (!solveEndpoints(channels, 3, indices, WEIGHTS, e0, e1)) break;
+			c0 = encode565(e0);
+			c1 = encode565(e1);
+		}
+
+		unsigned bits = 0;
+		for (int i = 0; i < 16; ++i) bits |= unsigned(best[i]) << (2 * i);
+		out[0] = (unsigned char) (best0 & 0xff);
+		out[1] = (unsigned char) (best0 >> 8);
+		out[2] = (unsigned char) (best1 & 0xff);
+		out[3] = (unsigned char) (best1 >> 8);
+		for (int i = 0; i < 4; ++i) out[4 + i] = (unsigned char) (bits >> (8 * i));
+	}
+
+
+	// BC4 single channel block (8 value mode, alpha of BC3 and the channels of BC5)
+	void encodeChannel(const float* values, SelectT select, unsigned char* out)
+	{
+		static const float WEIGHTS[8] = { 1.0f, 0.0f, 6.0f / 7.0f, 5.0f / 7.0f, 4.0f / 7.0f,
+			3.0f / 7.0f, 2.0f / 7.0f, 1.0f / 7.0f };
+		const float* channels[1] = { values };
+
+		float low = values[0], high = values[0];
+		for (int i = 1; i < 16; ++i)
+		{
+			low = min(low, values[i]);
+			high = max(high, values[i]);
+		}
+		int a0 = int(high + 0.5f), a1 = int(low + 0.5f);
+
+		float bestError = FLT_MAX;
+		int best0 = a0, best1 = a1;
+		unsigned char best[16], indices[16];
+		memset(best, 0, sizeof(best));
+		for (int iteration = 0; iteration < REFINEMENTS; ++iteration)
+		{
+			if (a0 < a1) swap(a0, a1);
+
+			float palette[32];
+			for (int p = 0; p < 8; ++p) palette[4 * p] = WEIGHTS[p] * a0 + (1.0f - WEIGHTS[p]) * a1;
+			float error = select(channels, 1, palette, (a0 == a1) ? 1 : 8, indices);
+			if (error >= bestError) break;
+
+			bestError = error;
+			best0 = a0;
+			best1 = a1;
+			memcpy(best, indices, 16);
+
+			float e0, e1;
+			if (a0 == a1 || error == 0.0f) break;
+			if (!solveEndpoints(channels, 1, indices, WEIGHTS, &e0, &e1)) break;
+			a0 = int(e0 + 0.5f);
+			a1 = int(e1 + 0.5f);
+		}
+
+		unsigned long long bits = 0;
+		for (int i = 0; i < 16; ++i) bits |= (unsigned long long) best[i] << (3 * i);
+		out[0] = (unsigned char) best0;
+		out[1] = (unsigned char) best1;
+		for (int i = 0; i < 6; ++i) out[2 + i] = (unsigned char) (bits >> (8 * i));
+	}
+
+
+	// BC7 mode 6 end point: 7 bits per channel and a shared p-bit (the lowest bit)
+	void quantizeBC7(const float* endpoint, int* value, int& pBit)
+	{
+		float bestError = FLT_MAX;
+		for (int p = 0; p < 2; ++p)
+		{
+			int q[4];
+			float error = 0.0f;
+			for (int c = 0; c < 4; ++c)
+			{
+				q[c] = min(127, max(0, int((endpoint[c] - p) * 0.5f + 0.5f)));
+				float d = float(2 * q[c] + p) - endpoint[c];
+				error += d * d;
+			}
+			if (error < bestError)
+			{
+				bestError = error;
+				pBit = p;
+				for (int c = 0; c < 4; ++c) value[c] = q[c];
+			}
+		}
+	}
+
+	void putBits(unsigned char* out, int& position, unsigned value, int count)
+	{
+		for (int i = 0; i < count; ++i, ++position)
+		{
+			if ((value >> i) & 1) out[position >> 3] |= (unsigned char) (1 << (position & 7));
+		}
+	}
+
+	void encodeBC7(const BlockT& block, SelectT select, unsigned char* out)
+	{
+		float weights[16];
+		for (int i = 0; i < 16; ++i) weights[i] = (64 - BC7_WEIGHTS[i]) / 64.0f;
+		const float* channels[4] = { block.channel[0], block.channel[1], block.channel[2],
+			block.channel[3] };
+
+		float e0[4], e1[4];
+		fitEndpoints(channels, 4, e0, e1);
+
+		float bestError = FLT_MAX;
+		int best0[4] = { 0 }, best1[4] = { 0 }, bestP0 = 0, bestP1 = 0;
+		unsigned char best[16], indices[16];
+		memset(best, 0, sizeof(best));
+		for (int iteration = 0; iteration < REFINEMENTS; ++iteration)
+		{
+			int q0[4], q1[4], p0, p1;
+			quantizeBC7(e0, q0, p0);
+			quantizeBC7(e1, q1, p1);
+
+			// interpolation of the hardware: ((64 - w) * E0 + w * E1 + 32) >> 6
+			float palette[64];
+			for (int i = 0; i < 16; ++i)
+			{
+				for (int c = 0; c < 4; ++c)
+				{
+					int a = 2 * q0[c] + p0, b = 2 * q1[c] + p1;
+					palette[4 * i + c] =
+						float(((64 - BC7_WEIGHTS[i]) * a + BC7_WEIGHTS[i] * b + 32) >> 6);
+				}
+			}
+			float error = select(channels, 4, palette, 16, indices);
+			if (error >= bestError) break;
+
+			bestError = error;
+			memcpy(best0, q0, sizeof(q0));
+			memcpy(best1, q1, sizeof(q1));
+			bestP0 = p0;
+			bestP1 = p1;
+			memcpy(best, indices, 16);
+			if (error == 0.0f || !solveEndpoints(channels, 4, indices, weights, e0, e1)) break;
+		}
+
+		// the most significant index bit of pixel 0 is implicit 0: swap the end points if set
+		if (best[0] >= 8)
+		{
+			for (int c = 0; c < 4; ++c) swap(best0[c], best1[c]);
+			swap(bestP0, bestP1);
+			for (int i = 0; i < 16; ++i) best[i] = (unsigned char) (15 - best[i]);
+		}
+
+		memset(out, 0, 16);
+		int position = 0;
+		putBits(out, position, 1 << 6, 7);   // mode 6
+		for (int c = 0; c < 4; ++c)
+		{
+			putBits(out, position, unsigned(best0[c]), 7);
+			putBits(out, position, unsigned(best1[c]), 7);
+		}
+		putBits(out, position, unsigned(bestP0), 1);
+		putBits(out, position, unsigned(bestP1), 1);
+		putBits(out, position, best[0], 3);
+		for (int i = 1; i < 16; ++i) putBits(out, position, best[i], 4);
+	}
+
+
+	void encodeBlock(TextureCompressor::FormatT format, const BlockT& block, SelectT select,
+		unsigned char* out)
+	{
+		switch (format)
+		{
+			case TextureCompressor::FORMAT_BC1:
+				encodeColor(block, select, out);
+				break;
+			case TextureCompressor::FORMAT_BC3:
+				encodeChannel(block.channel[3], select, out);
+				encodeColor(block, select, out + 8);
+				break;
+			case TextureCompressor::FORMAT_BC5:
+				encodeChannel(block.channel[0], select, out);
+				encodeChannel(block.channel[1], select, out + 8);
+				break;
+			case TextureCompressor::FORMAT_BC7:
+				encodeBC7(block, select, out);
+				break;
+		}
+	}
+}
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: compress()
+// purpose:  Encodes an RGBA8 image (width x height pixels, rows in memory order) into
+//           getLevelSize() bytes of blocks. threads = 0 uses all hardware threads.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TextureCompressor::compress(FormatT format, const unsigned char* pixels, int width, int height,
+	unsigned char* blocks, unsigned threads)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	SelectT select = selectScalar;
+#if CG_SIMD_X86
+	if (CpuInfo::getLevel() >= CpuInfo::SL_SSE2) select = selectSSE2;
+#endif
+
+	int blocksX = (width + 3) / 4, blocksY = (height + 3) / 4;
+	size_t blockSize = getBlockSize(format);
+	atomic<int> nextRow(0);
+
+	// every thread encodes the next block row until all rows are done
+	auto encodeRows = [&]()
+	{
+		BlockT block;
+		for (int by = nextRow++; by < blocksY; by = nextRow++)
+		{
+			unsigned char* out = blocks + size_t(by) * blocksX * blockSize;
+			for (int bx = 0; bx < blocksX; ++bx, out += blockSize)
+			{
+				loadBlock(pixels, width, height, bx, by, block);
+				encodeBlock(format, block, select, out);
+			}
+		}
+	};
+
+	if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+	threads = min(threads, unsigned(blocksY));
+
+	vector<thread> workers;
+	for (unsigned i = 1; i < threads; ++i) workers.push_back(thread(encodeRows));
+	encodeRows();
+	for (size_t i = 0; i < workers.size(); ++i) workers[i].join();
+}
+// TextureCompressor::compress() //////////////////////////////////////////////////////////////////
+
+
+
+size_t TextureCompressor::getBlockSize(FormatT format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return (format == FORMAT_BC1) ? 8 : 16;
+}
+// TextureCompressor::getBlockSize() //////////////////////////////////////////////////////////////
+
+
+
+size_t TextureCompressor::getLevelSize(FormatT format, int width, int height)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return size_t((width + 3) / 4) * size_t((height + 3) / 4) * getBlockSize(format);
+}
+// TextureCompressor::getLevelSize() //////////////////////////////////////////////////////////////
+
+
+
+const char* TextureCompressor::getFormatName(FormatT format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	static const char* names[] = { "BC1", "BC3", "BC5", "BC7" };
+	return names[format];
+}
+// TextureCompressor::getFormatName() /////////////////////////////////////////////////////////////
+
+
+
+bool TextureCompressor::parseFormat(const string& name, FormatT& format)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (int i = FORMAT_BC1; i <= FORMAT_BC7; ++i)
+	{
+		const char* candidate = getFormatName(FormatT(i));
+		if (name.size() == 3 && toupper(name[0]) == candidate[0]
+			&& toupper(name[1]) == candidate[1] && name[2] == candidate[2])
+		{
+			format = FormatT(i);
+			return true;
+		}
+	}
+	return false;
+}
+// TextureCompressor::parseFormat() ///////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: write()
+// purpose:  Writes the container with the blocks of all mipmap levels (level 0 first).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool TextureCompressor::write(const string& filename, FormatT format, int width, int height,
+	const vector<vector<unsigned char> >& levels)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (levels.empty() || levels.size() > size_t(MAX_LEVELS)) return false;
+
+	HeaderT header = { { 'C', 'G', 'T', 'C' }, VERSION, unsigned(format), unsigned(width),
+		unsigned(height), unsigned(levels.size()), { 0, 0 } };
+	vector<LevelT> table(levels.size());
+	size_t offset = sizeof(HeaderT) + table.size() * sizeof(LevelT);
+	for (size_t i = 0; i < levels.size(); ++i)
+	{
+		offset = (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+		table[i].offset = unsigned(offset);
+		table[i].size = unsigned(levels[i].size());
+		offset += levels[i].size();
+	}
+
+	ofstream file(filename.c_str(), ios_base::out | ios_base::binary | ios_base::trunc);
+	file.write((const char*) &header, sizeof(header));
+	file.write((const char*) &table[0], table.size() * sizeof(LevelT));
+	size_t position = sizeof(HeaderT) + table.size() * sizeof(LevelT);
+	for (size_t i = 0; i < levels.size(); ++i)
+	{
+		static const char padding[ALIGNMENT] = { 0 };
+		file.write(padding, table[i].offset - position);
+		file.write((const char*) &levels[i][0], levels[i].size());
+		position = table[i].offset + levels[i].size();
+	}
+	if (!file)
+	{
+		cout << "Error: unable to write compressed texture " << filename << endl;
+		return false;
+	}
+	return true;
+}
+// TextureCompressor::write() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: parse()
+// purpose:  Checks a container in memory (e.g. a mapped file) and returns views of its levels.
+//           Returns false if it is truncated or the level sizes do not match the format.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool TextureCompressor::parse(const char* data, size_t size, ContainerT& container)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (size < sizeof(HeaderT)) return false;
+	const HeaderT* header = (const HeaderT*) data;
+	if (memcmp(header->magic, "CGTC", 4) != 0 || header->version != VERSION) return false;
+	if (header->format > unsigned(FORMAT_BC7) || header->levels < 1
+		|| header->levels > unsigned(MAX_LEVELS)) return false;
+	if (header->width < 1 || header->height < 1) return false;
+	if (size < sizeof(HeaderT) + header->levels * sizeof(LevelT)) return false;
+
+	container.format = FormatT(header->format);
+	container.width = int(header->width);
+	container.height = int(header->height);
+	container.levels = int(header->levels);
+
+	const LevelT* table = (const LevelT*) (data + sizeof(HeaderT));
+	for (int i = 0; i < container.levels; ++i)
+	{
+		int width = max(1, container.width >> i), height = max(1, container.height >> i);
+		if (table[i].size != getLevelSize(container.format, width, height)) return false;
+		if (table[i].offset > size || table[i].size > size - table[i].offset) return false;
+		container.data[i] = (const unsigned char*) data + table[i].offset;
+		container.size[i] = table[i].size;
+	}
+	return true;
+}
+// TextureCompressor::parse() /////////////////////////////////////////////////////////////////////
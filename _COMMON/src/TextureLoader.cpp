@@ -0,0 +1,444 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////
+/*! \file
+//
+//  \filename   TextureLoader.cpp
+//
+//  \brief      Asynchronous texture loading: image files are decoded on a pool of worker
+//              threads and uploaded through a ring of pixel unpack buffers.
+//
+//  \history
+//     yyyy-mm-dd   Version   Author   Comment
+//     2026-10-18   1.00      agt      Initial file release
+//     2026-10-18   1.10      agt      Decoding and box filter moved to ImageDecoder
+//     2026-10-18   1.20      agt      Bindings through the StateTracker
+//  \endverbatim
+*/
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+// system includes ////////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+using namespace std;
+
+
+// OpenGL helper includes /////////////////////////////////////////////////////////////////////////
+#include <GL/glew.h>
+
+
+// application helper includes ////////////////////////////////////////////////////////////////////
+#include "../inc/TextureLoader.h"
+#include "../inc/ImageDecoder.h"
+#include "../inc/CpuInfo.h"
+#include "../inc/StateTracker.h"
+
+
+typedef chrono::steady_clock ClockT;
+
+
+
+// static member definitions //////////////////////////////////////////////////////////////////////
+const size_t TextureLoader::DEFAULT_BUFFER_SIZE;
+const size_t TextureLoader::DEFAULT_BUDGET;
+
+
+
+TextureLoader::TextureLoader(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+: _Stop(false), _RingNext(0), _BufferSize(0), _Current(NULL), _Level(0), _Row(0)
+{
+	for (int i = 0; i < RING_SIZE; ++i)
+	{
+		_Ring[i].buffer = 0;
+		_Ring[i].fence = 0;
+	}
+	memset(&_Statistics, 0, sizeof(_Statistics));
+}
+// TextureLoader::TextureLoader() /////////////////////////////////////////////////////////////////
+
+
+
+TextureLoader::~TextureLoader(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+}
+// TextureLoader::~TextureLoader() ////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: init()
+// purpose:  Creates the pixel unpack buffers of bufferSize bytes and starts the workers (0: one
+//           thread less than the hardware threads, the GL thread keeps a core).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TextureLoader::init(unsigned workers, size_t bufferSize)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	release();
+
+	_BufferSize = bufferSize;
+	for (int i = 0; i < RING_SIZE; ++i)
+	{
+		glGenBuffers(1, &_Ring[i].buffer);
+		StateTracker::bindBuffer(GL_PIXEL_UNPACK_BUFFER, _Ring[i].buffer);
+		glBufferData(GL_PIXEL_UNPACK_BUFFER, GLsizeiptr(_BufferSize), NULL, GL_STREAM_DRAW);
+	}
+	StateTracker::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+	if (workers == 0)
+	{
+		unsigned threads = thread::hardware_concurrency();
+		workers = (threads > 1) ? threads - 1 : 1;
+	}
+	_Stop = false;
+	for (unsigned i = 0; i < workers; ++i)
+	{
+		_Workers.push_back(new thread(&TextureLoader::runWorker, this));
+	}
+
+	cout << "Texture Loader: " << workers << " workers, " << RING_SIZE << " x "
+		<< (_BufferSize >> 10) << " KB pixel unpack buffers" << endl;
+}
+// TextureLoader::init() //////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: release()
+// purpose:  Stops the workers, drops all pending jobs and deletes the buffers and fences. The
+//           texture names returned by load() belong to the caller.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TextureLoader::release(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	{
+		lock_guard<mutex> lock(_Mutex);
+		_Stop = true;
+		_Jobs.clear();
+	}
+	_Condition.notify_all();
+	for (size_t i = 0; i < _Workers.size(); ++i)
+	{
+		_Workers[i]->join();
+		delete _Workers[i];
+	}
+	_Workers.clear();
+
+	for (size_t i = 0; i < _Decoded.size(); ++i) delete _Decoded[i];
+	_Decoded.clear();
+	delete _Current;
+	_Current = NULL;
+	_Loading.clear();
+
+	for (int i = 0; i < RING_SIZE; ++i)
+	{
+		if (_Ring[i].fence) glDeleteSync(_Ring[i].fence);
+		if (_Ring[i].buffer) StateTracker::deleteBuffers(1, &_Ring[i].buffer);
+		_Ring[i].fence = 0;
+		_Ring[i].buffer = 0;
+	}
+	_RingNext = 0;
+}
+// TextureLoader::release() ///////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: load()
+// purpose:  Queues an image file for decoding and returns the name of the texture it will be
+//           uploaded to. Does not touch the file, so it is cheap enough for the render loop.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint TextureLoader::load(const string& filename, MipmapT mipmaps)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	JobT job;
+	glGenTextures(1, &job.texture);
+	job.filename = filename;
+	job.mipmaps = mipmaps;
+
+	{
+		lock_guard<mutex> lock(_Mutex);
+		_Jobs.push_back(job);
+	}
+	_Condition.notify_one();
+
+	_Loading.insert(job.texture);
+	_Statistics.requested++;
+	return job.texture;
+}
+// TextureLoader::load() //////////////////////////////////////////////////////////////////////////
+
+
+
+void TextureLoader::runWorker(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (;;)
+	{
+		JobT job;
+		{
+			unique_lock<mutex> lock(_Mutex);
+			while (!_Stop && _Jobs.empty()) _Condition.wait(lock);
+			if (_Stop) return;
+			job = _Jobs.front();
+			_Jobs.pop_front();
+		}
+
+		ClockT::time_point start = ClockT::now();
+		ImageT* image = decode(job);
+		double seconds = chrono::duration<double>(ClockT::now() - start).count();
+
+		lock_guard<mutex> lock(_Mutex);
+		if (_Stop)
+		{
+			delete image;
+			return;
+		}
+		_Decoded.push_back(image);
+		_Statistics.decodeSeconds += seconds;
+	}
+}
+// TextureLoader::runWorker() /////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: decode()
+// purpose:  Decodes the image file into RGBA8 rows and builds the mipmap chain for
+//           MIPMAP_CPU. Runs on a worker thread; a file that cannot be decoded becomes a 1x1
+//           magenta texture.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+TextureLoader::ImageT* TextureLoader::decode(const JobT& job)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	ImageT* image = new ImageT;
+	image->texture = job.texture;
+	image->mipmaps = job.mipmaps;
+
+	if (!ImageDecoder::decode(job.filename, image->width, image->height, image->pixels))
+	{
+		cerr << "Texture Loader: cannot decode " << job.filename << endl;
+
+		static const unsigned char MAGENTA[4] = { 255, 0, 255, 255 };
+		image->mipmaps = MIPMAP_NONE;
+		image->width = image->height = 1;
+		image->levels = image->uploadLevels = 1;
+		image->offsets.assign(1, 0);
+		image->pixels.assign(MAGENTA, MAGENTA + 4);
+
+		lock_guard<mutex> lock(_Mutex);
+		_Statistics.failed++;
+		return image;
+	}
+
+	image->levels = (job.mipmaps == MIPMAP_NONE) ? 1 :
+		ImageDecoder::getLevelCount(image->width, image->height);
+	image->uploadLevels = (job.mipmaps == MIPMAP_CPU) ? image->levels : 1;
+
+	// level 0 is decoded in place, the smaller levels are appended
+	size_t size = 0;
+	for (int level = 0; level < image->uploadLevels; ++level)
+	{
+		image->offsets.push_back(size);
+		size += size_t(max(1, image->width >> level)) * max(1, image->height >> level) * 4;
+	}
+	image->pixels.resize(size);
+
+	for (int level = 1; level < image->uploadLevels; ++level)
+	{
+		ImageDecoder::downsample(&image->pixels[image->offsets[level - 1]],
+			max(1, image->width >> (level - 1)), max(1, image->height >> (level - 1)),
+			&image->pixels[image->offsets[level]]);
+	}
+	return image;
+}
+// TextureLoader::decode() ////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: update()
+// purpose:  Uploads decoded images through the ring of pixel unpack buffers, at most about
+//           byteBudget bytes per call. Never waits: stops when no image is decoded yet, the
+//           workers hold the queue or the next ring buffer is still read by the GPU.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TextureLoader::update(size_t byteBudget)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Loading.empty()) return;
+
+	ClockT::time_point start = ClockT::now();
+	size_t bytes = 0;
+	bool uploaded = false;
+
+	while (bytes < byteBudget)
+	{
+		if (!_Current && !beginImage()) break;
+		uploaded = true;
+
+		if (!uploadRows(bytes, byteBudget))
+		{
+			_Statistics.stalls++;
+			break;
+		}
+		if (_Level == _Current->uploadLevels) endImage();
+	}
+
+	StateTracker::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	StateTracker::bindTexture(GL_TEXTURE_2D, 0);
+
+	if (uploaded)
+	{
+		_Statistics.updates++;
+		_Statistics.uploadBytes += bytes;
+		_Statistics.uploadSeconds += chrono::duration<double>(ClockT::now() - start).count();
+	}
+}
+// TextureLoader::update() ////////////////////////////////////////////////////////////////////////
+
+
+
+bool TextureLoader::beginImage(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	{
+		// the workers only hold the lock to push or pop a pointer, try again next frame
+		unique_lock<mutex> lock(_Mutex, try_to_lock);
+		if (!lock.owns_lock() || _Decoded.empty()) return false;
+		_Current = _Decoded.front();
+		_Decoded.pop_front();
+	}
+	_Level = 0;
+	_Row = 0;
+
+	StateTracker::bindTexture(GL_TEXTURE_2D, _Current->texture);
+	glTexStorage2D(GL_TEXTURE_2D, _Current->levels, GL_RGBA8, _Current->width, _Current->height);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+		(_Current->levels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+	return true;
+}
+// TextureLoader::beginImage() ////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: uploadRows()
+// purpose:  Copies the next band of rows of the current level into the next ring buffer and
+//           starts its transfer. Returns false if that buffer is still in use.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool TextureLoader::uploadRows(size_t& bytes, size_t byteBudget)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	int width = max(1, _Current->width >> _Level);
+	int height = max(1, _Current->height >> _Level);
+	size_t rowSize = size_t(width) * 4;
+	const unsigned char* src = &_Current->pixels[_Current->offsets[_Level] + _Row * rowSize];
+
+	StateTracker::bindTexture(GL_TEXTURE_2D, _Current->texture);
+
+	int rows = height - _Row;
+	if (rowSize > _BufferSize)
+	{
+		// a single row does not fit into a ring buffer: the driver copies from client memory
+		StateTracker::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		glTexSubImage2D(GL_TEXTURE_2D, _Level, 0, _Row, width, rows, GL_RGBA, GL_UNSIGNED_BYTE, src);
+	}
+	else
+	{
+		BufferT& slot = _Ring[_RingNext];
+		if (slot.fence)
+		{
+			GLenum status = glClientWaitSync(slot.fence, 0, 0);
+			if (status == GL_TIMEOUT_EXPIRED) return false;
+			glDeleteSync(slot.fence);
+			slot.fence = 0;
+		}
+
+		size_t budgetRows = max(size_t(1), (byteBudget - bytes) / rowSize);
+		rows = int(min(size_t(rows), min(_BufferSize / rowSize, budgetRows)));
+
+		StateTracker::bindBuffer(GL_PIXEL_UNPACK_BUFFER, slot.buffer);
+		void* dst = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, GLsizeiptr(rows * rowSize),
+			GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		if (dst)
+		{
+			memcpy(dst, src, rows * rowSize);
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+			glTexSubImage2D(GL_TEXTURE_2D, _Level, 0, _Row, width, rows, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+		}
+		else
+		{
+			StateTracker::bindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			glTexSubImage2D(GL_TEXTURE_2D, _Level, 0, _Row, width, rows, GL_RGBA, GL_UNSIGNED_BYTE, src);
+		}
+		slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		_RingNext = (_RingNext + 1) % RING_SIZE;
+	}
+
+	bytes += rows * rowSize;
+	_Row += rows;
+	if (_Row == height)
+	{
+		_Level++;
+		_Row = 0;
+	}
+	return true;
+}
+// TextureLoader::uploadRows() ////////////////////////////////////////////////////////////////////
+
+
+
+void TextureLoader::endImage(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (_Current->mipmaps == MIPMAP_GPU && _Current->levels > 1)
+	{
+		glGenerateMipmap(GL_TEXTURE_2D);
+	}
+	_Loading.erase(_Current->texture);
+	_Statistics.loaded++;
+
+	delete _Current;
+	_Current = NULL;
+}
+// TextureLoader::endImage() //////////////////////////////////////////////////////////////////////
+
+
+
+TextureLoader::StatisticsT TextureLoader::getStatistics(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	lock_guard<mutex> lock(_Mutex);
+	return _Statistics;
+}
+// TextureLoader::getStatistics() /////////////////////////////////////////////////////////////////
+
+
+
+void TextureLoader::report(ostream& out)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	StatisticsT statistics = getStatistics();
+	double megabytes = statistics.uploadBytes / (1024.0 * 1024.0);
+
+	out << "Texture Loader: " << statistics.loaded << " of " << statistics.requested
+		<< " textures loaded, " << statistics.failed << " failed" << endl;
+	out << fixed << setprecision(2)
+		<< "   decode:  " << statistics.decodeSeconds * 1000.0 << " ms on "
+		<< _Workers.size() << " workers (box filter: "
+		<< ((CG_SIMD_X86 && CpuInfo::getLevel() >= CpuInfo::SL_SSE2) ? "SSE2" : "scalar") << ")" << endl
+		<< "   upload:  " << megabytes << " MB in " << statistics.updates << " updates, "
+		<< statistics.uploadSeconds * 1000.0 << " ms, ";
+	if (statistics.uploadSeconds > 0.0) out << megabytes / statistics.uploadSeconds << " MB/s";
+	else out << "- MB/s";
+	out << ", " << statistics.stalls << " ring stalls" << endl;
+	out.unsetf(ios::floatfield);
+}
+// TextureLoader::report() ////////////////////////////////////////////////////////////////////////
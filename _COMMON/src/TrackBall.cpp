@@ -42,6 +42,7 @@
 
 // application includes ///////////////////////////////////////////////////////////////////////////
 #include "../inc/TrackBall.h"
+#include "../inc/SimdMath.h"
 
 
 // init static class members //////////////////////////////////////////////////////////////////////
@@ -132,7 +133,7 @@ void TrackBall::matToAxisAmount(float mat[], float aa[])
 
 
 
-void TrackBall::rotateTrackball(int dx, int dy, float rotation[4])
+void TrackBall::rotateTrackball(int dx, int dy, int width, float rotation[4])
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
 	double dist;
@@ -140,16 +141,13 @@ void TrackBall::rotateTrackball(int dx, int dy, float rotation[4])
 	float rotMat[9];
 	float newRot[4];
 
-	GLint viewport[4];
-	glGetIntegerv(GL_VIEWPORT, viewport); // GLint x, GLint y, GLsizei width, GLsizei height
-
 	dist = sqrt((double)(dx * dx + dy * dy));
 	if(fabs(dist) < 0.99) return;
 
 	newRot[0] = float(dy / dist);
 	newRot[1] = float(dx / dist);
 	newRot[2] = 0.0f;
-	newRot[3] = float(glm::pi<float>() * dist / viewport[2]); // window width
+	newRot[3] = float(glm::pi<float>() * dist / width); // viewport width
 
 	axisAmountToMat(rotation, oldMat);
 	axisAmountToMat(newRot, rotMat);
@@ -309,6 +307,41 @@ void TrackBall::resetTransformation(void)
 
 
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: unprojectMouse()
+// purpose:  Use this function to create a ray through the pixel center under the mouse cursor
+//           for picking. The ray is returned in the coordinate system transformed by modelView
+//           (e.g. model space when passing the model view matrix) with a normalized direction.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+void TrackBall::unprojectMouse(int x, int y, const glm::mat4& modelView, const glm::mat4& projection,
+	glm::vec3& origin, glm::vec3& direction)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLint viewport[4];
+	glGetIntegerv(GL_VIEWPORT, viewport); // GLint x, GLint y, GLsizei width, GLsizei height
+	glm::vec4 window(viewport[0], viewport[1], viewport[2], viewport[3]);
+
+	// GLUT mouse coordinates start at the upper left window corner
+	float wx = x + 0.5f;
+	float wy = viewport[3] - y - 0.5f;
+
+	// same as glm::unProject() for the near and far plane, but inverting only once
+	glm::mat4 inverse = SimdMath::inverse(projection * modelView);
+	float nx = 2.0f * (wx - window[0]) / window[2] - 1.0f;
+	float ny = 2.0f * (wy - window[1]) / window[3] - 1.0f;
+	glm::vec4 nearClip = inverse * glm::vec4(nx, ny, -1.0f, 1.0f);
+	glm::vec4 farClip  = inverse * glm::vec4(nx, ny,  1.0f, 1.0f);
+
+	glm::vec3 nearPoint = glm::vec3(nearClip) / nearClip.w;
+	glm::vec3 farPoint  = glm::vec3(farClip) / farClip.w;
+
+	origin = nearPoint;
+	direction = glm::normalize(farPoint - nearPoint);
+}
+// TrackBall::unprojectMouse() ////////////////////////////////////////////////////////////////////
+
+
+
 void TrackBall::glutMouseMotionCB(int x, int y)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
@@ -343,7 +376,9 @@ void TrackBall::glutMouseMotionCB(int x, int y)
 	{
 		case TM_ROTATE:
 		{
-			rotateTrackball(dx, dy, _Rotation);
+			GLint viewport[4];
+			glGetIntegerv(GL_VIEWPORT, viewport); // GLint x, GLint y, GLsizei width, GLsizei height
+			rotateTrackball(dx, dy, viewport[2], _Rotation);
 			break;
 		}
 		case TM_SCALE:
@@ -464,12 +499,14 @@ void TrackBall::glutSpecialFuncCB(int key, int x, int y)
 		{
 			case TM_ROTATE:
 			{
+				GLint viewport[4];
+				glGetIntegerv(GL_VIEWPORT, viewport);
 				switch(key)
 				{
-					case GLUT_KEY_UP:    rotateTrackball(0, -10, _Rotation); break;
-					case GLUT_KEY_DOWN:  rotateTrackball(0,  10, _Rotation); break;
-					case GLUT_KEY_LEFT:  rotateTrackball(-10, 0, _Rotation); break;
-					case GLUT_KEY_RIGHT: rotateTrackball( 10, 0, _Rotation); break;
+					case GLUT_KEY_UP:    rotateTrackball(0, -10, viewport[2], _Rotation); break;
+					case GLUT_KEY_DOWN:  rotateTrackball(0,  10, viewport[2], _Rotation); break;
+					case GLUT_KEY_LEFT:  rotateTrackball(-10, 0, viewport[2], _Rotation); break;
+					case GLUT_KEY_RIGHT: rotateTrackball( 10, 0, viewport[2], _Rotation); break;
 					default: return;
 				}
 				break;
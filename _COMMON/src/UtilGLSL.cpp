@@ -9,6 +9,12 @@
 //  \history
 //     yyyy-mm-dd   Version   Author   Comment
 //     2015-09-24   1.30      klu      Update for new shader based CG course
+//     2026-10-18   1.40      agt      #include support through ShaderPreprocessor
+//     2026-10-18   1.50      agt      Precompiled SPIR-V shaders (GL_ARB_gl_spirv)
+//     2026-10-18   1.60      agt      Shader files served from the mounted ResourceBundle
+//     2026-10-18   1.70      agt      Debug output filtered and logged through DebugOutput
+//     2026-10-18   1.80      agt      Info log error checks follow the ErrorCheck level
+//     2026-10-18   1.90      agt      Programs bound through the StateTracker
 //     2014-11-27   1.10      klu      Initial file release
 //  \endverbatim
 */
@@ -20,7 +26,12 @@
 #include <iostream>
 #include <fstream>
 #include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <iterator>
 #include <typeinfo>
+#include <cstring>
 using namespace std;
 
 
@@ -32,6 +43,34 @@ using namespace std;
 
 // application helper includes ////////////////////////////////////////////////////////////////////
 #include "../inc/UtilGLSL.h"
+#include "../inc/ShaderPreprocessor.h"
+#include "../inc/StateTracker.h"
+#include "../inc/ResourceBundle.h"
+#include "../inc/DebugOutput.h"
+#include "../inc/ErrorCheck.h"
+
+
+
+// GL_ARB_gl_spirv (core in OpenGL 4.6) is newer than the bundled GLEW, load it directly ///////////
+#ifndef GL_SHADER_BINARY_FORMAT_SPIR_V
+#define GL_SHADER_BINARY_FORMAT_SPIR_V 0x9551
+#define GL_SPIR_V_BINARY               0x9552
+#endif
+
+typedef void (GLAPIENTRY * PFNGLSPECIALIZESHADERPROC) (GLuint shader, const GLchar* pEntryPoint,
+	GLuint numSpecializationConstants, const GLuint* pConstantIndex, const GLuint* pConstantValue);
+
+#if defined(_WIN32)
+#include <windows.h>
+#define getProcAddress(name) wglGetProcAddress(name)
+#elif defined(__APPLE__)
+#define getProcAddress(name) NULL   // no SPIR-V support in macOS OpenGL 4.1
+#else
+extern "C" void (*glXGetProcAddressARB(const GLubyte* procName))(void);
+#define getProcAddress(name) glXGetProcAddressARB((const GLubyte*) name)
+#endif
+
+static PFNGLSPECIALIZESHADERPROC glSpecializeShader = NULL;
 
 
 
@@ -86,68 +125,16 @@ float UtilGLSL::checkOpenGLVersion()
 
 
 
-///////////////////////////////////////////////////////////////////////////////////////////////////
-// function: DebugMessageCallback()
-// purpose:  The glDebugMessageCallback() function to be registered by initOpenGLDebugCallback().
-///////////////////////////////////////////////////////////////////////////////////////////////////
-void UtilGLSL::DebugMessageCallback(GLenum source, GLenum type, GLuint id,
-	GLenum severity, GLsizei length, const GLchar* message, void* userParam)
-{
-	cout << "OpenGL Debug Callback: " << message << endl;
-	cout << "(Source: ";
-	switch (source)
-	{
-		case GL_DEBUG_SOURCE_API: cout << "API"; break;
-		case GL_DEBUG_SOURCE_WINDOW_SYSTEM:	cout << "WINDOW_SYSTEM"; break;
-		case GL_DEBUG_SOURCE_THIRD_PARTY: cout << "THIRD_PARTY"; break;
-		case GL_DEBUG_SOURCE_APPLICATION:	cout << "APPLICATION"; break;
-		case GL_DEBUG_SOURCE_OTHER:	cout << "OTHER"; break;
-	}
-
-	cout << ", Type: ";
-	switch (type)
-	{
-		case GL_DEBUG_TYPE_ERROR: cout << "ERROR"; break;
-		case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:	cout << "DEPRECATED_BEHAVIOR"; break;
-		case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: cout << "UNDEFINED_BEHAVIOR"; break;
-		case GL_DEBUG_TYPE_PORTABILITY:	cout << "PORTABILITY"; break;
-		case GL_DEBUG_TYPE_PERFORMANCE:	cout << "PERFORMANCE"; break;
-		case GL_DEBUG_TYPE_OTHER: cout << "OTHER"; break;
-	}
-
-	cout << ", Severity: ";
-	switch (severity)
-	{
-		case GL_DEBUG_SEVERITY_LOW: cout << "LOW"; break;
-		case GL_DEBUG_SEVERITY_MEDIUM: cout << "MEDIUM"; break;
-		case GL_DEBUG_SEVERITY_HIGH: cout << "HIGH"; break;
-	}
-	cout << ", ID: " << id << ")" << endl << endl;
-}
-// DebugMessageCallback() /////////////////////////////////////////////////////////////////////////
-
-
-
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // function: initOpenGLDebugCallback()
 // purpose:  This function is used to register an OpenGL glDebugMessageCallback function.
 //           (Only available in compatibility profile mode and with OpenGL version > 4.2)
+//           Filters, rate limiting and the logging mode are handled by DebugOutput.
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 void UtilGLSL::initOpenGLDebugCallback(void)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 {
-	if (glDebugMessageCallback)
-	{
-		cout << "OpenGL debug message callback successfully registerd." << endl << endl;
-		glEnable(GL_DEBUG_OUTPUT);
-		glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
-		glDebugMessageCallback((GLDEBUGPROC) DebugMessageCallback, NULL);
-
-		GLuint unusedIds = 0;
-		glDebugMessageControl(GL_DONT_CARE,	GL_DONT_CARE, GL_DONT_CARE,	0, &unusedIds, true);
-	}
-	else
-		cout << "OpenGL glDebugMessageCallback function not available" << endl << endl;
+	DebugOutput::init();
 }
 // initOpenGLDebugCallback() //////////////////////////////////////////////////////////////////////
 
@@ -197,7 +184,7 @@ void UtilGLSL::checkShaderInfoLog(GLuint shader)
 	{
 		cout << "Shader InfoLog : no errors" << endl << endl;
 	}
-	checkOpenGLErrorCode();  // check for OpenGL errors
+	CG_GL_CHECK("checkShaderInfoLog");  // check for OpenGL errors
 }
 // checkShaderInfoLog() ///////////////////////////////////////////////////////////////////////////
 
@@ -228,18 +215,33 @@ void UtilGLSL::checkProgramInfoLog(GLuint program)
 	{
 		cout << "Program InfoLog: no errors" << endl << endl;
 	}
-	checkOpenGLErrorCode();  // check for OpenGL errors
+	CG_GL_CHECK("checkProgramInfoLog");  // check for OpenGL errors
 }
 // checkProgramInfoLog() //////////////////////////////////////////////////////////////////////////
 
 
 
 
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: findShaderFile()
+// purpose:  Returns a view of a shader file in the mounted ResourceBundle without copying it
+//           ('\0' terminated, valid while the bundle is mounted). Files that are not bundled
+//           are read from the file system with readShaderFile().
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtilGLSL::findShaderFile(const string& filename, ResourceBundle::ViewT& code)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	return ResourceBundle::findMounted(filename, code);
+}
+// findShaderFile() ///////////////////////////////////////////////////////////////////////////////
+
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 // function: readShaderFile()
 // purpose:  This function is called to read the source code of a vertex or
-//           fragment shader. It is the caller's responsibility to destroy
-//           the shader source code text buffer using delete[].
+//           fragment shader from the file system. It is the caller's responsibility
+//           to destroy the shader source code text buffer using delete[].
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 char* UtilGLSL::readShaderFile(const string& filename)
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -318,6 +320,8 @@ GLuint UtilGLSL::initShaderProgram(int argc, char **argv)
 	else
 	{
 		// loop through command line specified array of filename strings
+		// (precompiled SPIR-V modules are named after their source, e.g. helloglsl.vert.spv)
+		ShaderPreprocessor preprocessor;
 		for (int i = 1; i < argc; ++i)
 		{
 			string filename = argv[i];
@@ -355,19 +359,22 @@ GLuint UtilGLSL::initShaderProgram(int argc, char **argv)
 
 			// cout << "DEBUG: Shader ID = " << shader << endl;
 
-			const char* shader_code = readShaderFile(filename);
-			if (shader_code != NULL)
+			if (filename.size() > 4 && filename.compare(filename.size() - 4, 4, ".spv") == 0)
 			{
-				glShaderSource(shader, 1, &shader_code, NULL);
-				delete[] shader_code;	shader_code = 0;
+				// SPIR-V module, no GLSL compilation required
+				loadSpirvShader(shader, filename, SpecializationT(), "main");
 			}
 			else
 			{
-				cout << "Error: Unable to load shader source code (" << filename << ")" << endl << endl;
+				// read shader source code with resolved #include directives
+				const string* shader_code = preprocessor.expand(filename);
+				if (shader_code != NULL)
+				{
+					const char* code = shader_code->c_str();
+					glShaderSource(shader, 1, &code, NULL);
+				}
+				glCompileShader(shader);
 			}
-
-
-			glCompileShader(shader);
 			checkShaderInfoLog(shader);
 			glAttachShader(program, shader);
 			glDeleteShader(shader);          // flag shader for deletion
@@ -383,7 +390,7 @@ GLuint UtilGLSL::initShaderProgram(int argc, char **argv)
 	glGetProgramiv(program, GL_LINK_STATUS, &successful);
 	if (successful)
 	{
-		glUseProgram(program);
+		StateTracker::useProgram(program);
 	}
 	else
 	{
@@ -391,8 +398,205 @@ GLuint UtilGLSL::initShaderProgram(int argc, char **argv)
 		program = 0;
 	}
 
-	checkOpenGLErrorCode();
+	CG_GL_CHECK("initShaderProgram");
 	return program;
 }
 // initShaderProgram() ////////////////////////////////////////////////////////////////////////////
 
+
+
+void UtilGLSL::SpecializationT::set(GLuint id, GLuint value)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	for (size_t i = 0; i < ids.size(); ++i)
+	{
+		if (ids[i] == id)
+		{
+			values[i] = value;
+			return;
+		}
+	}
+	ids.push_back(id);
+	values.push_back(value);
+}
+// SpecializationT::set() /////////////////////////////////////////////////////////////////////////
+
+
+
+void UtilGLSL::SpecializationT::set(GLuint id, GLint value)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	set(id, GLuint(value));
+}
+// SpecializationT::set() /////////////////////////////////////////////////////////////////////////
+
+
+
+void UtilGLSL::SpecializationT::set(GLuint id, float value)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	// specialization constants are passed as their 32-bit pattern
+	GLuint bits;
+	memcpy(&bits, &value, sizeof(bits));
+	set(id, bits);
+}
+// SpecializationT::set() /////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: isSpirvSupported()
+// purpose:  Checks for GL_ARB_gl_spirv (or OpenGL 4.6) and loads glSpecializeShader().
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtilGLSL::isSpirvSupported(void)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (glSpecializeShader != NULL) return true;
+
+	bool supported = (checkOpenGLVersion() >= 4.6f);
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count && !supported; ++i)
+	{
+		supported = (strcmp((const char*) glGetStringi(GL_EXTENSIONS, i), "GL_ARB_gl_spirv") == 0);
+	}
+	if (!supported) return false;
+
+	glSpecializeShader = (PFNGLSPECIALIZESHADERPROC) getProcAddress("glSpecializeShader");
+	if (glSpecializeShader == NULL)
+	{
+		glSpecializeShader = (PFNGLSPECIALIZESHADERPROC) getProcAddress("glSpecializeShaderARB");
+	}
+	return (glSpecializeShader != NULL);
+}
+// isSpirvSupported() /////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: isSpirvProgram()
+// purpose:  Returns true if the program was built from SPIR-V modules. These carry no names,
+//           so their attributes and uniforms have to be addressed by explicit locations.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtilGLSL::isSpirvProgram(GLuint program)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint shaders[8];
+	GLsizei count = 0;
+	if (program == 0 || glSpecializeShader == NULL) return false;
+
+	glGetAttachedShaders(program, 8, &count, shaders);
+	GLint binary = GL_FALSE;
+	if (count > 0) glGetShaderiv(shaders[0], GL_SPIR_V_BINARY, &binary);
+	return (binary == GL_TRUE);
+}
+// isSpirvProgram() ///////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: loadSpirvShader()
+// purpose:  Loads a SPIR-V module into the shader object with glShaderBinary() and
+//           specializes its entry point with the given constants (replaces compilation).
+///////////////////////////////////////////////////////////////////////////////////////////////////
+bool UtilGLSL::loadSpirvShader(GLuint shader, const string& filename,
+	const SpecializationT& constants, const char* entryPoint)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	if (!isSpirvSupported())
+	{
+		cout << "Error: SPIR-V shaders require GL_ARB_gl_spirv (" << filename << ")" << endl << endl;
+		return false;
+	}
+
+	// the module is passed straight from the mounted bundle (16 byte aligned), else read
+	vector<char> binary;
+	ResourceBundle::ViewT module;
+	if (!ResourceBundle::findMounted(filename, module))
+	{
+		ifstream file(filename.c_str(), ios_base::in | ios_base::binary);
+		binary.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+		module.data = binary.empty() ? NULL : &binary[0];
+		module.size = binary.size();
+		cout << "Reading SPIR-V : " << filename << " (" << binary.size() << " bytes)" << endl;
+	}
+
+	GLuint magic = 0;
+	if (module.size >= 4) memcpy(&magic, module.data, sizeof(magic));
+	if (magic != 0x07230203 || module.size % 4 != 0)
+	{
+		cout << "Error: Unable to load SPIR-V module (" << filename << ")" << endl << endl;
+		return false;
+	}
+
+	glShaderBinary(1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, module.data, GLsizei(module.size));
+	glSpecializeShader(shader, entryPoint, GLuint(constants.ids.size()),
+		constants.ids.empty() ? NULL : &constants.ids[0],
+		constants.values.empty() ? NULL : &constants.values[0]);
+
+	GLint specialized = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &specialized);
+	return (specialized == GL_TRUE);
+}
+// loadSpirvShader() //////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: initSpirvShader()
+// purpose:  Creates a shader object from a precompiled SPIR-V module with the given
+//           specialization constants. Returns 0 on errors.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint UtilGLSL::initSpirvShader(GLenum type, const string& filename,
+	const SpecializationT& constants, const char* entryPoint)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint shader = glCreateShader(type);
+	if (!loadSpirvShader(shader, filename, constants, entryPoint))
+	{
+		checkShaderInfoLog(shader);
+		glDeleteShader(shader);
+		return 0;
+	}
+	return shader;
+}
+// initSpirvShader() //////////////////////////////////////////////////////////////////////////////
+
+
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// function: initSpirvProgram()
+// purpose:  Links a program from SPIR-V modules (shader types taken from the file names,
+//           e.g. helloglsl.vert.spv), all specialized with the same constants. Unlike
+//           initShaderProgram() the current program is neither deleted nor replaced.
+///////////////////////////////////////////////////////////////////////////////////////////////////
+GLuint UtilGLSL::initSpirvProgram(const vector<string>& filenames, const SpecializationT& constants)
+///////////////////////////////////////////////////////////////////////////////////////////////////
+{
+	GLuint program = glCreateProgram();
+	for (size_t i = 0; i < filenames.size(); ++i)
+	{
+		GLuint shader = initSpirvShader(ShaderPreprocessor::getShaderType(filenames[i]), filenames[i], constants);
+		if (shader == 0)
+		{
+			glDeleteProgram(program);
+			return 0;
+		}
+		glAttachShader(program, shader);
+		glDeleteShader(shader);          // flag shader for deletion
+	}
+
+	glLinkProgram(program);
+	checkProgramInfoLog(program);
+
+	GLint successful = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &successful);
+	if (!successful)
+	{
+		cout << "Error: linking SPIR-V program" << endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+// initSpirvProgram() /////////////////////////////////////////////////////////////////////////////